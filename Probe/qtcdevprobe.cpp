@@ -0,0 +1,174 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "qtcdevprobe.h"
+#include "stalldetector.h"
+
+#include "../qtcdevpluginconstants.h"
+
+#include <extensionsystem/pluginmanager.h>
+#include <extensionsystem/pluginspec.h>
+
+#include <utils/hostosinfo.h>
+
+#include <QtCore>
+#include <QtNetwork>
+#include <QApplication>
+
+#ifdef Q_OS_UNIX
+#   include <csignal>
+#   include <cstdio>
+#endif
+
+namespace QtcDevPlugin {
+namespace Probe {
+
+/*!
+ * \brief Resident set size
+ *
+ * Returns the resident set size of the current process (\c VmRSS in <tt>/proc/self/status</tt>).
+ * \return The resident set size in kibibytes or a negative value if it is unknown.
+ */
+static double residentSetSize(void)
+{
+    if (!Utils::HostOsInfo::isLinuxHost())
+        return -1.;
+
+    QFile statusFile(QLatin1String("/proc/self/status"));
+    if (!statusFile.open(QIODevice::ReadOnly | QIODevice::Text))
+        return -1.;
+
+    static const QRegularExpression rssRegExp(QLatin1String("^VmRSS:\\s*(\\d+)\\s*kB"), QRegularExpression::MultilineOption);
+    QRegularExpressionMatch match = rssRegExp.match(QString::fromLatin1(statusFile.readAll()));
+    return match.hasMatch() ? match.captured(1).toDouble() : -1.;
+}
+
+Utils::Result<> QtcDevProbe::initialize(const QStringList &arguments)
+{
+    Q_UNUSED(arguments)
+
+#ifdef Q_OS_UNIX
+    // NOTE All plugin libraries are loaded before plugins are initialised.
+    if (qEnvironmentVariableIsSet(Constants::ProbeStandbyVariable)) {
+        fprintf(stderr, "%s\n", Constants::ProbeStandbyMarker);
+        fflush(stderr);
+        ::raise(SIGSTOP);
+    }
+#endif
+
+    QString serverName = qEnvironmentVariable(Constants::ProbeServerVariable);
+    if (serverName.isEmpty())
+        return Utils::ResultOk;
+
+    mSocket = new QLocalSocket(this);
+    mSocket->connectToServer(serverName, QIODevice::WriteOnly);
+    if (!mSocket->waitForConnected(1000)) {
+        qWarning() << "QtcDevProbe could not connect to" << serverName << ":" << mSocket->errorString();
+        return Utils::ResultOk;
+    }
+
+    connect(ExtensionSystem::PluginManager::instance(), &ExtensionSystem::PluginManager::initializationDone,
+            this, &QtcDevProbe::sendPluginTimings);
+    connect(ExtensionSystem::PluginManager::instance(), &ExtensionSystem::PluginManager::initializationDone,
+            this, &QtcDevProbe::startStallDetection);
+
+    mLatencyTimer.setTimerType(Qt::PreciseTimer);
+    mLatencyTimer.setInterval(LatencyInterval);
+    connect(&mLatencyTimer, &QTimer::timeout,
+            this, &QtcDevProbe::measureLatency);
+    mLatencyClock.start();
+    mLatencyTimer.start();
+
+    mSampleTimer.setInterval(SampleInterval);
+    connect(&mSampleTimer, &QTimer::timeout,
+            this, &QtcDevProbe::sendSample);
+    mSampleTimer.start();
+
+    return Utils::ResultOk;
+}
+
+void QtcDevProbe::sendPluginTimings(void)
+{
+    QJsonArray plugins;
+    for (ExtensionSystem::PluginSpec* spec : ExtensionSystem::PluginManager::plugins()) {
+        if (spec->state() != ExtensionSystem::PluginSpec::Running)
+            continue;
+
+        const ExtensionSystem::PerformanceData& performance = spec->performanceData();
+        plugins << QJsonObject({
+            {QLatin1String("name"), spec->name()},
+            {QLatin1String("load"), performance.load},
+            {QLatin1String("initialize"), performance.initialize},
+            {QLatin1String("extensionsInitialized"), performance.extensionsInitialized},
+            {QLatin1String("delayedInitialize"), performance.delayedInitialize},
+        });
+    }
+
+    send(QJsonObject({
+        {QLatin1String("type"), QLatin1String("plugins")},
+        {QLatin1String("plugins"), plugins},
+    }));
+}
+
+void QtcDevProbe::startStallDetection(void)
+{
+    // NOTE Startup is not watched, since plugin initialisation blocks the event loop by design.
+    int threshold = qEnvironmentVariableIntValue(Constants::ProbeStallThresholdVariable);
+    if (threshold <= 0)
+        return;
+
+    StallDetector* stallDetector = new StallDetector(threshold, this);
+    connect(stallDetector, &StallDetector::stalled,
+            this, [this] (qint64 duration, const QJsonArray& frames) {
+        send(QJsonObject({
+            {QLatin1String("type"), QLatin1String("stall")},
+            {QLatin1String("duration"), duration},
+            {QLatin1String("frames"), frames},
+        }));
+    });
+}
+
+void QtcDevProbe::measureLatency(void)
+{
+    qint64 latency = mLatencyClock.restart() - LatencyInterval;
+    mMaxLatency = qMax(mMaxLatency, latency);
+}
+
+void QtcDevProbe::sendSample(void)
+{
+    send(QJsonObject({
+        {QLatin1String("type"), QLatin1String("sample")},
+        {QLatin1String("latency"), mMaxLatency},
+        {QLatin1String("rss"), residentSetSize()},
+        {QLatin1String("widgets"), QApplication::allWidgets().size()},
+        {QLatin1String("objects"), ExtensionSystem::PluginManager::allObjects().size()},
+    }));
+    mMaxLatency = 0;
+}
+
+void QtcDevProbe::send(const QJsonObject& message)
+{
+    if ((mSocket == nullptr) || (mSocket->state() != QLocalSocket::ConnectedState))
+        return;
+
+    mSocket->write(QJsonDocument(message).toJson(QJsonDocument::Compact) + '\n');
+    mSocket->flush();
+}
+
+} // Probe
+} // QtcDevPlugin
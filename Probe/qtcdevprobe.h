@@ -0,0 +1,122 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef QTCDEVPROBE_H
+#define QTCDEVPROBE_H
+
+#include <extensionsystem/iplugin.h>
+
+#include <QElapsedTimer>
+#include <QTimer>
+
+class QLocalSocket;
+
+namespace QtcDevPlugin {
+namespace Probe {
+
+/*!
+ * \brief The QtcDevProbe class streams runtime metrics of a Qt Creator instance
+ *
+ * This plugin is loaded by QtcDevPlugin in the Qt Creator instances it starts
+ * (it is disabled by default). When the environment variable named
+ * Constants::ProbeServerVariable is set, it connects to the local socket
+ * with this name and sends one JSON object per line:
+ *  \li the initialisation timings of all plugins, once startup is done;
+ *  \li periodically, the maximum event loop latency since the last sample,
+ *  the resident set size, the number of widgets and the number of objects
+ *  in the plugin manager pool;
+ *  \li the duration and a stack sample of main thread event loop stalls,
+ *  when the environment variable named Constants::ProbeStallThresholdVariable
+ *  gives a threshold (see StallDetector).
+ *
+ * When the environment variable named Constants::ProbeStandbyVariable is set,
+ * it prints Constants::ProbeStandbyMarker and stops the instance (with \c SIGSTOP)
+ * as soon as it is initialised (see Internal::WarmStandby).
+ *
+ * \sa Internal::ProbeServer
+ */
+class QtcDevProbe : public ExtensionSystem::IPlugin
+{
+#ifndef DOXYGEN
+    Q_OBJECT
+    Q_PLUGIN_METADATA(IID "org.qt-project.Qt.QtCreatorPlugin" FILE "QtcDevProbe.json")
+#endif
+public:
+    /*!
+     * \brief Plugin initialisation method
+     *
+     * Stops the instance if it is a standby instance,
+     * then connects to the probe server (if any) and starts measuring.
+     * \param arguments Arguments passed to Qt Creator through the command line.
+     * \return \c ResultOk in all cases.
+     */
+    Utils::Result<> initialize(const QStringList &arguments) override;
+    /*!
+     * \brief Listener for dependant plugin initialisation.
+     *
+     * This function is unused.
+     */
+    inline void extensionsInitialized() override {}
+private:
+    /*!
+     * \brief Send plugin timings
+     *
+     * Sends the initialisation timings of all the plugins to the probe server.
+     */
+    void sendPluginTimings(void);
+    /*!
+     * \brief Start stall detection
+     *
+     * Starts detecting event loop stalls if a threshold is given.
+     * \sa StallDetector
+     */
+    void startStallDetection(void);
+    /*!
+     * \brief Measure event loop latency
+     *
+     * Called by the latency timer. Updates the maximum event loop latency.
+     */
+    void measureLatency(void);
+    /*!
+     * \brief Send a sample
+     *
+     * Sends the current metrics to the probe server.
+     */
+    void sendSample(void);
+    /*!
+     * \brief Send a message
+     *
+     * Sends a JSON message to the probe server.
+     * \param message The message to send.
+     */
+    void send(const QJsonObject& message);
+
+    QLocalSocket* mSocket = nullptr;    /*!< The socket connected to the probe server */
+    QTimer mLatencyTimer;               /*!< The timer used to measure event loop latency */
+    QTimer mSampleTimer;                /*!< The timer used to send samples */
+    QElapsedTimer mLatencyClock;        /*!< Measures the time between latency timer timeouts */
+    qint64 mMaxLatency = 0;             /*!< The maximum latency since the last sample (in milliseconds) */
+
+    static const int LatencyInterval = 50;  /*!< The interval of the latency timer (in milliseconds) */
+    static const int SampleInterval = 5000; /*!< The interval between samples (in milliseconds) */
+};
+
+} // Probe
+} // QtcDevPlugin
+
+#endif // QTCDEVPROBE_H
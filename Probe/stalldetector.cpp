@@ -0,0 +1,160 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "stalldetector.h"
+
+#include <QtCore>
+
+#ifdef Q_OS_LINUX
+#   include <cxxabi.h>
+#   include <dlfcn.h>
+#   include <execinfo.h>
+#   include <pthread.h>
+#   include <signal.h>
+#endif
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+namespace QtcDevPlugin {
+namespace Probe {
+
+#ifdef Q_OS_LINUX
+static const int MaxFrames = 64;        /*!< The maximum depth of stack samples */
+static void* sampledFrames[MaxFrames];  /*!< The frames sampled by the signal handler */
+static std::atomic<int> sampledFrameCount{-1}; /*!< The number of sampled frames (-1 while no sample is available) */
+static pthread_t mainThread;            /*!< The main thread */
+
+/*!
+ * \brief Sample the stack
+ *
+ * Handler for \c SIGUSR2, which samples the stack of the interrupted thread.
+ * \param signal The signal number.
+ */
+static void sampleStackHandler(int signal)
+{
+    Q_UNUSED(signal)
+    sampledFrameCount.store(backtrace(sampledFrames, MaxFrames));
+}
+#endif
+
+StallDetector::StallDetector(int threshold, QObject* parent) :
+    QObject(parent), mThreshold(qMax(10, threshold)), mInterval(qBound(5, threshold / 4, 50)), mLastBeat(0), mSampled(false), mStop(false)
+{
+#ifdef Q_OS_LINUX
+    mainThread = pthread_self();
+
+    // NOTE The first call to backtrace() loads libgcc, which is not async-signal-safe.
+    void* frame;
+    backtrace(&frame, 1);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = &sampleStackHandler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGUSR2, &action, nullptr);
+#endif
+
+    mClock.start();
+
+    mHeartbeatTimer.setTimerType(Qt::PreciseTimer);
+    mHeartbeatTimer.setInterval(mInterval);
+    connect(&mHeartbeatTimer, &QTimer::timeout,
+            this, &StallDetector::beat);
+    mHeartbeatTimer.start();
+
+    mWatchdog = std::thread(&StallDetector::watch, this);
+}
+
+StallDetector::~StallDetector(void)
+{
+    mStop.store(true);
+    if (mWatchdog.joinable())
+        mWatchdog.join();
+}
+
+void StallDetector::beat(void)
+{
+    qint64 now = mClock.elapsed();
+    qint64 duration = now - mLastBeat.exchange(now) - mInterval;
+
+    QJsonArray frames;
+    {
+        QMutexLocker locker(&mFramesMutex);
+        frames = mFrames;
+        mFrames = QJsonArray();
+    }
+    mSampled.store(false);
+
+    if (duration >= mThreshold)
+        emit stalled(duration, frames);
+}
+
+void StallDetector::watch(void)
+{
+    while (!mStop.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(mInterval));
+
+        qint64 late = mClock.elapsed() - mLastBeat.load() - mInterval;
+        if ((late < mThreshold) || mSampled.exchange(true))
+            continue;
+
+        QJsonArray frames = sampleStack();
+        QMutexLocker locker(&mFramesMutex);
+        mFrames = frames;
+    }
+}
+
+QJsonArray StallDetector::sampleStack(void)
+{
+    QJsonArray frames;
+
+#ifdef Q_OS_LINUX
+    sampledFrameCount.store(-1);
+    if (pthread_kill(mainThread, SIGUSR2) != 0)
+        return frames;
+
+    for (int w = 0; (w < 100) && (sampledFrameCount.load() < 0); w++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    int frameCount = sampledFrameCount.load();
+
+    // NOTE The first two frames are the signal handler and the signal trampoline.
+    for (int f = 2; f < frameCount; f++) {
+        Dl_info info;
+        QJsonObject frame;
+        if ((dladdr(sampledFrames[f], &info) != 0) && (info.dli_fname != nullptr)) {
+            frame.insert(QLatin1String("module"), QString::fromLocal8Bit(info.dli_fname));
+            frame.insert(QLatin1String("offset"), (qint64) ((quintptr) sampledFrames[f] - (quintptr) info.dli_fbase));
+            if (info.dli_sname != nullptr) {
+                int status = -1;
+                char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+                frame.insert(QLatin1String("symbol"), QString::fromLocal8Bit(status == 0 ? demangled : info.dli_sname));
+                free(demangled);
+            }
+        }
+        frames << frame;
+    }
+#endif
+
+    return frames;
+}
+
+} // Probe
+} // QtcDevPlugin
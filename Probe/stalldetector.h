@@ -0,0 +1,117 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef STALLDETECTOR_H
+#define STALLDETECTOR_H
+
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QMutex>
+#include <QObject>
+#include <QTimer>
+
+#include <atomic>
+#include <thread>
+
+namespace QtcDevPlugin {
+namespace Probe {
+
+/*!
+ * \brief The StallDetector class detects main thread event loop stalls
+ *
+ * This class beats a heartbeat in the main thread event loop
+ * and watches it from a watchdog thread. When the heartbeat is late
+ * by more than the threshold, the watchdog thread interrupts the main thread
+ * with a signal (\c SIGUSR2), whose handler samples the stack of the main thread.
+ *
+ * When the main thread event loop runs again, stalled() is emitted
+ * with the duration of the stall and the frames of the stack sample,
+ * resolved with \c dladdr() (which gives the shared object and
+ * the symbol of each frame).
+ *
+ * \note Stack samples are only available on Linux. On other platforms,
+ * stalls are reported without stack.
+ */
+class StallDetector : public QObject
+{
+    Q_OBJECT
+public:
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new stall detector and starts watching the main thread.
+     * It must be created in the main thread.
+     * \param threshold The stall duration threshold (in milliseconds).
+     * \param parent The parent object.
+     */
+    StallDetector(int threshold, QObject* parent = nullptr);
+    /*!
+     * \brief Destructor
+     *
+     * Stops the watchdog thread.
+     */
+    ~StallDetector(void);
+signals:
+    /*!
+     * \brief Stall detected
+     *
+     * This signal is emitted once the event loop runs again after a stall.
+     * \param duration The duration of the stall (in milliseconds).
+     * \param frames The frames of the stack sampled during the stall (innermost first).
+     * Each frame is an object with \c module, \c symbol and \c offset keys.
+     */
+    void stalled(qint64 duration, const QJsonArray& frames);
+private:
+    /*!
+     * \brief Heartbeat
+     *
+     * Called periodically in the main thread. Emits stalled() when the previous
+     * heartbeat is older than the threshold.
+     */
+    void beat(void);
+    /*!
+     * \brief Watch the main thread
+     *
+     * Body of the watchdog thread. Samples the stack of the main thread
+     * once per stall.
+     */
+    void watch(void);
+    /*!
+     * \brief Sample the main thread stack
+     *
+     * Interrupts the main thread to sample its stack and resolves the frames.
+     * \return The frames of the stack of the main thread (innermost first).
+     */
+    QJsonArray sampleStack(void);
+
+    const int mThreshold;                   /*!< The stall duration threshold (in milliseconds) */
+    const int mInterval;                    /*!< The heartbeat interval (in milliseconds) */
+    QTimer mHeartbeatTimer;                 /*!< Timer beating the heartbeat in the main thread */
+    QElapsedTimer mClock;                   /*!< Monotonic clock shared by both threads */
+    std::atomic<qint64> mLastBeat;          /*!< The time of the last heartbeat (in milliseconds since clock start) */
+    std::atomic<bool> mSampled;             /*!< Whether the current stall was sampled */
+    std::atomic<bool> mStop;                /*!< Tells the watchdog thread to stop */
+    QMutex mFramesMutex;                    /*!< Protects the stack sample */
+    QJsonArray mFrames;                     /*!< The stack sampled during the current stall */
+    std::thread mWatchdog;                  /*!< The watchdog thread */
+};
+
+} // Probe
+} // QtcDevPlugin
+
+#endif // STALLDETECTOR_H
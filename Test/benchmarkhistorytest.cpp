@@ -0,0 +1,104 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "benchmarkhistorytest.h"
+
+#include "../benchmarkhistory.h"
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void BenchmarkHistoryTest::testParse(void)
+{
+    QString output = QLatin1String(
+        "PASS   : QtcPluginTest::Internal::Test::testHello()\n"
+        "RESULT : QtcPluginTest::Internal::Test::benchSort():\n"
+        "     0.052 msecs per iteration (total: 107, iterations: 2048)\n"
+        "PASS   : QtcPluginTest::Internal::Test::benchSort()\n"
+        "RESULT : QtcPluginTest::Internal::Test::benchParse():\"large\":\n"
+        "     1,234,567 CPU ticks per iteration (total: 1,234,567, iterations: 1)\n"
+        "PASS   : QtcPluginTest::Internal::Test::benchParse()\n"
+    );
+
+    QList<Internal::BenchmarkHistory::Result> results = Internal::BenchmarkHistory::parse(output);
+    QCOMPARE(results.size(), 2);
+    QCOMPARE(results.at(0).name, QLatin1String("QtcPluginTest::Internal::Test::benchSort()"));
+    QCOMPARE(results.at(0).unit, QLatin1String("msecs"));
+    QCOMPARE(results.at(0).value, 0.052);
+    QCOMPARE(results.at(1).name, QLatin1String("QtcPluginTest::Internal::Test::benchParse():\"large\""));
+    QCOMPARE(results.at(1).unit, QLatin1String("CPU ticks"));
+    QCOMPARE(results.at(1).value, 1234567.);
+}
+
+void BenchmarkHistoryTest::testRegressions_data(void)
+{
+    QTest::addColumn< QList<double> >("history");
+    QTest::addColumn<double>("value");
+    QTest::addColumn<bool>("regression");
+
+    QTest::newRow("No history") << QList<double>() << 100. << false;
+    QTest::newRow("Improvement") << (QList<double>() << 100.) << 50. << false;
+    QTest::newRow("Below threshold") << (QList<double>() << 100.) << 104. << false;
+    QTest::newRow("Above threshold") << (QList<double>() << 100.) << 110. << true;
+    QTest::newRow("Noisy") << (QList<double>() << 80. << 120. << 100. << 90. << 110.) << 110. << false;
+    QTest::newRow("Significant") << (QList<double>() << 99. << 101. << 100. << 100. << 100.) << 110. << true;
+}
+
+void BenchmarkHistoryTest::testRegressions(void)
+{
+    QFETCH(QList<double>, history);
+    QFETCH(double, value);
+    QFETCH(bool, regression);
+
+    QVERIFY(mHistoryDir.isValid());
+    Utils::FilePath historyFilePath = Utils::FilePath::fromString(mHistoryDir.filePath(QTest::currentDataTag()));
+
+    Internal::BenchmarkHistory benchmarkHistory(historyFilePath, QLatin1String("QtcPluginTest"));
+    for (double v : history)
+        benchmarkHistory.append(QList<Internal::BenchmarkHistory::Result>() << Internal::BenchmarkHistory::Result{"bench()", "msecs", v});
+
+    QList<Internal::BenchmarkHistory::Result> results;
+    results << Internal::BenchmarkHistory::Result{"bench()", "msecs", value};
+    QCOMPARE(benchmarkHistory.regressions(results, 5).size(), regression ? 1 : 0);
+
+    // Results in other units must not be compared:
+    results.clear();
+    results << Internal::BenchmarkHistory::Result{"bench()", "CPU ticks", value};
+    QCOMPARE(benchmarkHistory.regressions(results, 5).size(), 0);
+}
+
+void BenchmarkHistoryTest::testSaveRestore(void)
+{
+    QVERIFY(mHistoryDir.isValid());
+    Utils::FilePath historyFilePath = Utils::FilePath::fromString(mHistoryDir.filePath("history.json"));
+
+    Internal::BenchmarkHistory benchmarkHistory(historyFilePath, QLatin1String("QtcPluginTest"));
+    for (int i = 0; i < Internal::BenchmarkHistory::MaxResults + 5; i++)
+        benchmarkHistory.append(QList<Internal::BenchmarkHistory::Result>() << Internal::BenchmarkHistory::Result{"bench()", "msecs", 100.});
+    QVERIFY(benchmarkHistory.save());
+
+    QList<Internal::BenchmarkHistory::Result> results;
+    results << Internal::BenchmarkHistory::Result{"bench()", "msecs", 200.};
+    QCOMPARE(Internal::BenchmarkHistory(historyFilePath, QLatin1String("QtcPluginTest")).regressions(results, 5).size(), 1);
+    QCOMPARE(Internal::BenchmarkHistory(historyFilePath, QLatin1String("OtherPlugin")).regressions(results, 5).size(), 0);
+}
+
+} // Test
+} // QtcDevPlugin
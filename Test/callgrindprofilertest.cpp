@@ -0,0 +1,157 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "callgrindprofilertest.h"
+
+#include "../callgrindprofiler.h"
+
+#include <QtTest>
+
+#define TEST_SOURCES_DIR TESTS_DIR "/../Test"
+
+namespace QtcDevPlugin {
+namespace Test {
+
+QByteArray CallgrindProfilerTest::profile(void)
+{
+    return QByteArray(
+        "# callgrind format\n"
+        "version: 1\n"
+        "creator: callgrind-3.22.0\n"
+        "pid: 1234\n"
+        "cmd:  /opt/qtcreator/bin/qtcreator -test MyPlugin\n"
+        "part: 1\n"
+        "\n"
+        "desc: I1 cache: \n"
+        "positions: line\n"
+        "events: Ir\n"
+        "summary: 1500\n"
+        "\n"
+        "ob=(1) /build/lib/qtcreator/plugins/libMyPlugin.so\n"
+        "fl=(1) /src/modeltest.cpp\n"
+        "fn=(1) MyPlugin::Test::ModelTest::testIndex()\n"
+        "12 100\n"
+        "+1 20\n"
+        "cob=(2) /usr/lib/libQt6Core.so.6\n"
+        "cfl=(2) ???\n"
+        "cfn=(2) QString::append(QString const&)\n"
+        "calls=3 0\n"
+        "+2 300\n"
+        "cfn=(3) MyPlugin::Model::index(int, int) const\n"
+        "calls=1 40\n"
+        "* 500\n"
+        "\n"
+        "fn=(4) MyPlugin::Test::ModelTest::testIndex_data()\n"
+        "30 70\n"
+        "\n"
+        "fn=(5) MyPlugin::Test::ModelTest::testReset()\n"
+        "50 10\n"
+        "cfn=(3)\n"
+        "calls=2 40\n"
+        "51 250\n"
+        "\n"
+        "ob=(2)\n"
+        "fl=(2)\n"
+        "fn=(2)\n"
+        "0 300\n"
+        "\n"
+        "fl=(3) /src/model.cpp\n"
+        "fn=(3)\n"
+        "40 750\n"
+        "\n"
+        "fl=(1)\n"
+        "fn=(1)\n"
+        "14 5\n"
+        "\n"
+        "totals: 1500\n"
+    );
+}
+
+void CallgrindProfilerTest::testPatterns_data(void)
+{
+    QTest::addColumn<QString>("functions");
+    QTest::addColumn<QStringList>("patterns");
+
+    QTest::newRow("Empty") << QString() << QStringList();
+    QTest::newRow("Single") << "*::test*" << (QStringList() << QLatin1String("*::test*"));
+    QTest::newRow("Multiple") << " *::test*, MyPlugin::*::check* ,," << (QStringList() << QLatin1String("*::test*") << QLatin1String("MyPlugin::*::check*"));
+}
+
+void CallgrindProfilerTest::testPatterns(void)
+{
+    QFETCH(QString, functions);
+    QFETCH(QStringList, patterns);
+
+    QCOMPARE(Internal::CallgrindProfiler::patterns(functions), patterns);
+}
+
+void CallgrindProfilerTest::testInclusiveCosts(void)
+{
+    QMap<QString, qint64> costs = Internal::CallgrindProfiler::inclusiveCosts(profile(), QStringList() << QLatin1String("*::test*"));
+
+    QMap<QString, qint64> expected;
+    expected.insert(QLatin1String("MyPlugin::Test::ModelTest::testIndex()"), 925);
+    expected.insert(QLatin1String("MyPlugin::Test::ModelTest::testReset()"), 260);
+    QCOMPARE(costs, expected);
+
+    costs = Internal::CallgrindProfiler::inclusiveCosts(profile(), QStringList() << QLatin1String("*::testReset()") << QLatin1String("MyPlugin::Model::*"));
+    expected.clear();
+    expected.insert(QLatin1String("MyPlugin::Test::ModelTest::testReset()"), 260);
+    expected.insert(QLatin1String("MyPlugin::Model::index(int, int) const"), 750);
+    QCOMPARE(costs, expected);
+
+    QVERIFY(Internal::CallgrindProfiler::inclusiveCosts(profile(), QStringList() << QLatin1String("*::check*")).isEmpty());
+}
+
+void CallgrindProfilerTest::testTestSlotPatterns(void)
+{
+    QStringList patterns = Internal::CallgrindProfiler::testSlotPatterns(QList<Utils::FilePath>() << Utils::FilePath::fromString(TEST_SOURCES_DIR "/..").cleanPath());
+
+    QVERIFY(patterns.contains(QLatin1String("*CallgrindProfilerTest::testPatterns()")));
+    QVERIFY(patterns.contains(QLatin1String("*CallgrindProfilerTest::testTestSlotPatterns()")));
+    QVERIFY(!patterns.contains(QLatin1String("*CallgrindProfilerTest::testPatterns_data()")));
+    QVERIFY(std::none_of(patterns.cbegin(), patterns.cend(), [] (const QString& pattern) {
+        return pattern.contains(QLatin1String("initTestCase")) || pattern.contains(QLatin1String("_data"));
+    }));
+
+    QVERIFY(Internal::CallgrindProfiler::testSlotPatterns(QList<Utils::FilePath>()).isEmpty());
+
+    // Fallback patterns:
+    QMap<QString, qint64> costs = Internal::CallgrindProfiler::inclusiveCosts(profile(), Internal::CallgrindProfiler::patterns(Internal::CallgrindProfiler::FallbackFunctions));
+    QCOMPARE(costs.size(), 2);
+}
+
+void CallgrindProfilerTest::testInstructionPositions(void)
+{
+    QByteArray instrProfile(
+        "positions: instr line\n"
+        "events: Ir\n"
+        "fn=(1) MyPlugin::Test::ModelTest::testIndex()\n"
+        "0x401000 12 100\n"
+        "+4 +1 20\n"
+        "cfn=(2) QString::append(QString const&)\n"
+        "calls=3 0x402000 0\n"
+        "+8 * 300\n"
+    );
+
+    QMap<QString, qint64> costs = Internal::CallgrindProfiler::inclusiveCosts(instrProfile, QStringList() << QLatin1String("*::test*"));
+    QCOMPARE(costs.value(QLatin1String("MyPlugin::Test::ModelTest::testIndex()")), (qint64) 420);
+}
+
+} // Test
+} // QtcDevPlugin
@@ -0,0 +1,255 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "discoverybenchmarktest.h"
+#include "testhelper.h"
+#include "syntheticproject.h"
+
+#include "../cmakeqtcrunconfigurationfactory.h"
+#include "../qmakeqtcrunconfigurationfactory.h"
+#include "../qtctestrunconfiguration.h"
+
+#include <projectexplorer/buildconfiguration.h>
+#include <projectexplorer/buildsystem.h>
+#include <projectexplorer/project.h>
+#include <projectexplorer/runconfiguration.h>
+
+#include <utils/filepath.h>
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void DiscoveryBenchmarkTest::initTestCase(void)
+{
+    QList<Utils::FilePath> projectPathes;
+
+    // NOTE _data() function is not available for initTestCase()
+    projectPathes << Utils::FilePath::fromString(TESTS_DIR "/qMake/ProjectTest");
+    projectPathes << Utils::FilePath::fromString(TESTS_DIR "/qMake/QtcPluginTest");
+    projectPathes << Utils::FilePath::fromString(TESTS_DIR "/qMake/TestAndPlugin");
+    projectPathes << Utils::FilePath::fromString(TESTS_DIR "/qMake/TwoSubPlugins");
+
+    for (Utils::FilePath projectPath: projectPathes)
+        QVERIFY(removeProjectUserFiles(projectPath));
+}
+
+void DiscoveryBenchmarkTest::cleanup(void)
+{
+    releaseProject();
+}
+
+void DiscoveryBenchmarkTest::releaseProject(void)
+{
+    if (mProject != nullptr)
+        QVERIFY(closeProject(mProject));
+    mProject = nullptr;
+    mProjectDir.reset();
+}
+
+void DiscoveryBenchmarkTest::benchmarkCMakeAvailableCreators_data(void)
+{
+    QTest::addColumn<Utils::FilePath>("projectPath");
+    QTest::addColumn<int>("pluginCount");
+
+    QTest::newRow("OneSubTest") << Utils::FilePath::fromString(TESTS_DIR "/cMake/OneSubTest/CMakeLists.txt") << 0;
+    QTest::newRow("QtcPluginTest") << Utils::FilePath::fromString(TESTS_DIR "/cMake/QtcPluginTest/CMakeLists.txt") << 1;
+    QTest::newRow("TestAndPlugin") << Utils::FilePath::fromString(TESTS_DIR "/cMake/TestAndPlugin/CMakeLists.txt") << 1;
+    QTest::newRow("TwoSubPlugins") << Utils::FilePath::fromString(TESTS_DIR "/cMake/TwoSubPlugins/CMakeLists.txt") << 2;
+    QTest::newRow("TwoQtcPlugins") << Utils::FilePath::fromString(TESTS_DIR "/cMake/TwoQtcPlugins/CMakeLists.txt") << 2;
+}
+
+void DiscoveryBenchmarkTest::benchmarkCMakeAvailableCreators(void)
+{
+    QFETCH(Utils::FilePath, projectPath);
+    QFETCH(int, pluginCount);
+
+    benchmarkAvailableCreators< Internal::CMakeQtcRunConfigurationFactory<Internal::QtcTestRunConfiguration> >(projectPath, pluginCount, Utils::FilePath());
+}
+
+void DiscoveryBenchmarkTest::benchmarkQMakeAvailableCreators_data(void)
+{
+    QTest::addColumn<Utils::FilePath>("projectPath");
+    QTest::addColumn<int>("pluginCount");
+
+    QTest::newRow("ProjectTest") << Utils::FilePath::fromString(TESTS_DIR "/qMake/ProjectTest/ProjectTest.pro") << 0;
+    QTest::newRow("QtcPluginTest") << Utils::FilePath::fromString(TESTS_DIR "/qMake/QtcPluginTest/QtcPluginTest.pro") << 1;
+    QTest::newRow("TestAndPlugin") << Utils::FilePath::fromString(TESTS_DIR "/qMake/TestAndPlugin/TestAndPlugin.pro") << 1;
+    QTest::newRow("TwoSubPlugins") << Utils::FilePath::fromString(TESTS_DIR "/qMake/TwoSubPlugins/TwoSubPlugins.pro") << 2;
+}
+
+void DiscoveryBenchmarkTest::benchmarkQMakeAvailableCreators(void)
+{
+    QFETCH(Utils::FilePath, projectPath);
+    QFETCH(int, pluginCount);
+
+    benchmarkAvailableCreators< Internal::QMakeQtcRunConfigurationFactory<Internal::QtcTestRunConfiguration> >(projectPath, pluginCount, Utils::FilePath());
+}
+
+void DiscoveryBenchmarkTest::scalingData(void)
+{
+    QTest::addColumn<int>("plugins");
+    QTest::addColumn<int>("libraries");
+    QTest::addColumn<int>("depth");
+    QTest::addColumn<int>("sourcesPerTarget");
+
+    QTest::newRow("1 plugin") << 1 << 0 << 1 << 1;
+    QTest::newRow("10 plugins") << 10 << 0 << 1 << 1;
+    QTest::newRow("100 plugins") << 100 << 0 << 1 << 1;
+    QTest::newRow("10 plugins, 90 libraries") << 10 << 90 << 1 << 1;
+    QTest::newRow("100 plugins, depth 4") << 100 << 0 << 4 << 1;
+    QTest::newRow("100 plugins, 10 sources") << 100 << 0 << 1 << 10;
+}
+
+void DiscoveryBenchmarkTest::benchmarkCMakeScaling_data(void)
+{
+    scalingData();
+}
+
+void DiscoveryBenchmarkTest::benchmarkCMakeScaling(void)
+{
+    QFETCH(int, plugins);
+    QFETCH(int, libraries);
+    QFETCH(int, depth);
+    QFETCH(int, sourcesPerTarget);
+
+    mProjectDir = std::make_unique<QTemporaryDir>();
+    QVERIFY(mProjectDir->isValid());
+    Utils::FilePath rootPath = Utils::FilePath::fromString(mProjectDir->path());
+
+    SyntheticProject project({.plugins = plugins, .libraries = libraries, .depth = depth, .sourcesPerTarget = sourcesPerTarget});
+    Utils::Result<Utils::FilePath> projectPath = project.generateCMake(rootPath);
+    QVERIFY2(projectPath, qPrintable(projectPath.error()));
+
+    benchmarkAvailableCreators< Internal::CMakeQtcRunConfigurationFactory<Internal::QtcTestRunConfiguration> >(*projectPath, plugins, SyntheticProject::cMakeBuildPath(rootPath));
+}
+
+void DiscoveryBenchmarkTest::benchmarkQMakeScaling_data(void)
+{
+    scalingData();
+}
+
+void DiscoveryBenchmarkTest::benchmarkQMakeScaling(void)
+{
+    QFETCH(int, plugins);
+    QFETCH(int, libraries);
+    QFETCH(int, depth);
+    QFETCH(int, sourcesPerTarget);
+
+    mProjectDir = std::make_unique<QTemporaryDir>();
+    QVERIFY(mProjectDir->isValid());
+    Utils::FilePath rootPath = Utils::FilePath::fromString(mProjectDir->path());
+
+    SyntheticProject project({.plugins = plugins, .libraries = libraries, .depth = depth, .sourcesPerTarget = sourcesPerTarget});
+    Utils::Result<Utils::FilePath> projectPath = project.generateQMake(rootPath);
+    QVERIFY2(projectPath, qPrintable(projectPath.error()));
+
+    benchmarkAvailableCreators< Internal::QMakeQtcRunConfigurationFactory<Internal::QtcTestRunConfiguration> >(*projectPath, plugins, Utils::FilePath());
+}
+
+void DiscoveryBenchmarkTest::testCMakeLinearity(void)
+{
+    checkLinearity< Internal::CMakeQtcRunConfigurationFactory<Internal::QtcTestRunConfiguration> >(true);
+}
+
+void DiscoveryBenchmarkTest::testQMakeLinearity(void)
+{
+    checkLinearity< Internal::QMakeQtcRunConfigurationFactory<Internal::QtcTestRunConfiguration> >(false);
+}
+
+void DiscoveryBenchmarkTest::openProject(const Utils::FilePath& projectPath, const Utils::FilePath& buildPath)
+{
+    QVERIFY(openQMakeProject(projectPath, &mProject));
+    QVERIFY(mProject->activeBuildConfiguration() != nullptr);
+
+    // NOTE Use the pre-generated CMake file-API reply, so that discovery does not depend on CMake configuration.
+    if (!buildPath.isEmpty()) {
+        QSignalSpy parsedSpy(mProject->activeBuildConfiguration()->buildSystem(), &ProjectExplorer::BuildSystem::parsingFinished);
+        mProject->activeBuildConfiguration()->setBuildDirectory(buildPath);
+        QVERIFY2((parsedSpy.count() > 0) || parsedSpy.wait(), "Project parsing takes too long");
+    }
+}
+
+template<class Factory>
+void DiscoveryBenchmarkTest::benchmarkAvailableCreators(const Utils::FilePath& projectPath, int pluginCount, const Utils::FilePath& buildPath)
+{
+    openProject(projectPath, buildPath);
+    if (QTest::currentTestFailed())
+        return;
+
+    // NOTE The factory registered by the plugin cannot be retrieved, so another one is created.
+    Factory factory;
+    QList<ProjectExplorer::RunConfigurationCreationInfo> creators;
+    QBENCHMARK {
+        creators = factory.availableCreators(mProject->activeBuildConfiguration());
+    }
+    QCOMPARE(creators.size(), pluginCount);
+}
+
+template<class Factory>
+qint64 DiscoveryBenchmarkTest::availableCreatorsTime(int pluginCount)
+{
+    Factory factory;
+    QList<qint64> times;
+    QList<ProjectExplorer::RunConfigurationCreationInfo> creators;
+    for (int r = 0; r < LinearityRuns; r++) {
+        QElapsedTimer timer;
+        timer.start();
+        creators = factory.availableCreators(mProject->activeBuildConfiguration());
+        times << timer.nsecsElapsed();
+    }
+    if (creators.size() != pluginCount)
+        return -1;
+
+    std::sort(times.begin(), times.end());
+    return times.at(LinearityRuns / 2);
+}
+
+template<class Factory>
+void DiscoveryBenchmarkTest::checkLinearity(bool cMake)
+{
+    QMap<int, qint64> times;
+
+    for (int plugins : {10, 100}) {
+        mProjectDir = std::make_unique<QTemporaryDir>();
+        QVERIFY(mProjectDir->isValid());
+        Utils::FilePath rootPath = Utils::FilePath::fromString(mProjectDir->path());
+
+        SyntheticProject project({.plugins = plugins});
+        Utils::Result<Utils::FilePath> projectPath = cMake ? project.generateCMake(rootPath) : project.generateQMake(rootPath);
+        QVERIFY2(projectPath, qPrintable(projectPath.error()));
+
+        openProject(*projectPath, cMake ? SyntheticProject::cMakeBuildPath(rootPath) : Utils::FilePath());
+        if (QTest::currentTestFailed())
+            return;
+        times.insert(plugins, availableCreatorsTime<Factory>(plugins));
+        QVERIFY2(times.value(plugins) >= 0, qPrintable(QString(QLatin1String("Not all the %1 plugins were discovered")).arg(plugins)));
+        releaseProject();
+        if (QTest::currentTestFailed())
+            return;
+    }
+
+    // NOTE Discovering ten times more plugins should take about ten times longer.
+    double ratio = (double) times.value(100) / std::max<qint64>(times.value(10), 1);
+    QVERIFY2(ratio < MaxScalingRatio, qPrintable(QString(QLatin1String("Discovery does not scale linearly (%1 ns for 10 plugins, %2 ns for 100 plugins, ratio: %3)"))
+                                                  .arg(times.value(10)).arg(times.value(100)).arg(ratio)));
+}
+
+} // Test
+} // QtcDevPlugin
@@ -0,0 +1,79 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef DISCOVERYBENCHMARKTEST_H
+#define DISCOVERYBENCHMARKTEST_H
+
+#include <QObject>
+#include <QTemporaryDir>
+
+#include <memory>
+
+namespace ProjectExplorer {
+    class Project;
+}
+
+namespace Utils {
+    class FilePath;
+}
+
+namespace QtcDevPlugin {
+namespace Test {
+
+class DiscoveryBenchmarkTest : public QObject
+{
+    Q_OBJECT
+public:
+    inline DiscoveryBenchmarkTest(QObject* parent = nullptr) :
+        QObject(parent) {mProject = nullptr;}
+private Q_SLOTS:
+    inline void init(void) {mProject = nullptr;}
+    void initTestCase(void);
+    void benchmarkCMakeAvailableCreators_data(void);
+    void benchmarkCMakeAvailableCreators(void);
+    void benchmarkQMakeAvailableCreators_data(void);
+    void benchmarkQMakeAvailableCreators(void);
+    void benchmarkCMakeScaling_data(void);
+    void benchmarkCMakeScaling(void);
+    void benchmarkQMakeScaling_data(void);
+    void benchmarkQMakeScaling(void);
+    void testCMakeLinearity(void);
+    void testQMakeLinearity(void);
+    void cleanup(void);
+private:
+    ProjectExplorer::Project* mProject;
+    std::unique_ptr<QTemporaryDir> mProjectDir;
+
+    void scalingData(void);
+    void releaseProject(void);
+    void openProject(const Utils::FilePath& projectPath, const Utils::FilePath& buildPath);
+    template<class Factory>
+    void benchmarkAvailableCreators(const Utils::FilePath& projectPath, int pluginCount, const Utils::FilePath& buildPath);
+    template<class Factory>
+    qint64 availableCreatorsTime(int pluginCount);
+    template<class Factory>
+    void checkLinearity(bool cMake);
+
+    static const int LinearityRuns = 11;            /*!< Number of runs whose median time is compared */
+    static constexpr double MaxScalingRatio = 30.;  /*!< Maximum time ratio for ten times more plugins (a quadratic discovery gives about 100) */
+};
+
+} // Test
+} // QtcDevPlugin
+
+#endif // DISCOVERYBENCHMARKTEST_H
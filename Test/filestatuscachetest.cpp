@@ -0,0 +1,158 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "filestatuscachetest.h"
+
+#include "../Widgets/filestatuscache.h"
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void FileStatusCacheTest::init(void)
+{
+    Widgets::FileStatusCache::clear();
+}
+
+void FileStatusCacheTest::testStatus(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString filePath = dir.filePath(QLatin1String("file.txt"));
+    QFile file(filePath);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.close();
+
+    Widgets::FileStatusCache::Status dirStatus = Widgets::FileStatusCache::status(dir.path());
+    QVERIFY(dirStatus.exists);
+    QVERIFY(dirStatus.isDir);
+    QVERIFY(!dirStatus.isFile);
+
+    Widgets::FileStatusCache::Status fileStatus = Widgets::FileStatusCache::status(filePath, Widgets::FileStatusCache::ReadPermission | Widgets::FileStatusCache::WritePermission);
+    QVERIFY(fileStatus.exists);
+    QVERIFY(fileStatus.isFile);
+    QVERIFY(!fileStatus.isDir);
+    QVERIFY(fileStatus.isReadable);
+    QVERIFY(fileStatus.isWritable);
+
+    Widgets::FileStatusCache::Status missingStatus = Widgets::FileStatusCache::status(dir.filePath(QLatin1String("missing")));
+    QVERIFY(!missingStatus.exists);
+    QVERIFY(!missingStatus.isFile);
+    QVERIFY(!missingStatus.isDir);
+}
+
+void FileStatusCacheTest::testPermissions(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString filePath = dir.filePath(QLatin1String("file.txt"));
+    QFile file(filePath);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.close();
+
+    // NOTE Only the requested permissions are checked.
+    Widgets::FileStatusCache::Status status = Widgets::FileStatusCache::status(filePath);
+    QVERIFY(status.exists);
+    QCOMPARE(status.checked, Widgets::FileStatusCache::Permissions());
+    QVERIFY(!status.isReadable);
+    QVERIFY(!status.isWritable);
+
+    status = Widgets::FileStatusCache::status(filePath, Widgets::FileStatusCache::ReadPermission);
+    QCOMPARE(status.checked, Widgets::FileStatusCache::Permissions(Widgets::FileStatusCache::ReadPermission));
+    QVERIFY(status.isReadable);
+    QVERIFY(!status.isWritable);
+
+    // NOTE The permissions which were checked are kept in the cache.
+    status = Widgets::FileStatusCache::status(filePath, Widgets::FileStatusCache::WritePermission);
+    QCOMPARE(status.checked, Widgets::FileStatusCache::ReadPermission | Widgets::FileStatusCache::WritePermission);
+    QVERIFY(status.isReadable);
+    QVERIFY(status.isWritable);
+
+    QVERIFY(file.setPermissions(QFileDevice::WriteOwner));
+    status = Widgets::FileStatusCache::status(filePath, Widgets::FileStatusCache::ReadPermission);
+    QVERIFY(status.isReadable);
+}
+
+void FileStatusCacheTest::testCache(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString path = dir.filePath(QLatin1String("created"));
+
+    // NOTE The status is not queried again while it is cached.
+    QVERIFY(!Widgets::FileStatusCache::status(path).exists);
+    QVERIFY(QDir(dir.path()).mkdir(QLatin1String("created")));
+    QVERIFY(!Widgets::FileStatusCache::status(path).exists);
+}
+
+void FileStatusCacheTest::testExpiry(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString path = dir.filePath(QLatin1String("created"));
+
+    QVERIFY(!Widgets::FileStatusCache::status(path).exists);
+    QVERIFY(QDir(dir.path()).mkdir(QLatin1String("created")));
+    QTest::qWait(Widgets::FileStatusCache::TimeToLive + 100);
+    QVERIFY(Widgets::FileStatusCache::status(path).exists);
+}
+
+void FileStatusCacheTest::testClear(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString path = dir.filePath(QLatin1String("created"));
+
+    QVERIFY(!Widgets::FileStatusCache::status(path).exists);
+    QVERIFY(QDir(dir.path()).mkdir(QLatin1String("created")));
+    Widgets::FileStatusCache::clear();
+    QVERIFY(Widgets::FileStatusCache::status(path).exists);
+}
+
+void FileStatusCacheTest::testAncestors(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString missingPath = dir.filePath(QLatin1String("missing"));
+    QString filePath = dir.filePath(QLatin1String("file.txt"));
+    QFile file(filePath);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    file.close();
+
+    // NOTE Paths under a missing ancestor or a file are known not to exist without querying the file system.
+    QVERIFY(!Widgets::FileStatusCache::status(missingPath).exists);
+    QVERIFY(QDir(dir.path()).mkpath(QLatin1String("missing/child/grandchild")));
+    QVERIFY(!Widgets::FileStatusCache::status(missingPath + QLatin1String("/child")).exists);
+    QVERIFY(!Widgets::FileStatusCache::status(missingPath + QLatin1String("/child/grandchild/")).exists);
+
+    QVERIFY(Widgets::FileStatusCache::status(filePath).isFile);
+    QVERIFY(!Widgets::FileStatusCache::status(filePath + QLatin1String("/child")).exists);
+
+    // NOTE Existing directories do not tell anything about their contents.
+    QVERIFY(Widgets::FileStatusCache::status(dir.path()).isDir);
+    QVERIFY(!Widgets::FileStatusCache::status(dir.filePath(QLatin1String("other"))).exists);
+    QVERIFY(QDir(dir.path()).mkdir(QLatin1String("created")));
+    QVERIFY(Widgets::FileStatusCache::status(dir.filePath(QLatin1String("created"))).exists);
+
+    Widgets::FileStatusCache::clear();
+    QVERIFY(Widgets::FileStatusCache::status(missingPath + QLatin1String("/child")).exists);
+}
+
+} // Test
+} // QtcDevPlugin
@@ -0,0 +1,196 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "heapprofilertest.h"
+
+#include "../heapprofiler.h"
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+QByteArray HeapProfilerTest::printOutput(void)
+{
+    return QByteArray(
+        "reading file \"heaptrack-20261019-101500.1234.zst\" - please wait, this might take some time...\n"
+        "Debuggee command was: /opt/qtcreator/bin/qtcreator -pluginpath /build/lib/qtcreator/plugins\n"
+        "finished reading file, now analyzing data:\n"
+        "\n"
+        "MOST CALLS TO ALLOCATION FUNCTIONS\n"
+        "300 calls to allocation functions with 1.20M peak consumption from\n"
+        "  QArrayData::allocate(long long, long long, QArrayData::AllocationOption)\n"
+        "    in /usr/lib/libQt6Core.so.6\n"
+        "  MyPlugin::Model::index(int, int) const\n"
+        "    at /src/model.cpp:42\n"
+        "    in /build/lib/qtcreator/plugins/libMyPlugin.so\n"
+        "  MyPlugin::Model::reset()\n"
+        "    at /src/model.cpp:12\n"
+        "    in /build/lib/qtcreator/plugins/libMyPlugin.so\n"
+        "\n"
+        "200 calls to allocation functions with 500B peak consumption from\n"
+        "  QArrayData::allocate(long long, long long, QArrayData::AllocationOption)\n"
+        "    in /usr/lib/libQt6Core.so.6\n"
+        "  main\n"
+        "    in /opt/qtcreator/bin/qtcreator\n"
+        "\n"
+        "100 calls to allocation functions with 0B peak consumption from\n"
+        "  operator new(unsigned long)\n"
+        "    in /usr/lib/libstdc++.so.6\n"
+        "  MyPlugin::Model::reset()\n"
+        "    at /src/model.cpp:14\n"
+        "    in /build/lib/qtcreator/plugins/libMyPlugin.so\n"
+        "\n"
+        "PEAK MEMORY CONSUMERS\n"
+        "1.20M peak memory consumed over 300 calls from\n"
+        "  QArrayData::allocate(long long, long long, QArrayData::AllocationOption)\n"
+        "    in /usr/lib/libQt6Core.so.6\n"
+        "  MyPlugin::Model::index(int, int) const\n"
+        "    at /src/model.cpp:42\n"
+        "    in /build/lib/qtcreator/plugins/libMyPlugin.so\n"
+        "\n"
+        "500B peak memory consumed over 200 calls from\n"
+        "  QArrayData::allocate(long long, long long, QArrayData::AllocationOption)\n"
+        "    in /usr/lib/libQt6Core.so.6\n"
+        "  main\n"
+        "    in /opt/qtcreator/bin/qtcreator\n"
+        "\n"
+        "MEMORY LEAKS\n"
+        "2.50K leaked over 10 calls from\n"
+        "  operator new(unsigned long)\n"
+        "    in /usr/lib/libstdc++.so.6\n"
+        "  MyPlugin::Model::reset()\n"
+        "    at /src/model.cpp:14\n"
+        "    in /build/lib/qtcreator/plugins/libMyPlugin.so\n"
+        "\n"
+        "MOST TEMPORARY ALLOCATIONS\n"
+        "90 temporary allocations of 100 allocations in total (90.00%) from\n"
+        "  operator new(unsigned long)\n"
+        "    in /usr/lib/libstdc++.so.6\n"
+        "  MyPlugin::Model::reset()\n"
+        "    at /src/model.cpp:14\n"
+        "    in /build/lib/qtcreator/plugins/libMyPlugin.so\n"
+        "\n"
+        "total runtime: 12.50s.\n"
+        "calls to allocation functions: 600 (48/s)\n"
+        "temporary memory allocations: 120 (9/s)\n"
+        "peak heap memory consumption: 2.00M\n"
+        "peak RSS (including heaptrack overhead): 150.00M\n"
+        "total memory leaked: 5.00K\n"
+    );
+}
+
+void HeapProfilerTest::testParseBytes_data(void)
+{
+    QTest::addColumn<QString>("size");
+    QTest::addColumn<qint64>("bytes");
+
+    QTest::newRow("Bytes") << "512B" << (qint64) 512;
+    QTest::newRow("Kilo") << "1.50K" << (qint64) 1500;
+    QTest::newRow("Mega") << "2.30M" << (qint64) 2300000;
+    QTest::newRow("Giga") << "1.00G" << (qint64) 1000000000;
+    QTest::newRow("KiloBytes") << "4.00KB" << (qint64) 4000;
+    QTest::newRow("Invalid") << "many" << (qint64) -1;
+}
+
+void HeapProfilerTest::testParseBytes(void)
+{
+    QFETCH(QString, size);
+    QFETCH(qint64, bytes);
+
+    QCOMPARE(Internal::HeapProfiler::parseBytes(size), bytes);
+}
+
+void HeapProfilerTest::testCosts(void)
+{
+    Internal::HeapProfiler profiler(QStringList() << QLatin1String("libMyPlugin.so"));
+    profiler.addOutput(printOutput());
+    profiler.finish();
+
+    Internal::HeapProfiler::Costs total = profiler.totalCosts();
+    QCOMPARE(total.calls, (qint64) 600);
+    QCOMPARE(total.temporary, (qint64) 120);
+    QCOMPARE(total.peak, (qint64) 2000000);
+    QCOMPARE(total.leaked, (qint64) 5000);
+
+    Internal::HeapProfiler::Costs plugin = profiler.pluginCosts();
+    QCOMPARE(plugin.calls, (qint64) 400);
+    QCOMPARE(plugin.temporary, (qint64) 90);
+    QCOMPARE(plugin.peak, (qint64) 1200000);
+    QCOMPARE(plugin.leaked, (qint64) 2500);
+
+    QMap<QString, Internal::HeapProfiler::Costs> sites = profiler.siteCosts();
+    QCOMPARE(sites.size(), 2);
+
+    // NOTE Costs are attributed to the innermost function of the plugin.
+    Internal::HeapProfiler::Costs index = sites.value(QLatin1String("MyPlugin::Model::index(int, int) const"));
+    QCOMPARE(index.calls, (qint64) 300);
+    QCOMPARE(index.temporary, (qint64) 0);
+    QCOMPARE(index.peak, (qint64) 1200000);
+    QCOMPARE(index.leaked, (qint64) 0);
+
+    Internal::HeapProfiler::Costs reset = sites.value(QLatin1String("MyPlugin::Model::reset()"));
+    QCOMPARE(reset.calls, (qint64) 100);
+    QCOMPARE(reset.temporary, (qint64) 90);
+    QCOMPARE(reset.peak, (qint64) 0);
+    QCOMPARE(reset.leaked, (qint64) 2500);
+}
+
+void HeapProfilerTest::testChunks(void)
+{
+    Internal::HeapProfiler reference(QStringList() << QLatin1String("libMyPlugin.so"));
+    reference.addOutput(printOutput());
+    reference.finish();
+
+    Internal::HeapProfiler profiler(QStringList() << QLatin1String("libMyPlugin.so"));
+    QByteArray output = printOutput();
+    for (int i = 0; i < output.size(); i += 11)
+        profiler.addOutput(output.mid(i, 11));
+    profiler.finish();
+
+    QCOMPARE(profiler.pluginCosts().calls, reference.pluginCosts().calls);
+    QCOMPARE(profiler.pluginCosts().peak, reference.pluginCosts().peak);
+    QCOMPARE(profiler.totalCosts().leaked, reference.totalCosts().leaked);
+    QCOMPARE(profiler.siteCosts().keys(), reference.siteCosts().keys());
+}
+
+void HeapProfilerTest::testReport(void)
+{
+    Internal::HeapProfiler profiler(QStringList() << QLatin1String("libMyPlugin.so"));
+    profiler.addOutput(printOutput());
+    profiler.finish();
+
+    QStringList report = profiler.report();
+    QCOMPARE(report.size(), 7);
+    QVERIFY2(report.at(0).contains(QLatin1String("400 of 600 (66.7%)")), qPrintable(report.at(0)));
+    QVERIFY2(report.at(1).contains(QLatin1String("90 of 120 (75.0%)")), qPrintable(report.at(1)));
+    QVERIFY2(report.at(2).contains(QLatin1String("(60.0%)")), qPrintable(report.at(2)));
+    QVERIFY2(report.at(3).contains(QLatin1String("(50.0%)")), qPrintable(report.at(3)));
+    QVERIFY2(report.at(5).endsWith(QLatin1String("MyPlugin::Model::index(int, int) const")), qPrintable(report.at(5)));
+    QVERIFY2(report.at(6).endsWith(QLatin1String("MyPlugin::Model::reset()")), qPrintable(report.at(6)));
+
+    QCOMPARE(profiler.report(1).size(), 6);
+
+    Internal::HeapProfiler otherProfiler(QStringList() << QLatin1String("libOtherPlugin.so"));
+    otherProfiler.addOutput(printOutput());
+    otherProfiler.finish();
+    QCOMPARE(otherProfiler.report().size(), 4);
+}
+
+} // Test
+} // QtcDevPlugin
@@ -0,0 +1,124 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "launchpreparationtest.h"
+#include "testhelper.h"
+
+#include "../qtcdevpluginconstants.h"
+#include "../qtcrunconfiguration.h"
+
+#include <coreplugin/actionmanager/actionmanager.h>
+#include <coreplugin/actionmanager/command.h>
+
+#include <projectexplorer/buildconfiguration.h>
+#include <projectexplorer/buildmanager.h>
+#include <projectexplorer/projectexplorerconstants.h>
+#include <projectexplorer/projectexplorer.h>
+#include <projectexplorer/project.h>
+#include <projectexplorer/projectmanager.h>
+#include <projectexplorer/runcontrol.h>
+
+#include <utils/algorithm.h>
+
+#include <QtTest>
+#include <QAction>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void LaunchPreparationTest::initTestCase(void)
+{
+    Utils::FilePath projectPath(TESTS_DIR "/cMake/QtcPluginTest");
+
+    QVERIFY(removeProjectUserFiles(projectPath.absolutePath()));
+    QVERIFY(openQMakeProject(projectPath.pathAppended("CMakeLists.txt"), &mProject));
+    QVERIFY(mProject->activeBuildConfiguration() != nullptr);
+
+    // NOTE The run action runs the active run configuration of the startup project.
+    ProjectExplorer::ProjectManager::setStartupProject(mProject);
+    QVERIFY(testRunConfiguration() != nullptr);
+    mProject->activeBuildConfiguration()->setActiveRunConfiguration(testRunConfiguration());
+}
+
+Internal::QtcRunConfiguration* LaunchPreparationTest::testRunConfiguration(void) const
+{
+    return qobject_cast<Internal::QtcRunConfiguration*>(Utils::findOrDefault(mProject->activeBuildConfiguration()->runConfigurations(), [] (ProjectExplorer::RunConfiguration* rc) {
+        return rc->id() == Utils::Id(Constants::QtcTestRunConfigurationId);
+    }));
+}
+
+void LaunchPreparationTest::testBuildOnly(void)
+{
+    Internal::QtcRunConfiguration* runConfig = testRunConfiguration();
+    QVERIFY(!runConfig->isLaunchPrepared());
+
+    // NOTE A build which is not followed by a run is not prepared for.
+    QSignalSpy buildQueueFinishedSpy(ProjectExplorer::BuildManager::instance(), SIGNAL(buildQueueFinished(bool)));
+    ProjectExplorer::BuildManager::buildProjectWithDependencies(mProject);
+    if (!ProjectExplorer::BuildManager::isBuilding(mProject))
+        QSKIP("The project could not be built");
+    QVERIFY(!runConfig->isLaunchPrepared());
+
+    QVERIFY2(buildQueueFinishedSpy.wait(120000) || !buildQueueFinishedSpy.isEmpty(), "Project takes too long to build");
+    QCoreApplication::processEvents();
+    QVERIFY(!runConfig->isLaunchPrepared());
+}
+
+void LaunchPreparationTest::testRun(void)
+{
+    Internal::QtcRunConfiguration* runConfig = testRunConfiguration();
+    Core::Command* runCommand = Core::ActionManager::command(Utils::Id(ProjectExplorer::Constants::RUN));
+    QVERIFY(runCommand != nullptr);
+
+    /* NOTE ProjectExplorer starts the run when the build queue is finished (it connected first),
+     * hence the run control has taken the runnable when this connection is called. */
+    bool preparedAtLaunch = false;
+    QMetaObject::Connection connection = connect(ProjectExplorer::BuildManager::instance(), &ProjectExplorer::BuildManager::buildQueueFinished, this, [runConfig, &preparedAtLaunch] () {
+        preparedAtLaunch = runConfig->isLaunchPrepared();
+    });
+    QSignalSpy runControlStartedSpy(ProjectExplorer::ProjectExplorerPlugin::instance(),
+                                    SIGNAL(runControlStarted(ProjectExplorer::RunControl*)));
+
+    runCommand->action()->trigger();
+    if (!ProjectExplorer::BuildManager::isBuilding(mProject)) {
+        disconnect(connection);
+        QSKIP("The run does not wait for a build");
+    }
+    QVERIFY(runConfig->isLaunchPrepared());
+
+    QVERIFY2(runControlStartedSpy.wait(120000) || !runControlStartedSpy.isEmpty(), "Project takes too long to start");
+    disconnect(connection);
+    ProjectExplorer::RunControl* runControl = runControlStartedSpy.at(0).at(0).value<ProjectExplorer::RunControl*>();
+
+    // NOTE The prepared runnable was used by the run control, then discarded.
+    QVERIFY(preparedAtLaunch);
+    QTRY_VERIFY(!runConfig->isLaunchPrepared());
+
+    QSignalSpy runControlStoppedSpy(runControl, SIGNAL(stopped()));
+    runControl->initiateStop();
+    QVERIFY2(runControlStoppedSpy.wait(15000) || runControl->isStopped(), "Run control takes too long to stop");
+}
+
+void LaunchPreparationTest::cleanupTestCase(void)
+{
+    if (mProject != nullptr)
+        QVERIFY(closeProject(mProject));
+}
+
+} // Test
+} // QtcDevPlugin
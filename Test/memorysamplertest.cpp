@@ -0,0 +1,140 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "memorysamplertest.h"
+
+#include "../memorysampler.h"
+
+#include <utils/hostosinfo.h>
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void MemorySamplerTest::testParse(void)
+{
+    QString smapsRollup(QLatin1String(
+        "55d5e0a00000-7ffd2b3fe000 ---p 00000000 00:00 0                          [rollup]\n"
+        "Rss:              245760 kB\n"
+        "Pss:              198144 kB\n"
+        "Pss_Dirty:        120000 kB\n"
+        "Pss_Anon:         110000 kB\n"
+        "Shared_Clean:      60000 kB\n"
+        "Private_Dirty:    120000 kB\n"
+        "Anonymous:        131072 kB\n"
+        "Swap:                  0 kB\n"
+    ));
+
+    Internal::MemorySampler::Sample sample = Internal::MemorySampler::parse(smapsRollup);
+    QCOMPARE(sample.rss, (qint64) 245760);
+    QCOMPARE(sample.pss, (qint64) 198144);
+    QCOMPARE(sample.anonymous, (qint64) 131072);
+
+    sample = Internal::MemorySampler::parse(QLatin1String("Rss: 12 kB\n"));
+    QCOMPARE(sample.rss, (qint64) 12);
+    QCOMPARE(sample.pss, (qint64) -1);
+    QCOMPARE(sample.anonymous, (qint64) -1);
+}
+
+void MemorySamplerTest::testRead(void)
+{
+    if (!Utils::HostOsInfo::isLinuxHost())
+        QSKIP("smaps_rollup is only available on Linux");
+
+    Internal::MemorySampler::Sample sample = Internal::MemorySampler::read(QCoreApplication::applicationPid());
+    QVERIFY(sample.rss > 0);
+    QVERIFY(sample.pss > 0);
+    QVERIFY(sample.anonymous > 0);
+
+    sample = Internal::MemorySampler::read(-1);
+    QVERIFY(sample.rss < 0);
+}
+
+void MemorySamplerTest::testFunctions(void)
+{
+    Internal::MemorySampler sampler(nullptr, 100);
+
+    sampler.addSample({1000, 800, 500});
+    sampler.handleLine(QLatin1String("PASS   : MyPlugin::Test::ModelTest::initTestCase()"));
+    sampler.addSample({1500, 1200, 900});
+    sampler.addSample({1300, 1000, 700});
+    sampler.handleLine(QLatin1String("PASS   : MyPlugin::Test::ModelTest::testIndex(first)"));
+    sampler.addSample({1400, 1100, 800});
+    sampler.handleLine(QLatin1String("FAIL!  : MyPlugin::Test::ModelTest::testIndex(second) 'ok' returned FALSE. ()"));
+    sampler.handleLine(QLatin1String("QDEBUG : MyPlugin::Test::ModelTest::testReset() Resetting"));
+    sampler.addSample({1200, 900, 600});
+    sampler.handleLine(QLatin1String("SKIP   : MyPlugin::Test::ModelTest::testReset() Not supported"));
+
+    Internal::MemorySampler::Sample peak = sampler.peak();
+    QCOMPARE(peak.rss, (qint64) 1500);
+    QCOMPARE(peak.pss, (qint64) 1200);
+    QCOMPARE(peak.anonymous, (qint64) 900);
+
+    QMap<QString, Internal::MemorySampler::FunctionMemory> functions = sampler.functions();
+    QCOMPARE(functions.size(), 3);
+    QCOMPARE(functions.value(QLatin1String("MyPlugin::Test::ModelTest::initTestCase")).peakRss, (qint64) 1000);
+    QCOMPARE(functions.value(QLatin1String("MyPlugin::Test::ModelTest::initTestCase")).growth, (qint64) 0);
+    QCOMPARE(functions.value(QLatin1String("MyPlugin::Test::ModelTest::testIndex")).peakRss, (qint64) 1500);
+    QCOMPARE(functions.value(QLatin1String("MyPlugin::Test::ModelTest::testIndex")).growth, (qint64) 400);
+    QCOMPARE(functions.value(QLatin1String("MyPlugin::Test::ModelTest::testReset")).peakRss, (qint64) 1400);
+    QCOMPARE(functions.value(QLatin1String("MyPlugin::Test::ModelTest::testReset")).growth, (qint64) -200);
+}
+
+void MemorySamplerTest::testStart(void)
+{
+    Internal::MemorySampler sampler(nullptr, 100);
+
+    // NOTE Qt Creator startup is not attributed to initTestCase().
+    sampler.addSample({1000, 800, 500});
+    sampler.addSample({5000, 4000, 3000});
+    sampler.handleLine(QLatin1String("********* Start testing of MyPlugin::Test::ModelTest *********"));
+    sampler.addSample({5200, 4100, 3100});
+    sampler.handleLine(QLatin1String("PASS   : MyPlugin::Test::ModelTest::initTestCase()"));
+
+    QMap<QString, Internal::MemorySampler::FunctionMemory> functions = sampler.functions();
+    QCOMPARE(functions.size(), 1);
+    QCOMPARE(functions.value(QLatin1String("MyPlugin::Test::ModelTest::initTestCase")).peakRss, (qint64) 5200);
+    QCOMPARE(functions.value(QLatin1String("MyPlugin::Test::ModelTest::initTestCase")).growth, (qint64) 200);
+    QCOMPARE(sampler.peak().rss, (qint64) 5200);
+}
+
+void MemorySamplerTest::testReport(void)
+{
+    Internal::MemorySampler emptySampler(nullptr, 100);
+    QCOMPARE(emptySampler.report().size(), 1);
+
+    Internal::MemorySampler sampler(nullptr, 100);
+    sampler.addSample({1000, 800, 500});
+    sampler.addSample({3000, 2000, 1000});
+    sampler.handleLine(QLatin1String("PASS   : MyPlugin::Test::ModelTest::testIndex()"));
+    sampler.addSample({4000, 3000, 2000});
+    sampler.handleLine(QLatin1String("PASS   : MyPlugin::Test::ModelTest::testReset()"));
+    sampler.addSample({3500, 3000, 2000});
+    sampler.handleLine(QLatin1String("PASS   : MyPlugin::Test::ModelTest::cleanupTestCase()"));
+
+    QStringList report = sampler.report();
+    QCOMPARE(report.size(), 4);
+    QVERIFY2(report.at(2).contains(QLatin1String("MyPlugin::Test::ModelTest::testIndex")), qPrintable(report.at(2)));
+    QVERIFY2(report.at(3).contains(QLatin1String("MyPlugin::Test::ModelTest::testReset")), qPrintable(report.at(3)));
+
+    QCOMPARE(sampler.report(1).size(), 3);
+}
+
+} // Test
+} // QtcDevPlugin
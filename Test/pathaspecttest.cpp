@@ -0,0 +1,160 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "pathaspecttest.h"
+
+#include "../pathaspect.h"
+#include "../Widgets/filetypevalidatinglineedit.h"
+
+#include <utils/aspects.h>
+#include <utils/layoutbuilder.h>
+#include <utils/macroexpander.h>
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void PathAspectTest::testValidation(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    Widgets::FileTypeValidatingLineEdit edit;
+    edit.setAcceptFlags(Widgets::FileTypeValidatingLineEdit::Accepts(Widgets::FileTypeValidatingLineEdit::AcceptsDirectories));
+    edit.setValidationDelay(10);
+    QSignalSpy validatedSpy(&edit, &Widgets::FileTypeValidatingLineEdit::validated);
+
+    // NOTE The path is not valid until it has been validated in the worker thread.
+    edit.setText(dir.path());
+    QVERIFY(edit.isValidating());
+    QVERIFY(!edit.isValid());
+    QTRY_COMPARE(validatedSpy.size(), 1);
+    QCOMPARE(validatedSpy.at(0).at(0).toBool(), true);
+    QVERIFY(!edit.isValidating());
+    QVERIFY(edit.isValid());
+
+    edit.setText(QDir(dir.path()).filePath(QLatin1String("missing")));
+    QTRY_COMPARE(validatedSpy.size(), 2);
+    QCOMPARE(validatedSpy.at(1).at(0).toBool(), false);
+    QVERIFY(!edit.isValid());
+}
+
+void PathAspectTest::testStaleValidation(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    Widgets::FileTypeValidatingLineEdit edit;
+    edit.setAcceptFlags(Widgets::FileTypeValidatingLineEdit::Accepts(Widgets::FileTypeValidatingLineEdit::AcceptsDirectories));
+    edit.setValidationDelay(10);
+    QSignalSpy validatedSpy(&edit, &Widgets::FileTypeValidatingLineEdit::validated);
+
+    // NOTE Only the result for the last text is delivered.
+    edit.setText(QDir(dir.path()).filePath(QLatin1String("missing")));
+    edit.setText(dir.path());
+    QTRY_COMPARE(validatedSpy.size(), 1);
+    QCOMPARE(validatedSpy.at(0).at(0).toBool(), true);
+    QVERIFY(edit.isValid());
+}
+
+static Widgets::FileTypeValidatingLineEdit* createEdit(Internal::PathAspect& aspect, std::unique_ptr<QWidget>& widget)
+{
+    aspect.setAcceptDirectories(true);
+    aspect.setAcceptFiles(false);
+    aspect.setMacroExpanderProvider([] {return Utils::globalMacroExpander();});
+
+    Layouting::Form form;
+    aspect.addToLayout(form);
+    widget.reset(form.emerge());
+
+    Widgets::FileTypeValidatingLineEdit* edit = widget->findChild<Widgets::FileTypeValidatingLineEdit*>();
+    if (edit != nullptr)
+        edit->setValidationDelay(10);
+    return edit;
+}
+
+void PathAspectTest::testValidPath(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    Utils::AspectContainer container;
+    Internal::PathAspect aspect(&container);
+    aspect.setValue(Utils::FilePath::fromString(QDir::tempPath()));
+    std::unique_ptr<QWidget> widget;
+    Widgets::FileTypeValidatingLineEdit* edit = createEdit(aspect, widget);
+    QVERIFY(edit != nullptr);
+
+    // NOTE Editing finishes before the path is validated.
+    edit->setText(dir.path());
+    QVERIFY(edit->isValidating());
+    emit edit->editingFinished();
+    QCOMPARE(aspect.value(), Utils::FilePath::fromString(QDir::tempPath()));
+
+    QTRY_COMPARE(aspect.value(), Utils::FilePath::fromUserInput(dir.path()));
+    QCOMPARE(edit->text(), aspect.value().nativePath());
+}
+
+void PathAspectTest::testInvalidPath(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    Utils::AspectContainer container;
+    Internal::PathAspect aspect(&container);
+    aspect.setValue(Utils::FilePath::fromString(dir.path()));
+    std::unique_ptr<QWidget> widget;
+    Widgets::FileTypeValidatingLineEdit* edit = createEdit(aspect, widget);
+    QVERIFY(edit != nullptr);
+    QSignalSpy validatedSpy(edit, &Widgets::FileTypeValidatingLineEdit::validated);
+
+    // NOTE The invalid path is restored once it has been validated.
+    edit->setText(QDir(dir.path()).filePath(QLatin1String("missing")));
+    QVERIFY(edit->isValidating());
+    emit edit->editingFinished();
+    QTRY_COMPARE(validatedSpy.size(), 1);
+    QCOMPARE(aspect.value(), Utils::FilePath::fromString(dir.path()));
+    QCOMPARE(edit->text(), aspect.value().nativePath());
+}
+
+void PathAspectTest::testEditedAgain(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    Utils::AspectContainer container;
+    Internal::PathAspect aspect(&container);
+    aspect.setValue(Utils::FilePath::fromString(dir.path()));
+    std::unique_ptr<QWidget> widget;
+    Widgets::FileTypeValidatingLineEdit* edit = createEdit(aspect, widget);
+    QVERIFY(edit != nullptr);
+    QSignalSpy validatedSpy(edit, &Widgets::FileTypeValidatingLineEdit::validated);
+
+    // NOTE The path is not restored while the user is typing it again.
+    edit->setText(QDir(dir.path()).filePath(QLatin1String("missing")));
+    emit edit->editingFinished();
+    QTest::keyClicks(edit, QLatin1String("/more"));
+    QTRY_COMPARE(validatedSpy.size(), 1);
+    QCOMPARE(validatedSpy.at(0).at(0).toBool(), false);
+    QCOMPARE(edit->text(), QDir(dir.path()).filePath(QLatin1String("missing/more")));
+    QCOMPARE(aspect.value(), Utils::FilePath::fromString(dir.path()));
+}
+
+} // Test
+} // QtcDevPlugin
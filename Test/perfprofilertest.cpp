@@ -0,0 +1,120 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "perfprofilertest.h"
+
+#include "../perfprofiler.h"
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+QByteArray PerfProfilerTest::scriptOutput(void)
+{
+    return QByteArray(
+        "qtcreator 1234/1234 10.000001:     250000 cycles:u: \n"
+        "\t    7f0000001000 MyPlugin::Model::index(int, int) const+0x12 (/build/lib/qtcreator/plugins/libMyPlugin.so)\n"
+        "\t    7f0000002000 MyPlugin::Model::reset()+0x40 (/build/lib/qtcreator/plugins/libMyPlugin.so)\n"
+        "\t    7f0000003000 QCoreApplication::exec()+0x99 (/usr/lib/libQt6Core.so.6.8.0)\n"
+        "\t    5500000004000 main+0x10 (/opt/qtcreator/bin/qtcreator)\n"
+        "\n"
+        "qtcreator 1234/1234 10.000002:     250000 cycles:u: \n"
+        "\t    7f0000005000 malloc+0x20 (/usr/lib/libc.so.6)\n"
+        "\t    7f0000002000 MyPlugin::Model::reset()+0x40 (/build/lib/qtcreator/plugins/libMyPlugin.so)\n"
+        "\t    7f0000003000 QCoreApplication::exec()+0x99 (/usr/lib/libQt6Core.so.6.8.0)\n"
+        "\t    5500000004000 main+0x10 (/opt/qtcreator/bin/qtcreator)\n"
+        "\n"
+        "QThread pool 1234/1240 10.000003:     250000 cycles:u: \n"
+        "\t    7f0000006000 [unknown] (/usr/lib/libQt6Core.so.6.8.0)\n"
+        "\t    7f0000007000 start_thread+0x80 (/usr/lib/libc.so.6)\n"
+        "\n"
+        "qtcreator 1234/1234 10.000004:     250000 cycles:u: \n"
+        "\t    7f0000005000 malloc+0x20 (/usr/lib/libc.so.6)\n"
+        "\t    7f0000002000 MyPlugin::Model::reset()+0x40 (/build/lib/qtcreator/plugins/libMyPlugin.so)\n"
+        "\t    7f0000003000 QCoreApplication::exec()+0x99 (/usr/lib/libQt6Core.so.6.8.0)\n"
+        "\t    5500000004000 main+0x10 (/opt/qtcreator/bin/qtcreator)\n"
+        "\n"
+    );
+}
+
+void PerfProfilerTest::testFolded(void)
+{
+    Internal::PerfProfiler profiler(QStringList() << QLatin1String("libMyPlugin.so"));
+    profiler.addOutput(scriptOutput());
+    profiler.finish();
+
+    QCOMPARE(profiler.sampleCount(), 4);
+    QCOMPARE(profiler.pluginSampleCount(), 3);
+
+    QByteArray expected(
+        "qtcreator;main;QCoreApplication::exec();MyPlugin::Model::reset();MyPlugin::Model::index(int, int) const 1\n"
+        "qtcreator;main;QCoreApplication::exec();MyPlugin::Model::reset();malloc 2\n"
+    );
+    QCOMPARE(profiler.folded(), expected);
+}
+
+void PerfProfilerTest::testChunks(void)
+{
+    Internal::PerfProfiler reference(QStringList() << QLatin1String("libMyPlugin.so"));
+    reference.addOutput(scriptOutput());
+    reference.finish();
+
+    // NOTE The last sample is not followed by an empty line.
+    QByteArray output = scriptOutput();
+    output.chop(2);
+
+    Internal::PerfProfiler profiler(QStringList() << QLatin1String("libMyPlugin.so"));
+    for (int i = 0; i < output.size(); i += 7)
+        profiler.addOutput(output.mid(i, 7));
+    profiler.finish();
+
+    QCOMPARE(profiler.sampleCount(), reference.sampleCount());
+    QCOMPARE(profiler.pluginSampleCount(), reference.pluginSampleCount());
+    QCOMPARE(profiler.folded(), reference.folded());
+}
+
+void PerfProfilerTest::testReport(void)
+{
+    Internal::PerfProfiler profiler(QStringList() << QLatin1String("libMyPlugin.so"));
+    profiler.addOutput(scriptOutput());
+    profiler.finish();
+
+    QStringList report = profiler.report();
+    QCOMPARE(report.size(), 4);
+    QVERIFY2(report.at(0).startsWith(QLatin1String("3 of the 4 samples (75.0%)")), qPrintable(report.at(0)));
+    QVERIFY2(report.at(2).contains(QRegularExpression(QLatin1String("75\\.0%\\s+50\\.0% MyPlugin::Model::reset\\(\\)$"))), qPrintable(report.at(2)));
+    QVERIFY2(report.at(3).contains(QRegularExpression(QLatin1String("25\\.0%\\s+25\\.0% MyPlugin::Model::index\\(int, int\\) const$"))), qPrintable(report.at(3)));
+
+    QCOMPARE(profiler.report(1).size(), 3);
+}
+
+void PerfProfilerTest::testNoPluginSample(void)
+{
+    Internal::PerfProfiler profiler(QStringList() << QLatin1String("libOtherPlugin.so"));
+    profiler.addOutput(scriptOutput());
+    profiler.finish();
+
+    QCOMPARE(profiler.sampleCount(), 4);
+    QCOMPARE(profiler.pluginSampleCount(), 0);
+    QVERIFY(profiler.folded().isEmpty());
+    QCOMPARE(profiler.report().size(), 1);
+}
+
+} // Test
+} // QtcDevPlugin
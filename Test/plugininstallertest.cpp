@@ -0,0 +1,136 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "plugininstallertest.h"
+
+#include "../plugininstaller.h"
+
+#include <utils/hostosinfo.h>
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void PluginInstallerTest::testInstall(void)
+{
+    QTemporaryDir buildDir;
+    QTemporaryDir installDir;
+    QVERIFY(buildDir.isValid());
+    QVERIFY(installDir.isValid());
+
+    Utils::FilePath library = Utils::FilePath::fromString(buildDir.filePath(QLatin1String("libPlugin.so")));
+    Utils::FilePath translation = Utils::FilePath::fromString(buildDir.filePath(QLatin1String("plugin_fr.qm")));
+    QVERIFY(library.writeFileContents(QByteArray("library v1")));
+    QVERIFY(translation.writeFileContents(QByteArray("translation")));
+    Utils::FilePath installPath = Utils::FilePath::fromString(installDir.filePath(QLatin1String("plugins")));
+
+    QList<Internal::PluginInstaller::File> files;
+    files << Internal::PluginInstaller::File{library, installPath.pathAppended(QLatin1String("libPlugin.so"))};
+    files << Internal::PluginInstaller::File{translation, installPath.pathAppended(QLatin1String("plugin_fr.qm"))};
+
+    Utils::Result<Internal::PluginInstaller::Statistics> stats = Internal::PluginInstaller::install(files);
+    QVERIFY2(stats, qPrintable(stats ? QString() : stats.error()));
+    QCOMPARE(stats->copied, 2);
+    QCOMPARE(stats->unchanged, 0);
+    QCOMPARE(stats->copiedBytes, (qint64) 21);
+    QCOMPARE(*installPath.pathAppended(QLatin1String("libPlugin.so")).fileContents(), QByteArray("library v1"));
+    QCOMPARE(*installPath.pathAppended(QLatin1String("plugin_fr.qm")).fileContents(), QByteArray("translation"));
+
+    stats = Internal::PluginInstaller::install(files);
+    QVERIFY(stats);
+    QCOMPARE(stats->copied, 0);
+    QCOMPARE(stats->unchanged, 2);
+
+    // Same size, other contents:
+    QVERIFY(library.writeFileContents(QByteArray("library v2")));
+    QVERIFY(!Internal::PluginInstaller::isUpToDate(files.at(0)));
+    QVERIFY(Internal::PluginInstaller::isUpToDate(files.at(1)));
+    stats = Internal::PluginInstaller::install(files);
+    QVERIFY(stats);
+    QCOMPARE(stats->copied, 1);
+    QCOMPARE(stats->unchanged, 1);
+    QCOMPARE(*installPath.pathAppended(QLatin1String("libPlugin.so")).fileContents(), QByteArray("library v2"));
+
+    files << Internal::PluginInstaller::File{Utils::FilePath::fromString(buildDir.filePath(QLatin1String("missing"))),
+                                             installPath.pathAppended(QLatin1String("missing"))};
+    QVERIFY(!Internal::PluginInstaller::install(files));
+}
+
+void PluginInstallerTest::testAtomic(void)
+{
+    if (Utils::HostOsInfo::isWindowsHost())
+        QSKIP("Opened files cannot be replaced on Windows");
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    Internal::PluginInstaller::File file = {
+        Utils::FilePath::fromString(dir.filePath(QLatin1String("built.so"))),
+        Utils::FilePath::fromString(dir.filePath(QLatin1String("installed.so"))),
+    };
+    QVERIFY(file.target.writeFileContents(QByteArray("old version")));
+    QVERIFY(file.source.writeFileContents(QByteArray("new version")));
+
+    // An instance which has the installed file opened keeps reading the old version:
+    QFile opened(file.target.toFSPathString());
+    QVERIFY(opened.open(QIODevice::ReadOnly));
+    QVERIFY(Internal::PluginInstaller::installFile(file));
+    QCOMPARE(opened.readAll(), QByteArray("old version"));
+    QCOMPARE(*file.target.fileContents(), QByteArray("new version"));
+    QVERIFY(Internal::PluginInstaller::isUpToDate(file));
+}
+
+void PluginInstallerTest::testFiles(void)
+{
+    ProjectExplorer::BuildTargetInfo info;
+    QVERIFY(Internal::PluginInstaller::files(info).isEmpty());
+
+    info.targetFilePath = Utils::FilePath::fromString(QLatin1String("/install/lib/qtcreator/plugins/libPlugin.so"));
+    info.additionalData = QStringList() << QLatin1String("/build/lib/qtcreator/plugins/libPlugin.so")
+                                        << QLatin1String("/build/lib/qtcreator/plugins/libPlugin.so.debug");
+
+    QList<Internal::PluginInstaller::File> files = Internal::PluginInstaller::files(info);
+    QCOMPARE(files.size(), 2);
+    QCOMPARE(files.at(0).source, Utils::FilePath::fromString(QLatin1String("/build/lib/qtcreator/plugins/libPlugin.so")));
+    QCOMPARE(files.at(0).target, Utils::FilePath::fromString(QLatin1String("/install/lib/qtcreator/plugins/libPlugin.so")));
+    QCOMPARE(files.at(1).source, Utils::FilePath::fromString(QLatin1String("/build/lib/qtcreator/plugins/libPlugin.so.debug")));
+    QCOMPARE(files.at(1).target, Utils::FilePath::fromString(QLatin1String("/install/lib/qtcreator/plugins/libPlugin.so.debug")));
+}
+
+void PluginInstallerTest::testEncode(void)
+{
+    QList<Internal::PluginInstaller::File> files;
+    files << Internal::PluginInstaller::File{Utils::FilePath::fromString(QLatin1String("/build/a")), Utils::FilePath::fromString(QLatin1String("/install/a"))};
+    files << Internal::PluginInstaller::File{Utils::FilePath::fromString(QLatin1String("/build/b")), Utils::FilePath::fromString(QLatin1String("/install/b"))};
+
+    QStringList encoded = Internal::PluginInstaller::encode(files);
+    QCOMPARE(encoded.size(), 4);
+
+    QList<Internal::PluginInstaller::File> decoded = Internal::PluginInstaller::decode(encoded);
+    QCOMPARE(decoded.size(), 2);
+    for (int f = 0; f < files.size(); f++) {
+        QCOMPARE(decoded.at(f).source, files.at(f).source);
+        QCOMPARE(decoded.at(f).target, files.at(f).target);
+    }
+
+    QVERIFY(Internal::PluginInstaller::decode(QStringList() << QLatin1String("/build/a")).isEmpty());
+}
+
+} // Test
+} // QtcDevPlugin
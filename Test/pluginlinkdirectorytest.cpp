@@ -0,0 +1,127 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "pluginlinkdirectorytest.h"
+
+#include "../pluginlinkdirectory.h"
+
+#include <utils/hostosinfo.h>
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void PluginLinkDirectoryTest::testLink(void)
+{
+    if (!Internal::PluginLinkDirectory::isAvailable())
+        QSKIP("Plugins cannot be linked on this host");
+
+    QTemporaryDir buildDir;
+    QVERIFY(buildDir.isValid());
+    QDir(buildDir.path()).mkpath(QLatin1String("lib/qtcreator/plugins"));
+    Utils::FilePath library = Utils::FilePath::fromString(buildDir.filePath(QLatin1String("lib/qtcreator/plugins/libPlugin.so")));
+    Utils::FilePath debugInfo = Utils::FilePath::fromString(buildDir.filePath(QLatin1String("lib/qtcreator/plugins/libPlugin.so.debug")));
+    QVERIFY(library.writeFileContents(QByteArray("library")));
+    QVERIFY(debugInfo.writeFileContents(QByteArray("debug info")));
+
+    QString linkPath;
+    {
+        Internal::PluginLinkDirectory links;
+        Utils::Result<> result = links.link(QList<Utils::FilePath>() << library << debugInfo << library);
+        QVERIFY2(result, qPrintable(result ? QString() : result.error()));
+        QCOMPARE(links.linkCount(), 2);
+
+        linkPath = links.path();
+        QFileInfo libraryLink(QDir(linkPath).filePath(QLatin1String("libPlugin.so")));
+        QVERIFY(libraryLink.isSymLink());
+        QCOMPARE(libraryLink.symLinkTarget(), library.toFSPathString());
+        QCOMPARE(*Utils::FilePath::fromString(libraryLink.filePath()).fileContents(), QByteArray("library"));
+        QVERIFY(QFileInfo(QDir(linkPath).filePath(QLatin1String("libPlugin.so.debug"))).isSymLink());
+
+        links.remove();
+        QVERIFY(!QFileInfo::exists(linkPath));
+    }
+
+    QVERIFY(library.isFile());
+    QVERIFY(debugInfo.isFile());
+}
+
+void PluginLinkDirectoryTest::testMissing(void)
+{
+    QTemporaryDir buildDir;
+    QVERIFY(buildDir.isValid());
+
+    Internal::PluginLinkDirectory links;
+    QVERIFY(!links.link(QList<Utils::FilePath>() << Utils::FilePath::fromString(buildDir.filePath(QLatin1String("libPlugin.so")))));
+}
+
+void PluginLinkDirectoryTest::testReplacePluginPaths(void)
+{
+    QList<Utils::FilePath> files;
+    files << Utils::FilePath::fromString(QLatin1String("/build/lib/qtcreator/plugins/libPlugin.so"));
+    files << Utils::FilePath::fromString(QLatin1String("/my build/lib/qtcreator/plugins/libOther.so"));
+
+    QStringList args = QStringList() << QLatin1String("-theme") << QLatin1String("flat")
+                                     << QLatin1String("-pluginpath") << QLatin1String("/build")
+                                     << QLatin1String("-pluginpath") << QLatin1String("\"/my build\"")
+                                     << QLatin1String("-pluginpath") << QLatin1String("/opt/qtcdevplugin/probe")
+                                     << QLatin1String("-load") << QLatin1String("all");
+    QStringList expected = QStringList() << QLatin1String("-theme") << QLatin1String("flat")
+                                         << QLatin1String("-pluginpath") << QLatin1String("/tmp/links")
+                                         << QLatin1String("-pluginpath") << QLatin1String("/opt/qtcdevplugin/probe")
+                                         << QLatin1String("-load") << QLatin1String("all");
+    QCOMPARE(Internal::PluginLinkDirectory::replacePluginPaths(args, files, QLatin1String("/tmp/links")), expected);
+
+    args = QStringList() << QLatin1String("-pluginpath") << QLatin1String("/elsewhere");
+    QCOMPARE(Internal::PluginLinkDirectory::replacePluginPaths(args, files, QLatin1String("/tmp/links")), args);
+}
+
+void PluginLinkDirectoryTest::testSiblingPlugins(void)
+{
+    QTemporaryDir buildDir;
+    QVERIFY(buildDir.isValid());
+    QDir(buildDir.path()).mkpath(QLatin1String("lib/qtcreator/plugins"));
+    QDir(buildDir.path()).mkpath(QLatin1String("src/other"));
+    QString suffix = Utils::HostOsInfo::isMacHost() ? QLatin1String(".dylib") : QLatin1String(".so");
+    Utils::FilePath library = Utils::FilePath::fromString(buildDir.filePath(QLatin1String("lib/qtcreator/plugins/libPlugin") + suffix));
+    Utils::FilePath sibling = Utils::FilePath::fromString(buildDir.filePath(QLatin1String("lib/qtcreator/plugins/libDependency") + suffix));
+    Utils::FilePath nested = Utils::FilePath::fromString(buildDir.filePath(QLatin1String("src/other/libOther") + suffix));
+    Utils::FilePath object = Utils::FilePath::fromString(buildDir.filePath(QLatin1String("src/other/other.o")));
+    for (Utils::FilePath file : QList<Utils::FilePath>() << library << sibling << nested << object)
+        QVERIFY(file.writeFileContents(QByteArray("library")));
+
+    QTemporaryDir otherDir;
+    QVERIFY(otherDir.isValid());
+    Utils::FilePath other = Utils::FilePath::fromString(otherDir.filePath(QLatin1String("libProbe") + suffix));
+    QVERIFY(other.writeFileContents(QByteArray("library")));
+
+    QStringList args = QStringList() << QLatin1String("-pluginpath") << buildDir.path()
+                                     << QLatin1String("-pluginpath") << otherDir.path();
+    QList<Utils::FilePath> siblings = Internal::PluginLinkDirectory::siblingPlugins(args, QList<Utils::FilePath>() << library);
+    std::sort(siblings.begin(), siblings.end());
+    QList<Utils::FilePath> expected = QList<Utils::FilePath>() << sibling << nested;
+    std::sort(expected.begin(), expected.end());
+    QCOMPARE(siblings, expected);
+
+    args = QStringList() << QLatin1String("-pluginpath") << otherDir.path();
+    QVERIFY(Internal::PluginLinkDirectory::siblingPlugins(args, QList<Utils::FilePath>() << library).isEmpty());
+}
+
+} // Test
+} // QtcDevPlugin
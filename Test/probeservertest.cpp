@@ -0,0 +1,107 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "probeservertest.h"
+
+#include "../probeserver.h"
+
+#include <QtTest>
+#include <QtNetwork>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void ProbeServerTest::testRenderPlugins(void)
+{
+    QJsonObject message = QJsonDocument::fromJson(
+        "{\"type\": \"plugins\", \"plugins\": ["
+        "{\"name\": \"Fast\", \"load\": 1, \"initialize\": 2, \"extensionsInitialized\": 0, \"delayedInitialize\": 0},"
+        "{\"name\": \"Slow\", \"load\": 10, \"initialize\": 20, \"extensionsInitialized\": 5, \"delayedInitialize\": 5}"
+        "]}"
+    ).object();
+
+    QStringList lines = Internal::ProbeServer::render(message);
+    QCOMPARE(lines.size(), 2);
+    // Slowest plugins first:
+    QVERIFY2(lines.at(0).contains(QLatin1String("Slow started in 40 ms")), qPrintable(lines.at(0)));
+    QVERIFY2(lines.at(1).contains(QLatin1String("Fast started in 3 ms")), qPrintable(lines.at(1)));
+}
+
+void ProbeServerTest::testRenderSample(void)
+{
+    QJsonObject message = QJsonDocument::fromJson(
+        "{\"type\": \"sample\", \"latency\": 12, \"rss\": 204800, \"widgets\": 1234, \"objects\": 567}"
+    ).object();
+
+    QStringList lines = Internal::ProbeServer::render(message);
+    QCOMPARE(lines.size(), 1);
+    QVERIFY2(lines.first().contains(QLatin1String("12.0 ms")), qPrintable(lines.first()));
+    QVERIFY2(lines.first().contains(QLatin1String("200.0 MiB")), qPrintable(lines.first()));
+    QVERIFY2(lines.first().contains(QLatin1String("1234 widgets")), qPrintable(lines.first()));
+    QVERIFY2(lines.first().contains(QLatin1String("567 objects")), qPrintable(lines.first()));
+}
+
+void ProbeServerTest::testRenderStall(void)
+{
+    QJsonObject message = QJsonDocument::fromJson(
+        "{\"type\": \"stall\", \"duration\": 250, \"frames\": ["
+        "{\"module\": \"/usr/lib/libc.so.6\", \"symbol\": \"nanosleep\", \"offset\": 4096},"
+        "{\"module\": \"/plugins/libQtcPluginTest.so\", \"symbol\": \"QtcPluginTest::slowSlot()\", \"offset\": 255},"
+        "{\"module\": \"/usr/lib/libQt6Core.so.6\", \"offset\": 16}"
+        "]}"
+    ).object();
+
+    QStringList lines = Internal::ProbeServer::render(message, QStringList() << QLatin1String("libQtcPluginTest.so"));
+    QCOMPARE(lines.size(), 4);
+    QVERIFY2(lines.at(0).contains(QLatin1String("250 ms in libQtcPluginTest.so (QtcPluginTest::slowSlot())")), qPrintable(lines.at(0)));
+    QVERIFY2(lines.at(2).contains(QLatin1String("> #1 QtcPluginTest::slowSlot() (libQtcPluginTest.so+0xff)")), qPrintable(lines.at(2)));
+    QVERIFY2(lines.at(3).contains(QLatin1String("#2 ?? (libQt6Core.so.6+0x10)")), qPrintable(lines.at(3)));
+
+    lines = Internal::ProbeServer::render(message);
+    QVERIFY2(lines.at(0).contains(QLatin1String("outside of the plugin")), qPrintable(lines.at(0)));
+}
+
+void ProbeServerTest::testRenderUnknown(void)
+{
+    QVERIFY(Internal::ProbeServer::render(QJsonObject()).isEmpty());
+    QVERIFY(Internal::ProbeServer::render(QJsonObject({{QLatin1String("type"), QLatin1String("unknown")}})).isEmpty());
+}
+
+void ProbeServerTest::testConnection(void)
+{
+    Internal::ProbeServer server;
+    QVERIFY(server.isListening());
+    QSignalSpy reportedSpy(&server, &Internal::ProbeServer::reported);
+
+    QLocalSocket socket;
+    socket.connectToServer(server.serverName());
+    QVERIFY(socket.waitForConnected(1000));
+
+    // Messages may be split arbitrarily:
+    socket.write("{\"type\": \"sample\", \"latency\": 1,");
+    socket.flush();
+    socket.write(" \"rss\": 1024, \"widgets\": 1, \"objects\": 1}\n{\"type\": \"sample\", \"latency\": 2, \"rss\": -1, \"widgets\": 2, \"objects\": 2}\n");
+    socket.flush();
+
+    QTRY_COMPARE(reportedSpy.count(), 2);
+    QVERIFY(reportedSpy.at(0).at(0).toString().contains(QLatin1String("1.0 MiB")));
+    QVERIFY(reportedSpy.at(1).at(0).toString().contains(QLatin1String("unknown")));
+}
+
+} // Test
+} // QtcDevPlugin
@@ -21,6 +21,7 @@
 
 #include "../qtcrunconfiguration.h"
 #include "../qtctestrunconfiguration.h"
+#include "../qtctestallrunconfiguration.h"
 #include "../qtcdevpluginconstants.h"
 
 #include <projectexplorer/projectexplorer.h>
@@ -146,11 +147,15 @@ void QtcRunConfigurationFactoryTest::testOpenProject(void)
         for (ProjectExplorer::BuildConfiguration* buildConfig: target->buildConfigurations()) {
             QLinkedList<Internal::QtcRunConfiguration*> qtcRunConfigs;
             QLinkedList<Internal::QtcTestRunConfiguration*> qtcTestRunConfigs;
+            QLinkedList<Internal::QtcTestAllRunConfiguration*> qtcTestAllRunConfigs;
             for (ProjectExplorer::RunConfiguration* runConfig: buildConfig->runConfigurations()) {
                 Internal::QtcRunConfiguration* qtcRunConfig = qobject_cast<Internal::QtcRunConfiguration*>(runConfig);
                 Internal::QtcTestRunConfiguration* qtcTestRunConfig = qobject_cast<Internal::QtcTestRunConfiguration*>(runConfig);
+                Internal::QtcTestAllRunConfiguration* qtcTestAllRunConfig = qobject_cast<Internal::QtcTestAllRunConfiguration*>(runConfig);
 
-                if (qtcTestRunConfig != nullptr)
+                if (qtcTestAllRunConfig != nullptr)
+                    qtcTestAllRunConfigs << qtcTestAllRunConfig;
+                else if (qtcTestRunConfig != nullptr)
                     qtcTestRunConfigs << qtcTestRunConfig;
                 else if (qtcRunConfig != nullptr)
                     qtcRunConfigs << qtcRunConfig;
@@ -265,6 +270,27 @@ void QtcRunConfigurationFactoryTest::testOpenProject(void)
                 QCOMPARE(pluginArg, pluginFolderPath);
             }
             QCOMPARE(qtcPlugins.size(), qtcTestPluginsFound.size());
+
+            QCOMPARE(qtcTestAllRunConfigs.size(), qtcPlugins.size() > 1 ? 1 : 0);
+            for (Internal::QtcTestAllRunConfiguration* qtcTestAllRunConfig: qtcTestAllRunConfigs) {
+                QCOMPARE(qtcTestAllRunConfig->buildTargetInfo().buildKey, Constants::AllPluginsBuildKey);
+                QCOMPARE(qtcTestAllRunConfig->displayName(), QString(QLatin1String("Run Qt Creator tests for all plugins in \"%1\"")).arg(mProject->displayName()));
+
+                QStringList args = qtcTestAllRunConfig->commandLineArgumentsList();
+                QStringList testedPlugins;
+                for (int a = 0; a + 1 < args.size(); a++) {
+                    if (args.at(a) == QLatin1String("-test"))
+                        testedPlugins << args.at(a + 1);
+                }
+                QCOMPARE(testedPlugins.size(), qtcPlugins.size());
+                for (ExpectedPluginInfo pluginInfo: qtcPlugins)
+                    QVERIFY2(testedPlugins.contains(pluginInfo.name), qPrintable(QString(QLatin1String("Plugin not tested: %1")).arg(pluginInfo.name)));
+
+                int loadIndex = args.indexOf(QLatin1String("-load"));
+                QVERIFY(loadIndex != -1);
+                QVERIFY(loadIndex + 1 < args.size());
+                QCOMPARE(args.at(loadIndex + 1), QLatin1String("all"));
+            }
         }
     }
 }
@@ -0,0 +1,127 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "settingsclonetest.h"
+
+#include "../settingsclone.h"
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+static void writeFile(const QString& path, const QByteArray& contents)
+{
+    QDir().mkpath(QFileInfo(path).path());
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QCOMPARE(file.write(contents), contents.size());
+}
+
+static QByteArray readFile(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return QByteArray();
+    return file.readAll();
+}
+
+void SettingsCloneTest::testReplacedAtomically(void)
+{
+    QVERIFY(Internal::SettingsClone::isReplacedAtomically(QLatin1String("QtProject/QtCreator.ini")));
+    QVERIFY(Internal::SettingsClone::isReplacedAtomically(QLatin1String("qtcreator/toolchains.xml")));
+    QVERIFY(!Internal::SettingsClone::isReplacedAtomically(QLatin1String("qtcreator/qtcreator.db")));
+    QVERIFY(!Internal::SettingsClone::isReplacedAtomically(QLatin1String("qtcreator/styles/default.xml.bak")));
+}
+
+void SettingsCloneTest::testTemplatePath(void)
+{
+    QCOMPARE(Internal::SettingsClone::templatePath(QStringList() << QLatin1String("-theme") << QLatin1String("flat")
+                                                                  << QLatin1String("-settingspath") << QLatin1String("/tmp/settings")),
+             QLatin1String("/tmp/settings"));
+    QCOMPARE(Internal::SettingsClone::templatePath(QStringList() << QLatin1String("-settingspath") << QLatin1String("\"/tmp/my settings\"")),
+             QLatin1String("/tmp/my settings"));
+    QVERIFY(Internal::SettingsClone::templatePath(QStringList() << QLatin1String("-theme") << QLatin1String("flat")).isEmpty());
+    QVERIFY(Internal::SettingsClone::templatePath(QStringList() << QLatin1String("-settingspath")).isEmpty());
+}
+
+void SettingsCloneTest::testClone(void)
+{
+    QTemporaryDir templateDir;
+    QVERIFY(templateDir.isValid());
+    writeFile(templateDir.filePath(QLatin1String("QtProject/QtCreator.ini")), "[General]\nTheme=flat\n");
+    writeFile(templateDir.filePath(QLatin1String("QtProject/qtcreator/toolchains.xml")), "<qtcreator/>\n");
+    writeFile(templateDir.filePath(QLatin1String("QtProject/qtcreator/cache/index.db")), "index");
+    QDir(templateDir.path()).mkpath(QLatin1String("QtProject/qtcreator/empty"));
+
+    Internal::SettingsClone clone(templateDir.path());
+    Utils::Result<> result = clone.clone();
+    QVERIFY2(result, qPrintable(result ? QString() : result.error()));
+
+    QVERIFY(clone.path() != templateDir.path());
+    QCOMPARE(QFileInfo(clone.path()).path(), QFileInfo(templateDir.path()).path());
+    QCOMPARE(readFile(clone.path() + QLatin1String("/QtProject/QtCreator.ini")), QByteArray("[General]\nTheme=flat\n"));
+    QCOMPARE(readFile(clone.path() + QLatin1String("/QtProject/qtcreator/toolchains.xml")), QByteArray("<qtcreator/>\n"));
+    QCOMPARE(readFile(clone.path() + QLatin1String("/QtProject/qtcreator/cache/index.db")), QByteArray("index"));
+    QVERIFY(QFileInfo(clone.path() + QLatin1String("/QtProject/qtcreator/empty")).isDir());
+
+    Internal::SettingsClone::Statistics stats = clone.statistics();
+    QCOMPARE(stats.reflinked + stats.hardlinked + stats.copied, 3);
+    QVERIFY(stats.hardlinked <= 2);
+}
+
+void SettingsCloneTest::testWrite(void)
+{
+    QTemporaryDir templateDir;
+    QVERIFY(templateDir.isValid());
+    writeFile(templateDir.filePath(QLatin1String("QtCreator.ini")), "[General]\nTheme=flat\n");
+    writeFile(templateDir.filePath(QLatin1String("session.db")), "session");
+
+    Internal::SettingsClone clone(templateDir.path());
+    QVERIFY(clone.clone());
+
+    QSaveFile iniFile(clone.path() + QLatin1String("/QtCreator.ini"));
+    QVERIFY(iniFile.open(QIODevice::WriteOnly));
+    iniFile.write("[General]\nTheme=dark\n");
+    QVERIFY(iniFile.commit());
+    writeFile(clone.path() + QLatin1String("/session.db"), "modified");
+
+    QCOMPARE(readFile(clone.path() + QLatin1String("/QtCreator.ini")), QByteArray("[General]\nTheme=dark\n"));
+    QCOMPARE(readFile(templateDir.filePath(QLatin1String("QtCreator.ini"))), QByteArray("[General]\nTheme=flat\n"));
+    QCOMPARE(readFile(clone.path() + QLatin1String("/session.db")), QByteArray("modified"));
+    QCOMPARE(readFile(templateDir.filePath(QLatin1String("session.db"))), QByteArray("session"));
+}
+
+void SettingsCloneTest::testRemove(void)
+{
+    QTemporaryDir templateDir;
+    QVERIFY(templateDir.isValid());
+    writeFile(templateDir.filePath(QLatin1String("QtCreator.ini")), "[General]\n");
+
+    Internal::SettingsClone clone(templateDir.path());
+    QVERIFY(clone.clone());
+    QString clonePath = clone.path();
+    QVERIFY(QFileInfo::exists(clonePath));
+
+    clone.remove();
+    QVERIFY(!QFileInfo::exists(clonePath));
+    QVERIFY(QFileInfo::exists(templateDir.filePath(QLatin1String("QtCreator.ini"))));
+}
+
+} // Test
+} // QtcDevPlugin
@@ -0,0 +1,44 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef SETTINGSCLONETEST_H
+#define SETTINGSCLONETEST_H
+
+#include <QObject>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+class SettingsCloneTest : public QObject
+{
+    Q_OBJECT
+public:
+    inline SettingsCloneTest(QObject* parent = nullptr) :
+        QObject(parent) {}
+private Q_SLOTS:
+    void testReplacedAtomically(void);
+    void testTemplatePath(void);
+    void testClone(void);
+    void testWrite(void);
+    void testRemove(void);
+};
+
+} // Test
+} // QtcDevPlugin
+
+#endif // SETTINGSCLONETEST_H
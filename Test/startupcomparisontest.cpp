@@ -0,0 +1,105 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "startupcomparisontest.h"
+
+#include "../startupcomparison.h"
+
+#include <utils/hostosinfo.h>
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void StartupComparisonTest::testStatistics_data(void)
+{
+    QTest::addColumn< QList<double> >("values");
+    QTest::addColumn<double>("median");
+    QTest::addColumn<double>("mad");
+    QTest::addColumn<double>("lower");
+    QTest::addColumn<double>("upper");
+
+    QTest::newRow("Single") << (QList<double>() << 100.) << 100. << 0. << 100. << 100.;
+    QTest::newRow("Odd") << (QList<double>() << 3. << 1. << 2.) << 2. << 1. << 1. << 3.;
+    QTest::newRow("Even") << (QList<double>() << 4. << 1. << 3. << 2.) << 2.5 << 1. << 1. << 4.;
+    QTest::newRow("Outlier") << (QList<double>() << 10. << 11. << 12. << 13. << 14. << 15. << 16. << 17. << 18. << 19. << 20. << 21. << 22. << 23. << 24. << 25. << 26. << 27. << 28. << 1000.)
+                             << 19.5 << 5. << 14. << 25.;
+}
+
+void StartupComparisonTest::testStatistics(void)
+{
+    QFETCH(QList<double>, values);
+    QFETCH(double, median);
+    QFETCH(double, mad);
+    QFETCH(double, lower);
+    QFETCH(double, upper);
+
+    Internal::StartupComparison::Statistics stats = Internal::StartupComparison::statistics(values);
+    QCOMPARE(stats.count, values.size());
+    QCOMPARE(stats.median, median);
+    QCOMPARE(stats.mad, mad);
+    QCOMPARE(stats.lower, lower);
+    QCOMPARE(stats.upper, upper);
+}
+
+void StartupComparisonTest::testReport(void)
+{
+    Internal::StartupComparison comparison;
+    QVERIFY(comparison.report().isEmpty());
+
+    for (int i = 0; i < 5; i++) {
+        comparison.addSample(true, {.wallTime = 1100. + i, .peakRss = -1.});
+        comparison.addSample(false, {.wallTime = 1000. + i, .peakRss = -1.});
+    }
+    QCOMPARE(comparison.sampleCount(), 10);
+
+    // NOTE Peak RSS is unknown, so only startup time is reported.
+    QStringList report = comparison.report();
+    QCOMPARE(report.size(), 3);
+    QVERIFY2(report.last().contains(QLatin1String("100.0 ms")), qPrintable(report.last()));
+}
+
+void StartupComparisonTest::testPeakRss(void)
+{
+    double peakRss = Internal::StartupComparison::peakRss(QCoreApplication::applicationPid());
+    if (!Utils::HostOsInfo::isLinuxHost())
+        QCOMPARE(peakRss, -1.);
+    else
+        QVERIFY(peakRss > 0);
+    QCOMPARE(Internal::StartupComparison::peakRss(0), -1.);
+}
+
+void StartupComparisonTest::testStartupDone(void)
+{
+    QVERIFY(!Internal::StartupComparison::isStartupDone(QLatin1String("Core::Internal::CorePlugin: initialize 12ms\n")));
+    QVERIFY(Internal::StartupComparison::isStartupDone(QLatin1String("Core::Internal::CorePlugin: initialize 12ms\nPlugin profiling summaries (init/initialized/delayed):\n")));
+}
+
+void StartupComparisonTest::testPluginName(void)
+{
+    if (Utils::HostOsInfo::isWindowsHost()) {
+        QCOMPARE(Internal::StartupComparison::pluginName(Utils::FilePath::fromString("C:/plugins/QtcPluginTest.dll")), QLatin1String("QtcPluginTest"));
+    } else {
+        QCOMPARE(Internal::StartupComparison::pluginName(Utils::FilePath::fromString("/plugins/libQtcPluginTest.so")), QLatin1String("QtcPluginTest"));
+        QCOMPARE(Internal::StartupComparison::pluginName(Utils::FilePath::fromString("/plugins/libQtcPluginTest.dylib")), QLatin1String("QtcPluginTest"));
+    }
+}
+
+} // Test
+} // QtcDevPlugin
@@ -0,0 +1,45 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef STARTUPCOMPARISONTEST_H
+#define STARTUPCOMPARISONTEST_H
+
+#include <QObject>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+class StartupComparisonTest : public QObject
+{
+    Q_OBJECT
+public:
+    inline StartupComparisonTest(QObject* parent = nullptr) :
+        QObject(parent) {}
+private Q_SLOTS:
+    void testStatistics_data(void);
+    void testStatistics(void);
+    void testReport(void);
+    void testPeakRss(void);
+    void testStartupDone(void);
+    void testPluginName(void);
+};
+
+} // Test
+} // QtcDevPlugin
+
+#endif // STARTUPCOMPARISONTEST_H
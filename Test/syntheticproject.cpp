@@ -0,0 +1,491 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "syntheticproject.h"
+
+#include <utils/algorithm.h>
+#include <utils/hostosinfo.h>
+
+#include <QtCore>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+static const QString projectName = QLatin1String("Synthetic");
+
+static QJsonObject version(int major, int minor)
+{
+    return QJsonObject({{QLatin1String("major"), major}, {QLatin1String("minor"), minor}});
+}
+
+static QString cMakeId(const QString& directory)
+{
+    return QString::fromLatin1(QCryptographicHash::hash(directory.toUtf8(), QCryptographicHash::Sha1).toHex().left(20));
+}
+
+static QString libraryFileName(const QString& name)
+{
+    if (Utils::HostOsInfo::isWindowsHost())
+        return name + QLatin1String(".dll");
+    if (Utils::HostOsInfo::isMacHost())
+        return QLatin1String("lib") + name + QLatin1String(".dylib");
+    return QLatin1String("lib") + name + QLatin1String(".so");
+}
+
+SyntheticProject::SyntheticProject(const Parameters& parameters) :
+    mParameters(parameters)
+{
+    mParameters.plugins = qMax(0, mParameters.plugins);
+    mParameters.libraries = qMax(0, mParameters.libraries);
+    mParameters.depth = qMax(1, mParameters.depth);
+    mParameters.sourcesPerTarget = qMax(1, mParameters.sourcesPerTarget);
+}
+
+Utils::FilePath SyntheticProject::cMakeBuildPath(const Utils::FilePath& rootPath)
+{
+    return rootPath.pathAppended(QLatin1String("build"));
+}
+
+QString SyntheticProject::targetName(int t) const
+{
+    if (isPlugin(t))
+        return QLatin1String("Plugin%1").arg(t);
+    return QLatin1String("Library%1").arg(t - mParameters.plugins);
+}
+
+QString SyntheticProject::targetDirectory(int t) const
+{
+    QStringList components;
+    for (int d = 0; d < mParameters.depth - 1; d++)
+        components << QLatin1String("Group%1").arg((t >> d) & 1);
+    components << targetName(t);
+    return components.join(QLatin1Char('/'));
+}
+
+QStringList SyntheticProject::sourceNames(int t) const
+{
+    Q_UNUSED(t);
+
+    QStringList sources;
+    for (int s = 0; s < mParameters.sourcesPerTarget; s++)
+        sources << QLatin1String("source%1.cpp").arg(s);
+    return sources;
+}
+
+QMap<QString, QStringList> SyntheticProject::subDirectories(void) const
+{
+    QMap<QString, QStringList> subDirs;
+
+    for (int t = 0; t < targetCount(); t++) {
+        QString parent;
+        for (QString component : targetDirectory(t).split(QLatin1Char('/'))) {
+            if (!subDirs[parent].contains(component))
+                subDirs[parent] << component;
+            parent = parent.isEmpty() ? component : parent + QLatin1Char('/') + component;
+        }
+    }
+
+    return subDirs;
+}
+
+Utils::Result<> SyntheticProject::writeSources(const Utils::FilePath& rootPath, int t) const
+{
+    Utils::FilePath targetPath = rootPath.pathAppended(targetDirectory(t));
+    QString name = targetName(t);
+
+    int s = 0;
+    for (QString source : sourceNames(t)) {
+        Utils::Result<> result = writeFile(targetPath.pathAppended(source),
+                                           QString::fromLatin1("int %1Function%2(void)\n{\n    return %2;\n}\n").arg(name).arg(s++).toUtf8());
+        if (!result)
+            return result;
+    }
+
+    if (isPlugin(t)) {
+        QJsonObject metaData({
+            {QLatin1String("Name"), name},
+            {QLatin1String("Version"), QLatin1String("0.0.0")},
+            {QLatin1String("CompatVersion"), QLatin1String("0.0.0")},
+            {QLatin1String("Vendor"), QLatin1String("Pascal COMBES")},
+            {QLatin1String("Description"), QLatin1String("Synthetic plugin generated for scaling tests.")},
+        });
+        return writeFile(targetPath.pathAppended(name + QLatin1String(".json.in")), QJsonDocument(metaData).toJson());
+    }
+
+    return Utils::ResultOk;
+}
+
+Utils::Result<Utils::FilePath> SyntheticProject::generateCMake(const Utils::FilePath& rootPath) const
+{
+    QMap<QString, QStringList> subDirs = subDirectories();
+
+    for (auto it = subDirs.cbegin(); it != subDirs.cend(); it++) {
+        QString cMakeLists;
+        if (it.key().isEmpty()) {
+            cMakeLists += QLatin1String("cmake_minimum_required(VERSION 3.24)\n\n");
+            cMakeLists += QLatin1String("project(%1)\n\n").arg(projectName);
+            cMakeLists += QLatin1String("set(CMAKE_CXX_STANDARD 20)\n");
+            cMakeLists += QLatin1String("set(CMAKE_CXX_STANDARD_REQUIRED ON)\n\n");
+            cMakeLists += QLatin1String("find_package(QtCreator COMPONENTS Core REQUIRED)\n");
+            cMakeLists += QLatin1String("find_package(Qt6 COMPONENTS Widgets REQUIRED)\n\n");
+        }
+        for (QString subDir : it.value())
+            cMakeLists += QLatin1String("add_subdirectory(%1)\n").arg(subDir);
+
+        Utils::Result<> result = writeFile(rootPath.pathAppended(it.key()).pathAppended(QLatin1String("CMakeLists.txt")), cMakeLists.toUtf8());
+        if (!result)
+            return Utils::ResultError(result.error());
+    }
+
+    for (int t = 0; t < targetCount(); t++) {
+        QString cMakeLists;
+        if (isPlugin(t)) {
+            cMakeLists += QLatin1String("add_qtc_plugin(%1\n").arg(targetName(t));
+            cMakeLists += QLatin1String("  PLUGIN_PATH\n    \"${CMAKE_SOURCE_DIR}/plugins\"\n");
+            cMakeLists += QLatin1String("  PLUGIN_DEPENDS\n    QtCreator::Core\n");
+            cMakeLists += QLatin1String("  DEPENDS\n    Qt::Widgets\n    QtCreator::ExtensionSystem\n    QtCreator::Utils\n");
+            cMakeLists += QLatin1String("  SOURCES\n");
+        } else {
+            cMakeLists += QLatin1String("add_library(%1 STATIC\n").arg(targetName(t));
+        }
+        for (QString source : sourceNames(t))
+            cMakeLists += QLatin1String("    %1\n").arg(source);
+        cMakeLists += QLatin1String(")\n");
+
+        Utils::Result<> result = writeFile(rootPath.pathAppended(targetDirectory(t)).pathAppended(QLatin1String("CMakeLists.txt")), cMakeLists.toUtf8());
+        if (result)
+            result = writeSources(rootPath, t);
+        if (!result)
+            return Utils::ResultError(result.error());
+    }
+
+    // NOTE The reply is written last, so that it is newer than the CMakeLists.txt files (otherwise Qt Creator runs CMake again).
+    Utils::Result<> result = writeCMakeReply(rootPath);
+    if (!result)
+        return Utils::ResultError(result.error());
+
+    return rootPath.pathAppended(QLatin1String("CMakeLists.txt"));
+}
+
+QJsonObject SyntheticProject::cMakeTarget(const Utils::FilePath& rootPath, int t) const
+{
+    QString name = targetName(t);
+    QString directory = targetDirectory(t);
+    Utils::FilePath pluginsPath = rootPath.pathAppended(QLatin1String("plugins"));
+
+    QJsonArray sources;
+    QJsonArray sourceIndexes;
+    for (QString source : sourceNames(t)) {
+        sourceIndexes << sources.size();
+        sources << QJsonObject({
+            {QLatin1String("path"), directory + QLatin1Char('/') + source},
+            {QLatin1String("compileGroupIndex"), 0},
+            {QLatin1String("sourceGroupIndex"), 0},
+        });
+    }
+
+    QJsonArray commands({QLatin1String("add_library")});
+    if (isPlugin(t))
+        commands << QLatin1String("add_qtc_plugin");
+
+    QJsonObject target({
+        {QLatin1String("name"), name},
+        {QLatin1String("id"), QLatin1String("%1::@%2").arg(name, cMakeId(directory))},
+        {QLatin1String("type"), isPlugin(t) ? QLatin1String("SHARED_LIBRARY") : QLatin1String("STATIC_LIBRARY")},
+        {QLatin1String("paths"), QJsonObject({
+            {QLatin1String("source"), directory},
+            {QLatin1String("build"), directory},
+        })},
+        {QLatin1String("backtrace"), 1},
+        {QLatin1String("backtraceGraph"), QJsonObject({
+            {QLatin1String("commands"), commands},
+            {QLatin1String("files"), QJsonArray({directory + QLatin1String("/CMakeLists.txt")})},
+            {QLatin1String("nodes"), QJsonArray({
+                QJsonObject({{QLatin1String("file"), 0}}),
+                QJsonObject({{QLatin1String("command"), commands.size() - 1}, {QLatin1String("file"), 0}, {QLatin1String("line"), 1}, {QLatin1String("parent"), 0}}),
+            })},
+        })},
+        {QLatin1String("sourceGroups"), QJsonArray({QJsonObject({
+            {QLatin1String("name"), QLatin1String("Source Files")},
+            {QLatin1String("sourceIndexes"), sourceIndexes},
+        })})},
+        {QLatin1String("compileGroups"), QJsonArray({QJsonObject({
+            {QLatin1String("language"), QLatin1String("CXX")},
+            {QLatin1String("sourceIndexes"), sourceIndexes},
+        })})},
+        {QLatin1String("sources"), sources},
+    });
+
+    if (isPlugin(t)) {
+        target.insert(QLatin1String("nameOnDisk"), libraryFileName(name));
+        target.insert(QLatin1String("artifacts"), QJsonArray({QJsonObject({
+            {QLatin1String("path"), pluginsPath.pathAppended(libraryFileName(name)).path()},
+        })}));
+        target.insert(QLatin1String("install"), QJsonObject({
+            {QLatin1String("prefix"), QJsonObject({{QLatin1String("path"), pluginsPath.path()}})},
+            {QLatin1String("destinations"), QJsonArray({QJsonObject({{QLatin1String("path"), pluginsPath.path()}})})},
+        }));
+    } else {
+        QString fileName = Utils::HostOsInfo::isWindowsHost() ? name + QLatin1String(".lib")
+                                                               : QLatin1String("lib") + name + QLatin1String(".a");
+        target.insert(QLatin1String("nameOnDisk"), fileName);
+        target.insert(QLatin1String("artifacts"), QJsonArray({QJsonObject({
+            {QLatin1String("path"), directory + QLatin1Char('/') + fileName},
+        })}));
+    }
+
+    return target;
+}
+
+Utils::Result<> SyntheticProject::writeCMakeReply(const Utils::FilePath& rootPath) const
+{
+    Utils::FilePath buildPath = cMakeBuildPath(rootPath);
+    Utils::FilePath replyPath = buildPath.pathAppended(QLatin1String(".cmake/api/v1/reply"));
+    Utils::Result<> result = Utils::ResultOk;
+
+    // Directories (root first, then depth first), with their targets:
+    QMap<QString, QStringList> subDirs = subDirectories();
+    QStringList directories;
+    QStringList toVisit(QString{});
+    while (!toVisit.isEmpty()) {
+        QString directory = toVisit.takeFirst();
+        directories << directory;
+        QStringList children;
+        for (QString subDir : subDirs.value(directory))
+            children << (directory.isEmpty() ? subDir : directory + QLatin1Char('/') + subDir);
+        toVisit = children + toVisit;
+    }
+
+    QJsonArray cMakeDirectories;
+    QJsonArray cMakeInputs;
+    for (QString directory : directories) {
+        QJsonArray childIndexes;
+        QJsonArray targetIndexes;
+        for (QString subDir : subDirs.value(directory))
+            childIndexes << directories.indexOf(directory.isEmpty() ? subDir : directory + QLatin1Char('/') + subDir);
+        for (int t = 0; t < targetCount(); t++) {
+            if (targetDirectory(t) == directory)
+                targetIndexes << t;
+        }
+
+        QJsonObject cMakeDirectory({
+            {QLatin1String("source"), directory.isEmpty() ? QLatin1String(".") : directory},
+            {QLatin1String("build"), directory.isEmpty() ? QLatin1String(".") : directory},
+            {QLatin1String("projectIndex"), 0},
+            {QLatin1String("minimumCMakeVersion"), QJsonObject({{QLatin1String("string"), QLatin1String("3.24")}})},
+        });
+        if (!directory.isEmpty())
+            cMakeDirectory.insert(QLatin1String("parentIndex"), directories.indexOf(directory.section(QLatin1Char('/'), 0, -2)));
+        if (!childIndexes.isEmpty())
+            cMakeDirectory.insert(QLatin1String("childIndexes"), childIndexes);
+        if (!targetIndexes.isEmpty())
+            cMakeDirectory.insert(QLatin1String("targetIndexes"), targetIndexes);
+        if (Utils::anyOf(targetIndexes, [this] (const QJsonValue& t) {return isPlugin(t.toInt());}))
+            cMakeDirectory.insert(QLatin1String("hasInstallRule"), true);
+        cMakeDirectories << cMakeDirectory;
+
+        cMakeInputs << QJsonObject({{QLatin1String("path"), directory.isEmpty() ? QLatin1String("CMakeLists.txt") : directory + QLatin1String("/CMakeLists.txt")}});
+    }
+
+    // Targets:
+    QJsonArray cMakeTargets;
+    QJsonArray allTargetIndexes;
+    for (int t = 0; t < targetCount(); t++) {
+        QString directory = targetDirectory(t);
+        QString jsonFile = QLatin1String("target-%1-Debug-%2.json").arg(targetName(t), cMakeId(directory));
+        if (result)
+            result = writeJsonFile(replyPath.pathAppended(jsonFile), cMakeTarget(rootPath, t));
+
+        cMakeTargets << QJsonObject({
+            {QLatin1String("name"), targetName(t)},
+            {QLatin1String("id"), QLatin1String("%1::@%2").arg(targetName(t), cMakeId(directory))},
+            {QLatin1String("directoryIndex"), directories.indexOf(directory)},
+            {QLatin1String("projectIndex"), 0},
+            {QLatin1String("jsonFile"), jsonFile},
+        });
+        allTargetIndexes << t;
+    }
+    if (!result)
+        return result;
+
+    QJsonArray allDirectoryIndexes;
+    for (int d = 0; d < directories.size(); d++)
+        allDirectoryIndexes << d;
+
+    QJsonObject paths({
+        {QLatin1String("source"), rootPath.path()},
+        {QLatin1String("build"), buildPath.path()},
+    });
+
+    // Code model, cache and CMake files objects:
+    QString suffix = cMakeId(rootPath.path());
+    QMap<QString, QJsonObject> objects;
+    objects.insert(QLatin1String("codemodel-v2-%1.json").arg(suffix), QJsonObject({
+        {QLatin1String("kind"), QLatin1String("codemodel")},
+        {QLatin1String("version"), version(2, 6)},
+        {QLatin1String("paths"), paths},
+        {QLatin1String("configurations"), QJsonArray({QJsonObject({
+            {QLatin1String("name"), QLatin1String("Debug")},
+            {QLatin1String("directories"), cMakeDirectories},
+            {QLatin1String("projects"), QJsonArray({QJsonObject({
+                {QLatin1String("name"), projectName},
+                {QLatin1String("directoryIndexes"), allDirectoryIndexes},
+                {QLatin1String("targetIndexes"), allTargetIndexes},
+            })})},
+            {QLatin1String("targets"), cMakeTargets},
+        })})},
+    }));
+    objects.insert(QLatin1String("cache-v2-%1.json").arg(suffix), QJsonObject({
+        {QLatin1String("kind"), QLatin1String("cache")},
+        {QLatin1String("version"), version(2, 0)},
+        {QLatin1String("entries"), QJsonArray({
+            QJsonObject({{QLatin1String("name"), QLatin1String("CMAKE_BUILD_TYPE")}, {QLatin1String("type"), QLatin1String("STRING")}, {QLatin1String("value"), QLatin1String("Debug")}, {QLatin1String("properties"), QJsonArray()}}),
+            QJsonObject({{QLatin1String("name"), QLatin1String("CMAKE_HOME_DIRECTORY")}, {QLatin1String("type"), QLatin1String("INTERNAL")}, {QLatin1String("value"), rootPath.path()}, {QLatin1String("properties"), QJsonArray()}}),
+            QJsonObject({{QLatin1String("name"), QLatin1String("CMAKE_PROJECT_NAME")}, {QLatin1String("type"), QLatin1String("STATIC")}, {QLatin1String("value"), projectName}, {QLatin1String("properties"), QJsonArray()}}),
+        })},
+    }));
+    objects.insert(QLatin1String("cmakeFiles-v1-%1.json").arg(suffix), QJsonObject({
+        {QLatin1String("kind"), QLatin1String("cmakeFiles")},
+        {QLatin1String("version"), version(1, 0)},
+        {QLatin1String("paths"), paths},
+        {QLatin1String("inputs"), cMakeInputs},
+    }));
+
+    QJsonArray responses;
+    for (auto it = objects.cbegin(); it != objects.cend(); it++) {
+        if (result)
+            result = writeJsonFile(replyPath.pathAppended(it.key()), it.value());
+        QJsonObject response({
+            {QLatin1String("kind"), it.value().value(QLatin1String("kind"))},
+            {QLatin1String("version"), it.value().value(QLatin1String("version"))},
+            {QLatin1String("jsonFile"), it.key()},
+        });
+        responses << response;
+    }
+    if (!result)
+        return result;
+
+    // Query, cache and index (written last, as CMake does):
+    QJsonArray requests;
+    for (QJsonValue response : responses)
+        requests << QJsonObject({
+            {QLatin1String("kind"), response.toObject().value(QLatin1String("kind"))},
+            {QLatin1String("version"), response.toObject().value(QLatin1String("version")).toObject().value(QLatin1String("major"))},
+        });
+    result = writeJsonFile(buildPath.pathAppended(QLatin1String(".cmake/api/v1/query/client-QtCreator/query.json")),
+                           QJsonObject({{QLatin1String("requests"), requests}}));
+    if (!result)
+        return result;
+
+    QString cMakeCache;
+    cMakeCache += QLatin1String("CMAKE_BUILD_TYPE:STRING=Debug\n");
+    cMakeCache += QLatin1String("CMAKE_CACHEFILE_DIR:INTERNAL=%1\n").arg(buildPath.path());
+    cMakeCache += QLatin1String("CMAKE_HOME_DIRECTORY:INTERNAL=%1\n").arg(rootPath.path());
+    cMakeCache += QLatin1String("CMAKE_PROJECT_NAME:STATIC=%1\n").arg(projectName);
+    result = writeFile(buildPath.pathAppended(QLatin1String("CMakeCache.txt")), cMakeCache.toUtf8());
+    if (!result)
+        return result;
+
+    QJsonObject index({
+        {QLatin1String("cmake"), QJsonObject({
+            {QLatin1String("version"), QJsonObject({
+                {QLatin1String("major"), 3}, {QLatin1String("minor"), 24}, {QLatin1String("patch"), 0},
+                {QLatin1String("string"), QLatin1String("3.24.0")}, {QLatin1String("suffix"), QString()}, {QLatin1String("isDirty"), false},
+            })},
+        })},
+        {QLatin1String("objects"), responses},
+        {QLatin1String("reply"), QJsonObject({
+            {QLatin1String("client-QtCreator"), QJsonObject({
+                {QLatin1String("query.json"), QJsonObject({
+                    {QLatin1String("requests"), requests},
+                    {QLatin1String("responses"), responses},
+                })},
+            })},
+        })},
+    });
+    QString indexName = QLatin1String("index-%1.json").arg(QDateTime::currentDateTimeUtc().toString(QLatin1String("yyyy-MM-ddThh-mm-ss-zzz0")));
+    return writeJsonFile(replyPath.pathAppended(indexName), index);
+}
+
+Utils::Result<Utils::FilePath> SyntheticProject::generateQMake(const Utils::FilePath& rootPath) const
+{
+    QMap<QString, QStringList> subDirs = subDirectories();
+
+    for (auto it = subDirs.cbegin(); it != subDirs.cend(); it++) {
+        QString name = it.key().isEmpty() ? projectName : it.key().section(QLatin1Char('/'), -1);
+        QString proFile = QLatin1String("TEMPLATE = subdirs\n\nSUBDIRS += \\\n    ");
+        proFile += it.value().join(QLatin1String(" \\\n    "));
+        proFile += QLatin1Char('\n');
+
+        Utils::Result<> result = writeFile(rootPath.pathAppended(it.key()).pathAppended(name + QLatin1String(".pro")), proFile.toUtf8());
+        if (!result)
+            return Utils::ResultError(result.error());
+    }
+
+    for (int t = 0; t < targetCount(); t++) {
+        QString proFile;
+        if (isPlugin(t)) {
+            proFile += QLatin1String("SOURCES += \\\n    %1\n\n").arg(sourceNames(t).join(QLatin1String(" \\\n    ")));
+            proFile += QLatin1String("QTCREATOR_SOURCES = $$(QTC_SOURCE)\n");
+            proFile += QLatin1String("IDE_BUILD_TREE = $$(QTC_BUILD)\n\n");
+            // NOTE Like the fixtures, use the local Qt Creator configuration if it exists.
+            proFile += QLatin1String("exists(%1) {\n    include(%1)\n}\n\n").arg(localPriPath());
+            proFile += QLatin1String("QTC_PLUGIN_NAME = %1\n").arg(targetName(t));
+            proFile += QLatin1String("QTC_PLUGIN_DEPENDS += \\\n    coreplugin\n\n");
+            proFile += QLatin1String("include($$QTCREATOR_SOURCES/src/qtcreatorplugin.pri)\n\n");
+            proFile += QLatin1String("DESTDIR = ./bin\n");
+        } else {
+            proFile += QLatin1String("TEMPLATE = lib\n");
+            proFile += QLatin1String("CONFIG += staticlib\n\n");
+            proFile += QLatin1String("SOURCES += \\\n    %1\n").arg(sourceNames(t).join(QLatin1String(" \\\n    ")));
+        }
+
+        Utils::Result<> result = writeFile(rootPath.pathAppended(targetDirectory(t)).pathAppended(targetName(t) + QLatin1String(".pro")), proFile.toUtf8());
+        if (result)
+            result = writeSources(rootPath, t);
+        if (!result)
+            return Utils::ResultError(result.error());
+    }
+
+    return rootPath.pathAppended(projectName + QLatin1String(".pro"));
+}
+
+QString SyntheticProject::localPriPath(void)
+{
+    return QDir::cleanPath(QLatin1String(TESTS_DIR "/qMake/QtCreator.local.pri"));
+}
+
+Utils::Result<> SyntheticProject::writeFile(const Utils::FilePath& filePath, const QByteArray& contents)
+{
+    Utils::Result<> result = filePath.parentDir().ensureWritableDir();
+    if (!result)
+        return result;
+
+    Utils::Result<qint64> written = filePath.writeFileContents(contents);
+    if (!written)
+        return Utils::ResultError(written.error());
+    return Utils::ResultOk;
+}
+
+Utils::Result<> SyntheticProject::writeJsonFile(const Utils::FilePath& filePath, const QJsonObject& contents)
+{
+    return writeFile(filePath, QJsonDocument(contents).toJson(QJsonDocument::Indented));
+}
+
+} // Test
+} // QtcDevPlugin
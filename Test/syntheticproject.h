@@ -0,0 +1,115 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef SYNTHETICPROJECT_H
+#define SYNTHETICPROJECT_H
+
+#include <utils/filepath.h>
+#include <utils/result.h>
+
+#include <QJsonObject>
+#include <QMap>
+#include <QStringList>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+/*!
+ * \brief The SyntheticProject class generates large project trees
+ *
+ * This class writes CMake or qmake project trees containing
+ * a configurable number of Qt Creator plugins and plain libraries,
+ * to exercise plugin discovery at scale.
+ *
+ * Targets are spread over a tree of group directories
+ * (each group directory having two sub-directories) of the requested depth.
+ * CMake trees come with a build directory containing a pre-generated
+ * CMake file-API reply, so that they can be parsed without running CMake.
+ * qmake plugins include the local Qt Creator configuration of the qmake fixtures
+ * (\c QtCreator.local.pri) when it exists, as the fixtures do.
+ */
+class SyntheticProject
+{
+public:
+    /*!
+     * \brief Generation parameters
+     */
+    struct Parameters {
+        int plugins = 1;            /*!< Number of Qt Creator plugins */
+        int libraries = 0;          /*!< Number of plain libraries */
+        int depth = 1;              /*!< Depth of the directories containing the targets (1 means directly in the root directory) */
+        int sourcesPerTarget = 1;   /*!< Number of source files in each target */
+    };
+
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new generator with the given parameters.
+     * \param parameters The generation parameters.
+     */
+    SyntheticProject(const Parameters& parameters);
+
+    /*!
+     * \brief Generate a CMake project
+     *
+     * Writes a CMake project tree and its pre-generated file-API reply.
+     * \param rootPath The directory where the project is written.
+     * \return The path to the top-level \c CMakeLists.txt or an error.
+     * \sa cMakeBuildPath()
+     */
+    Utils::Result<Utils::FilePath> generateCMake(const Utils::FilePath& rootPath) const;
+    /*!
+     * \brief Generate a qmake project
+     *
+     * Writes a qmake project tree (using \c subdirs template for group directories).
+     * \param rootPath The directory where the project is written.
+     * \return The path to the top-level project file or an error.
+     */
+    Utils::Result<Utils::FilePath> generateQMake(const Utils::FilePath& rootPath) const;
+
+    /*!
+     * \brief Build directory of a CMake project
+     *
+     * Returns the build directory containing the pre-generated file-API reply.
+     * \param rootPath The directory where the project was written.
+     * \return The path to the build directory.
+     */
+    static Utils::FilePath cMakeBuildPath(const Utils::FilePath& rootPath);
+private:
+    inline int targetCount(void) const {return mParameters.plugins + mParameters.libraries;}
+    inline bool isPlugin(int t) const {return t < mParameters.plugins;}
+    QString targetName(int t) const;
+    QString targetDirectory(int t) const;
+    QStringList sourceNames(int t) const;
+    QMap<QString, QStringList> subDirectories(void) const;
+
+    Utils::Result<> writeSources(const Utils::FilePath& rootPath, int t) const;
+    QJsonObject cMakeTarget(const Utils::FilePath& rootPath, int t) const;
+    Utils::Result<> writeCMakeReply(const Utils::FilePath& rootPath) const;
+
+    static QString localPriPath(void);
+    static Utils::Result<> writeFile(const Utils::FilePath& filePath, const QByteArray& contents);
+    static Utils::Result<> writeJsonFile(const Utils::FilePath& filePath, const QJsonObject& contents);
+
+    Parameters mParameters;
+};
+
+} // Test
+} // QtcDevPlugin
+
+#endif // SYNTHETICPROJECT_H
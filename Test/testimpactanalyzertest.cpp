@@ -0,0 +1,160 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "testimpactanalyzertest.h"
+
+#include "../testimpactanalyzer.h"
+
+#include <QtTest>
+
+#define TEST_SOURCES_DIR TESTS_DIR "/../Test"
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void TestImpactAnalyzerTest::initTestCase(void)
+{
+    QVERIFY(mBuildDir.isValid());
+
+    QFile dependencyFile(mBuildDir.filePath("qtcrunconfigurationfactorytest.cpp.o.d"));
+    QVERIFY(dependencyFile.open(QIODevice::WriteOnly | QIODevice::Text));
+    dependencyFile.write("CMakeFiles/QtcDevPlugin.dir/Test/qtcrunconfigurationfactorytest.cpp.o: \\\n");
+    dependencyFile.write("  " TEST_SOURCES_DIR "/qtcrunconfigurationfactorytest.cpp \\\n");
+    dependencyFile.write("  " TEST_SOURCES_DIR "/qtcrunconfigurationfactorytest.h \\\n");
+    dependencyFile.write("  " TEST_SOURCES_DIR "/../qtcrunconfiguration.h \\\n");
+    dependencyFile.write("  /usr/include/qt6/QtTest/QtTest relative/path\\ with\\ spaces.h\n");
+    dependencyFile.close();
+
+    dependencyFile.setFileName(mBuildDir.filePath("qtcrunconfiguration.cpp.o.d"));
+    QVERIFY(dependencyFile.open(QIODevice::WriteOnly | QIODevice::Text));
+    dependencyFile.write("CMakeFiles/QtcDevPlugin.dir/qtcrunconfiguration.cpp.o: \\\n");
+    dependencyFile.write("  " TEST_SOURCES_DIR "/../qtcrunconfiguration.cpp \\\n");
+    dependencyFile.write("  " TEST_SOURCES_DIR "/../qtcrunconfiguration.h \\\n");
+    dependencyFile.write("  " TEST_SOURCES_DIR "/../pathaspect.h\n");
+    dependencyFile.close();
+
+    // NOTE Sources of another plugin built in the same build directory.
+    dependencyFile.setFileName(mBuildDir.filePath("otherplugin.cpp.o.d"));
+    QVERIFY(dependencyFile.open(QIODevice::WriteOnly | QIODevice::Text));
+    dependencyFile.write("CMakeFiles/OtherPlugin.dir/otherplugin.cpp.o: \\\n");
+    dependencyFile.write("  /other/plugin/otherplugin.cpp \\\n");
+    dependencyFile.write("  /other/plugin/otherplugin.h\n");
+    dependencyFile.close();
+}
+
+void TestImpactAnalyzerTest::testTestFunctions_data(void)
+{
+    QTest::addColumn<Utils::FilePath>("sourceFilePath");
+    QTest::addColumn<QStringList>("testFunctions");
+
+    QTest::newRow("Source") << Utils::FilePath::fromString(TEST_SOURCES_DIR "/qtcrunconfigurationfactorytest.cpp") << QStringList();
+    QTest::newRow("Header") << Utils::FilePath::fromString(TEST_SOURCES_DIR "/qtcrunconfigurationfactorytest.h") << (QStringList() << "testOpenProjectCreate" << "testOpenProjectRestore");
+    QTest::newRow("Missing") << Utils::FilePath::fromString(TEST_SOURCES_DIR "/missing.h") << QStringList();
+}
+
+void TestImpactAnalyzerTest::testTestFunctions(void)
+{
+    QFETCH(Utils::FilePath, sourceFilePath);
+    QFETCH(QStringList, testFunctions);
+
+    QCOMPARE(Internal::TestImpactAnalyzer::testFunctions(sourceFilePath), testFunctions);
+}
+
+void TestImpactAnalyzerTest::testDirectoryTestSlots(void)
+{
+    QStringList testSlots = Internal::TestImpactAnalyzer::directoryTestSlots(Utils::FilePath::fromString(TEST_SOURCES_DIR));
+
+    QVERIFY(testSlots.contains(QLatin1String("TestImpactAnalyzerTest::testDirectoryTestSlots")));
+    QVERIFY(testSlots.indexOf(QLatin1String("QtcRunConfigurationFactoryTest::testOpenProjectCreate")) + 1 == testSlots.indexOf(QLatin1String("QtcRunConfigurationFactoryTest::testOpenProjectRestore")));
+    QVERIFY(!testSlots.contains(QLatin1String("TestImpactAnalyzerTest::initTestCase")));
+
+    QVERIFY(Internal::TestImpactAnalyzer::directoryTestSlots(Utils::FilePath::fromString(TEST_SOURCES_DIR "/missing")).isEmpty());
+}
+
+void TestImpactAnalyzerTest::testParseDependencyFile(void)
+{
+    Utils::FilePath buildDir = Utils::FilePath::fromString(mBuildDir.path());
+    Utils::FilePath source = Utils::FilePath::fromString(TEST_SOURCES_DIR "/qtcrunconfigurationfactorytest.cpp").cleanPath();
+
+    auto dependencies = Internal::TestImpactAnalyzer::parseDependencyFile(buildDir.pathAppended("qtcrunconfigurationfactorytest.cpp.o.d"), buildDir);
+    QCOMPARE(dependencies.keys(), QList<Utils::FilePath>() << source);
+    QCOMPARE(dependencies.value(source).size(), 5);
+    QVERIFY(dependencies.value(source).contains(source));
+    QVERIFY(dependencies.value(source).contains(Utils::FilePath::fromString(TEST_SOURCES_DIR "/../qtcrunconfiguration.h").cleanPath()));
+    QVERIFY(dependencies.value(source).contains(buildDir.pathAppended("relative/path with spaces.h")));
+}
+
+void TestImpactAnalyzerTest::testAffectedTestFunctions_data(void)
+{
+    QTest::addColumn< QList<Utils::FilePath> >("changedFiles");
+    QTest::addColumn<QStringList>("testFunctions");
+
+    QStringList factoryTests = QStringList() << "testOpenProjectCreate" << "testOpenProjectRestore";
+
+    QTest::newRow("No change") << QList<Utils::FilePath>() << QStringList();
+    QTest::newRow("Unrelated") << (QList<Utils::FilePath>() << Utils::FilePath::fromString(TEST_SOURCES_DIR "/../README.md")) << QStringList();
+    QTest::newRow("Other plugin") << (QList<Utils::FilePath>() << Utils::FilePath::fromString("/other/plugin/otherplugin.h")) << QStringList();
+    QTest::newRow("Not tested") << (QList<Utils::FilePath>() << Utils::FilePath::fromString(TEST_SOURCES_DIR "/../pathaspect.h")) << factoryTests;
+    QTest::newRow("Plugin source") << (QList<Utils::FilePath>() << Utils::FilePath::fromString(TEST_SOURCES_DIR "/../qtcrunconfiguration.cpp")) << factoryTests;
+    QTest::newRow("Test source") << (QList<Utils::FilePath>() << Utils::FilePath::fromString(TEST_SOURCES_DIR "/qtcrunconfigurationfactorytest.cpp")) << factoryTests;
+    QTest::newRow("Tested header") << (QList<Utils::FilePath>() << Utils::FilePath::fromString(TEST_SOURCES_DIR "/../qtcrunconfiguration.h")) << factoryTests;
+}
+
+void TestImpactAnalyzerTest::testAffectedTestFunctions(void)
+{
+    QFETCH(QList<Utils::FilePath>, changedFiles);
+    QFETCH(QStringList, testFunctions);
+
+    Internal::TestImpactAnalyzer analyzer(Utils::FilePath::fromString(TEST_SOURCES_DIR "/..").cleanPath(), Utils::FilePath::fromString(mBuildDir.path()), QLatin1String("QtcDevPlugin"));
+    std::optional<QStringList> affected = analyzer.affectedTestFunctions(changedFiles);
+    QVERIFY(affected.has_value());
+    QCOMPARE(*affected, testFunctions);
+}
+
+void TestImpactAnalyzerTest::testOtherSourceDirectory(void)
+{
+    Internal::TestImpactAnalyzer analyzer(Utils::FilePath::fromString("/missing/plugin"), Utils::FilePath::fromString(mBuildDir.path()), QLatin1String("MissingPlugin"));
+    QVERIFY(!analyzer.affectedTestFunctions(QList<Utils::FilePath>() << Utils::FilePath::fromString(TEST_SOURCES_DIR "/qtcrunconfigurationfactorytest.cpp")).has_value());
+}
+
+void TestImpactAnalyzerTest::testSelectTestFunctions(void)
+{
+    QStringList arguments = QStringList() << "-pluginpath" << "/build" << "-test" << "Plugin" << "-test" << "OtherPlugin" << "-load" << "all";
+
+    QCOMPARE(Internal::TestImpactAnalyzer::selectTestFunctions(arguments, "Plugin", QStringList() << "testFoo" << "testBar"),
+             QStringList() << "-pluginpath" << "/build" << "-test" << "Plugin,testFoo,testBar" << "-test" << "OtherPlugin" << "-load" << "all");
+    QCOMPARE(Internal::TestImpactAnalyzer::selectTestFunctions(arguments, "MissingPlugin", QStringList() << "testFoo"), arguments);
+}
+
+void TestImpactAnalyzerTest::testSkipTests(void)
+{
+    QStringList arguments = QStringList() << "-pluginpath" << "/build" << "-test" << "Plugin" << "-test" << "OtherPlugin" << "-load" << "all";
+
+    QStringList skipped = Internal::TestImpactAnalyzer::skipTests(arguments, "Plugin");
+    QCOMPARE(skipped, QStringList() << "-pluginpath" << "/build" << "-test" << "OtherPlugin" << "-load" << "all");
+    QVERIFY(Internal::TestImpactAnalyzer::hasTests(skipped));
+
+    skipped = Internal::TestImpactAnalyzer::skipTests(skipped, "OtherPlugin");
+    QCOMPARE(skipped, QStringList() << "-pluginpath" << "/build" << "-load" << "all");
+    QVERIFY(!Internal::TestImpactAnalyzer::hasTests(skipped));
+
+    QCOMPARE(Internal::TestImpactAnalyzer::skipTests(arguments, "MissingPlugin"), arguments);
+}
+
+} // Test
+} // QtcDevPlugin
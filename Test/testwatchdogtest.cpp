@@ -0,0 +1,138 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "testwatchdogtest.h"
+
+#include "../testwatchdog.h"
+
+#include <QtTest>
+
+typedef QMap<QString, int> TimeoutMap;
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void TestWatchdogTest::testParseTimeouts_data(void)
+{
+    QTest::addColumn<QString>("timeouts");
+    QTest::addColumn<TimeoutMap>("functionTimeouts");
+
+    TimeoutMap both;
+    both.insert("testRunner", 120);
+    both.insert("testOpenProject", 30);
+    TimeoutMap one;
+    one.insert("testRunner", 120);
+
+    QTest::newRow("Empty")      << ""                                      << TimeoutMap();
+    QTest::newRow("Single")     << "testRunner=120"                        << one;
+    QTest::newRow("Multiple")   << "testRunner=120,testOpenProject=30"     << both;
+    QTest::newRow("Spaces")     << " testRunner = 120 , testOpenProject=30 " << both;
+    QTest::newRow("Empty item") << "testRunner=120,,testOpenProject=30,"   << both;
+    QTest::newRow("No equal")   << "testRunner=120,testOpenProject"        << one;
+    QTest::newRow("No name")    << "testRunner=120,=30"                    << one;
+    QTest::newRow("Not number") << "testRunner=120,testOpenProject=long"   << one;
+    QTest::newRow("Negative")   << "testRunner=120,testOpenProject=-30"    << one;
+    QTest::newRow("Zero")       << "testRunner=0"                          << TimeoutMap({{"testRunner", 0}});
+}
+
+void TestWatchdogTest::testParseTimeouts(void)
+{
+    QFETCH(QString, timeouts);
+    QFETCH(TimeoutMap, functionTimeouts);
+
+    QCOMPARE(Internal::TestWatchdog::parseTimeouts(timeouts), functionTimeouts);
+}
+
+void TestWatchdogTest::testCurrentTimeout_data(void)
+{
+    QTest::addColumn<QStringList>("lines");
+    QTest::addColumn<int>("timeout");
+
+    const QString start = QLatin1String("********* Start testing of MyPlugin::Test::ModelTest *********");
+
+    QTest::newRow("Not started")        << QStringList()                                                                    << 10;
+    QTest::newRow("Start")              << (QStringList() << start)                                                         << 5;
+    QTest::newRow("First function")     << (QStringList() << start << "PASS   : MyPlugin::Test::ModelTest::initTestCase()") << 0;
+    QTest::newRow("Next function")      << (QStringList() << start << "PASS   : MyPlugin::Test::ModelTest::initTestCase()"
+                                                                   << "PASS   : MyPlugin::Test::ModelTest::testIndex()")    << 120;
+    QTest::newRow("Data row")           << (QStringList() << start << "PASS   : MyPlugin::Test::ModelTest::initTestCase()"
+                                                                   << "PASS   : MyPlugin::Test::ModelTest::testIndex()"
+                                                                   << "FAIL!  : MyPlugin::Test::ModelTest::testSort(first) 'ok' returned FALSE. ()") << 120;
+    QTest::newRow("Disabled data row")  << (QStringList() << start << "PASS   : MyPlugin::Test::ModelTest::initTestCase()"
+                                                                   << "PASS   : MyPlugin::Test::ModelTest::testIndex(first)") << 0;
+    QTest::newRow("Last function")      << (QStringList() << start << "SKIP   : MyPlugin::Test::ModelTest::testReset() Not supported") << 5;
+    QTest::newRow("Printed function")   << (QStringList() << start << "PASS   : MyPlugin::Test::ModelTest::initTestCase()"
+                                                                   << "QDEBUG : MyPlugin::Test::ModelTest::testReset() Resetting") << 30;
+    QTest::newRow("Unknown function")   << (QStringList() << start << "PASS   : MyPlugin::Test::ModelTest::testUnknown()")  << 10;
+    QTest::newRow("Unknown data row")   << (QStringList() << start << "PASS   : MyPlugin::Test::ModelTest::testUnknown(first)") << 10;
+    QTest::newRow("Unknown class")      << (QStringList() << "********* Start testing of OtherTest *********"
+                                                          << "PASS   : OtherTest::initTestCase()")                      << 10;
+}
+
+void TestWatchdogTest::testCurrentTimeout(void)
+{
+    QFETCH(QStringList, lines);
+    QFETCH(int, timeout);
+
+    TimeoutMap functionTimeouts;
+    functionTimeouts.insert("initTestCase", 5);
+    functionTimeouts.insert("testIndex", 0);
+    functionTimeouts.insert("testSort", 120);
+    functionTimeouts.insert("testReset", 30);
+    functionTimeouts.insert("cleanupTestCase", 5);
+
+    Internal::TestWatchdog watchdog(nullptr, 10, functionTimeouts);
+    watchdog.setTestSlots(QStringList() << "ModelTest::testIndex" << "ModelTest::testSort" << "ModelTest::testReset" << "ProxyTest::testIndex");
+    for (QString line : lines)
+        watchdog.handleLine(line);
+
+    QCOMPARE(watchdog.currentTimeout(), timeout);
+}
+
+void TestWatchdogTest::testCheck(void)
+{
+    TimeoutMap functionTimeouts;
+    functionTimeouts.insert("testSort", 1);
+
+    // NOTE Only function timeouts are set, the function hangs silently.
+    Internal::TestWatchdog watchdog(nullptr, 0, functionTimeouts);
+    watchdog.setTestSlots(QStringList() << "ModelTest::testIndex" << "ModelTest::testSort");
+    QSignalSpy timedOutSpy(&watchdog, &Internal::TestWatchdog::timedOut);
+
+    watchdog.handleLine(QLatin1String("********* Start testing of MyPlugin::Test::ModelTest *********"));
+    watchdog.handleLine(QLatin1String("PASS   : MyPlugin::Test::ModelTest::initTestCase()"));
+    QTest::qWait(1100);
+    watchdog.check();
+    QCOMPARE(timedOutSpy.size(), 0);
+
+    watchdog.handleLine(QLatin1String("PASS   : MyPlugin::Test::ModelTest::testIndex()"));
+    watchdog.check();
+    QCOMPARE(timedOutSpy.size(), 0);
+    QTest::qWait(1100);
+    watchdog.check();
+    QCOMPARE(timedOutSpy.size(), 1);
+    QCOMPARE(timedOutSpy.at(0).at(0).toString(), QLatin1String("testSort"));
+    QCOMPARE(timedOutSpy.at(0).at(1).toInt(), 1);
+
+    // NOTE The timeout is reported once.
+    watchdog.check();
+    QCOMPARE(timedOutSpy.size(), 1);
+}
+
+} // Test
+} // QtcDevPlugin
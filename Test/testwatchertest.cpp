@@ -0,0 +1,99 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "testwatchertest.h"
+#include "testhelper.h"
+
+#include "../qtcdevpluginconstants.h"
+#include "../testwatcher.h"
+
+#include <projectexplorer/buildconfiguration.h>
+#include <projectexplorer/buildmanager.h>
+#include <projectexplorer/projectexplorerconstants.h>
+#include <projectexplorer/projectexplorer.h>
+#include <projectexplorer/project.h>
+#include <projectexplorer/runcontrol.h>
+
+#include <utils/algorithm.h>
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void TestWatcherTest::initTestCase(void)
+{
+    Utils::FilePath projectPath(TESTS_DIR "/cMake/QtcPluginTest");
+
+    QVERIFY(removeProjectUserFiles(projectPath.absolutePath()));
+    QVERIFY(openQMakeProject(projectPath.pathAppended("CMakeLists.txt"), &mProject));
+    QVERIFY(mProject->activeBuildConfiguration() != nullptr);
+}
+
+ProjectExplorer::RunConfiguration* TestWatcherTest::testRunConfiguration(void) const
+{
+    return Utils::findOrDefault(mProject->activeBuildConfiguration()->runConfigurations(), [] (ProjectExplorer::RunConfiguration* rc) {
+        return rc->id() == Utils::Id(Constants::QtcTestRunConfigurationId);
+    });
+}
+
+void TestWatcherTest::testRunControls(void)
+{
+    Internal::TestWatcher watcher;
+    ProjectExplorer::RunConfiguration* runConfig = testRunConfiguration();
+    QVERIFY(runConfig != nullptr);
+    QVERIFY(watcher.runControl(runConfig) == nullptr);
+
+    QSignalSpy runControlStartedSpy(ProjectExplorer::ProjectExplorerPlugin::instance(),
+                                    SIGNAL(runControlStarted(ProjectExplorer::RunControl*)));
+    ProjectExplorer::ProjectExplorerPlugin::runRunConfiguration(runConfig, ProjectExplorer::Constants::NORMAL_RUN_MODE);
+    QVERIFY2(runControlStartedSpy.wait(60000), "Project takes too long to start");
+    ProjectExplorer::RunControl* runControl = runControlStartedSpy.at(0).at(0).value<ProjectExplorer::RunControl*>();
+    QCOMPARE(watcher.runControl(runConfig), runControl);
+
+    // NOTE Stopped run controls are forgotten.
+    QSignalSpy runControlStoppedSpy(runControl, SIGNAL(stopped()));
+    runControl->initiateStop();
+    QVERIFY2(runControlStoppedSpy.wait(15000), "Run control takes too long to stop");
+    QVERIFY(watcher.runControl(runConfig) == nullptr);
+}
+
+void TestWatcherTest::testIsOnlyBuilding(void)
+{
+    QVERIFY(!ProjectExplorer::BuildManager::isBuilding(mProject));
+    QVERIFY(!Internal::TestWatcher::isOnlyBuilding(mProject));
+
+    QSignalSpy buildQueueFinishedSpy(ProjectExplorer::BuildManager::instance(), SIGNAL(buildQueueFinished(bool)));
+    ProjectExplorer::BuildManager::buildProjectWithDependencies(mProject);
+    if (!ProjectExplorer::BuildManager::isBuilding(mProject))
+        QSKIP("The project could not be built");
+    QVERIFY(Internal::TestWatcher::isOnlyBuilding(mProject));
+
+    ProjectExplorer::BuildManager::cancel();
+    QVERIFY(buildQueueFinishedSpy.wait(15000) || !buildQueueFinishedSpy.isEmpty());
+    QVERIFY(!Internal::TestWatcher::isOnlyBuilding(mProject));
+}
+
+void TestWatcherTest::cleanupTestCase(void)
+{
+    if (mProject != nullptr)
+        QVERIFY(closeProject(mProject));
+}
+
+} // Test
+} // QtcDevPlugin
@@ -0,0 +1,105 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "tmpfsdirectorytest.h"
+
+#include "../tmpfsdirectory.h"
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void TmpfsDirectoryTest::testCreate(void)
+{
+    QTemporaryDir rootDir;
+    QVERIFY(rootDir.isValid());
+
+    Internal::TmpfsDirectory dir(1, rootDir.path());
+    QVERIFY(dir.path().isEmpty());
+    Utils::Result<> result = dir.create();
+    QVERIFY2(result, qPrintable(result ? QString() : result.error()));
+
+    QCOMPARE(QFileInfo(dir.path()).path(), rootDir.path());
+    QVERIFY(QFileInfo(dir.settingsPath()).isDir());
+    QVERIFY(QFileInfo(dir.cachePath()).isDir());
+    QCOMPARE(dir.sizeLimit(), (qint64) 1024 * 1024);
+
+    QString path = dir.path();
+    dir.remove();
+    QVERIFY(!QFileInfo::exists(path));
+}
+
+void TmpfsDirectoryTest::testUsage(void)
+{
+    QTemporaryDir rootDir;
+    QVERIFY(rootDir.isValid());
+
+    Internal::TmpfsDirectory dir(1, rootDir.path());
+    QCOMPARE(dir.usage(), (qint64) 0);
+    QVERIFY(dir.create());
+    QCOMPARE(dir.usage(), (qint64) 0);
+
+    QFile settingsFile(dir.settingsPath() + QLatin1String("/QtCreator.ini"));
+    QVERIFY(settingsFile.open(QIODevice::WriteOnly));
+    settingsFile.write(QByteArray(1000, 'a'));
+    settingsFile.close();
+    QDir(dir.cachePath()).mkpath(QLatin1String("QtProject/qtcreator"));
+    QFile cacheFile(dir.cachePath() + QLatin1String("/QtProject/qtcreator/index"));
+    QVERIFY(cacheFile.open(QIODevice::WriteOnly));
+    cacheFile.write(QByteArray(2000, 'b'));
+    cacheFile.close();
+
+    QCOMPARE(dir.usage(), (qint64) 3000);
+    QVERIFY(!dir.isOverLimit());
+
+    QVERIFY(cacheFile.open(QIODevice::Append));
+    cacheFile.write(QByteArray(1024 * 1024, 'c'));
+    cacheFile.close();
+    QVERIFY(dir.isOverLimit());
+}
+
+void TmpfsDirectoryTest::testSizeLimit(void)
+{
+    QTemporaryDir rootDir;
+    QVERIFY(rootDir.isValid());
+
+    QStorageInfo storage(rootDir.path());
+    int tooLarge = (int) qMin(storage.bytesAvailable() / (1024 * 1024) + 1, (qint64) std::numeric_limits<int>::max());
+    Internal::TmpfsDirectory dir(tooLarge, rootDir.path());
+    QVERIFY(!dir.create());
+    QVERIFY(dir.path().isEmpty());
+
+    Internal::TmpfsDirectory missing(1, rootDir.filePath(QLatin1String("missing")));
+    QVERIFY(!missing.create());
+}
+
+void TmpfsDirectoryTest::testAvailable(void)
+{
+    QStorageInfo storage(QLatin1String("/dev/shm"));
+    if (!storage.isValid() || (storage.fileSystemType() != "tmpfs"))
+        QSKIP("/dev/shm is not a tmpfs on this host");
+
+    QVERIFY(Internal::TmpfsDirectory::isAvailable());
+    Internal::TmpfsDirectory dir(1);
+    QVERIFY(dir.create());
+    QVERIFY(dir.path().startsWith(QLatin1String("/dev/shm/")));
+}
+
+} // Test
+} // QtcDevPlugin
@@ -0,0 +1,43 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef TMPFSDIRECTORYTEST_H
+#define TMPFSDIRECTORYTEST_H
+
+#include <QObject>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+class TmpfsDirectoryTest : public QObject
+{
+    Q_OBJECT
+public:
+    inline TmpfsDirectoryTest(QObject* parent = nullptr) :
+        QObject(parent) {}
+private Q_SLOTS:
+    void testCreate(void);
+    void testUsage(void);
+    void testSizeLimit(void);
+    void testAvailable(void);
+};
+
+} // Test
+} // QtcDevPlugin
+
+#endif // TMPFSDIRECTORYTEST_H
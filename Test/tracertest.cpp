@@ -0,0 +1,109 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "tracertest.h"
+
+#include "../tracer.h"
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void TracerTest::cleanup(void)
+{
+    // NOTE The spans recorded before the test are discarded.
+    Internal::Tracer::start(qEnvironmentVariable("QTCDEVPLUGIN_TRACE"));
+}
+
+void TracerTest::testDisabled(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString filePath = dir.filePath(QLatin1String("trace.json"));
+
+    Internal::Tracer::start(QString());
+    QVERIFY(!Internal::Tracer::isEnabled());
+    {
+        Internal::TraceSpan span("test", QLatin1String("Span"));
+    }
+    QVERIFY(Internal::Tracer::save());
+    QVERIFY(!QFile::exists(filePath));
+}
+
+void TracerTest::testSave(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString filePath = dir.filePath(QLatin1String("trace.json"));
+
+    Internal::Tracer::start(filePath);
+    QVERIFY(Internal::Tracer::isEnabled());
+    {
+        Internal::TraceSpan outer("test", QLatin1String("Outer"));
+        outer.setArgument(QLatin1String("plugins"), 2);
+        QThread::msleep(2);
+        {
+            Internal::TraceSpan inner("test", QLatin1String("Inner"));
+            QThread::msleep(2);
+        }
+        QThread::msleep(2);
+    }
+    qint64 begin = Internal::Tracer::timestamp();
+    Internal::Tracer::record("test", QLatin1String("Recorded"), begin, begin + 20);
+    QVERIFY(Internal::Tracer::save());
+
+    QFile traceFile(filePath);
+    QVERIFY(traceFile.open(QIODevice::ReadOnly));
+    QJsonParseError error;
+    QJsonDocument trace = QJsonDocument::fromJson(traceFile.readAll(), &error);
+    QVERIFY2(error.error == QJsonParseError::NoError, qPrintable(error.errorString()));
+    QVERIFY(trace.isObject());
+    QVERIFY(trace.object().value(QLatin1String("traceEvents")).isArray());
+
+    QJsonArray events = trace.object().value(QLatin1String("traceEvents")).toArray();
+    QCOMPARE(events.size(), 3);
+    for (QJsonValue event : events) {
+        QCOMPARE(event.toObject().value(QLatin1String("ph")).toString(), QLatin1String("X"));
+        QCOMPARE(event.toObject().value(QLatin1String("cat")).toString(), QLatin1String("test"));
+        QCOMPARE(event.toObject().value(QLatin1String("pid")).toInteger(), QCoreApplication::applicationPid());
+        QVERIFY(event.toObject().value(QLatin1String("tid")).isDouble());
+        QVERIFY(event.toObject().value(QLatin1String("ts")).toInteger() >= 0);
+        QVERIFY(event.toObject().value(QLatin1String("dur")).toInteger() >= 0);
+    }
+
+    // NOTE The enclosing span comes first, although it was recorded last.
+    QJsonObject outer = events.at(0).toObject();
+    QJsonObject inner = events.at(1).toObject();
+    QJsonObject recorded = events.at(2).toObject();
+    QCOMPARE(outer.value(QLatin1String("name")).toString(), QLatin1String("Outer"));
+    QCOMPARE(inner.value(QLatin1String("name")).toString(), QLatin1String("Inner"));
+    QCOMPARE(recorded.value(QLatin1String("name")).toString(), QLatin1String("Recorded"));
+
+    QVERIFY(outer.value(QLatin1String("ts")).toInteger() <= inner.value(QLatin1String("ts")).toInteger());
+    QVERIFY(inner.value(QLatin1String("ts")).toInteger() + inner.value(QLatin1String("dur")).toInteger()
+            <= outer.value(QLatin1String("ts")).toInteger() + outer.value(QLatin1String("dur")).toInteger());
+    QVERIFY(inner.value(QLatin1String("dur")).toInteger() >= 2000);
+    QVERIFY(outer.value(QLatin1String("dur")).toInteger() >= 6000);
+    QCOMPARE(outer.value(QLatin1String("args")).toObject().value(QLatin1String("plugins")).toInt(), 2);
+    QCOMPARE(recorded.value(QLatin1String("ts")).toInteger(), begin);
+    QCOMPARE(recorded.value(QLatin1String("dur")).toInteger(), (qint64) 20);
+}
+
+} // Test
+} // QtcDevPlugin
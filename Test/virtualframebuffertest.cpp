@@ -0,0 +1,98 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "virtualframebuffertest.h"
+
+#include "../virtualframebuffer.h"
+
+#include <QtTest>
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void VirtualFramebufferTest::testParseDisplayNumber_data(void)
+{
+    QTest::addColumn<QByteArray>("output");
+    QTest::addColumn<int>("displayNumber");
+
+    QTest::newRow("Empty") << QByteArray() << -1;
+    QTest::newRow("Incomplete") << QByteArray("9") << -1;
+    QTest::newRow("Complete") << QByteArray("99\n") << 99;
+    QTest::newRow("Zero") << QByteArray("0\n") << 0;
+    QTest::newRow("Trailing") << QByteArray("101\nmore") << 101;
+    QTest::newRow("Invalid") << QByteArray("display\n") << -1;
+}
+
+void VirtualFramebufferTest::testParseDisplayNumber(void)
+{
+    QFETCH(QByteArray, output);
+    QFETCH(int, displayNumber);
+
+    QCOMPARE(Internal::VirtualFramebuffer::parseDisplayNumber(output), displayNumber);
+}
+
+void VirtualFramebufferTest::testStart(void)
+{
+    if (!Internal::VirtualFramebuffer::isAvailable())
+        QSKIP("Xvfb is not available");
+
+    Internal::VirtualFramebuffer framebuffer1;
+    Internal::VirtualFramebuffer framebuffer2;
+    QSignalSpy startedSpy1(&framebuffer1, &Internal::VirtualFramebuffer::started);
+    QSignalSpy startedSpy2(&framebuffer2, &Internal::VirtualFramebuffer::started);
+    QSignalSpy failedSpy1(&framebuffer1, &Internal::VirtualFramebuffer::failed);
+    QSignalSpy failedSpy2(&framebuffer2, &Internal::VirtualFramebuffer::failed);
+    QVERIFY(framebuffer1.display().isEmpty());
+
+    // NOTE Both servers are started concurrently, they must not use the same display.
+    framebuffer1.start(std::chrono::seconds(10));
+    framebuffer2.start(std::chrono::seconds(10));
+    QVERIFY(!framebuffer1.isStarted());
+    QTRY_COMPARE_WITH_TIMEOUT(startedSpy1.size() + failedSpy1.size(), 1, 15000);
+    QTRY_COMPARE_WITH_TIMEOUT(startedSpy2.size() + failedSpy2.size(), 1, 15000);
+    QCOMPARE(failedSpy1.size(), 0);
+    QCOMPARE(failedSpy2.size(), 0);
+
+    QVERIFY(framebuffer1.isStarted());
+    QVERIFY(framebuffer2.isStarted());
+    QCOMPARE(startedSpy1.at(0).at(0).toString(), framebuffer1.display());
+    QVERIFY(framebuffer1.display() != framebuffer2.display());
+    QString socketPath = QLatin1String("/tmp/.X11-unix/X") + framebuffer1.display().mid(1);
+    QVERIFY(QFileInfo::exists(socketPath));
+
+    framebuffer1.stop();
+    QTRY_VERIFY(!QFileInfo::exists(socketPath));
+}
+
+void VirtualFramebufferTest::testWaitForStarted(void)
+{
+    if (!Internal::VirtualFramebuffer::isAvailable())
+        QSKIP("Xvfb is not available");
+
+    Internal::VirtualFramebuffer framebuffer;
+    QSignalSpy startedSpy(&framebuffer, &Internal::VirtualFramebuffer::started);
+
+    framebuffer.start(std::chrono::seconds(10));
+    QVERIFY(framebuffer.waitForStarted(std::chrono::seconds(10)));
+    QVERIFY(!framebuffer.display().isEmpty());
+    QCOMPARE(startedSpy.size(), 1);
+    QVERIFY(framebuffer.errorString().isEmpty());
+}
+
+} // Test
+} // QtcDevPlugin
@@ -0,0 +1,211 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "warmstandbytest.h"
+
+#include "../warmstandby.h"
+#include "../qtcdevpluginconstants.h"
+
+#include <utils/qtcprocess.h>
+
+#include <QtTest>
+
+#ifdef Q_OS_UNIX
+#   include <signal.h>
+#endif
+
+namespace QtcDevPlugin {
+namespace Test {
+
+void WarmStandbyTest::testFingerprint(void)
+{
+    QTemporaryDir buildDir;
+    QVERIFY(buildDir.isValid());
+    Utils::FilePath library = Utils::FilePath::fromString(buildDir.filePath(QLatin1String("libPlugin.so")));
+    Utils::FilePath other = Utils::FilePath::fromString(buildDir.filePath(QLatin1String("libOther.so")));
+    QVERIFY(library.writeFileContents(QByteArray("library")));
+    QVERIFY(other.writeFileContents(QByteArray("other")));
+
+    QList<Utils::FilePath> files = QList<Utils::FilePath>() << library << other;
+    QByteArray fingerprint = Internal::WarmStandby::fingerprint(files);
+    QVERIFY(!fingerprint.isEmpty());
+    QCOMPARE(Internal::WarmStandby::fingerprint(files), fingerprint);
+    QVERIFY(Internal::WarmStandby::fingerprint(QList<Utils::FilePath>() << library) != fingerprint);
+
+    // Size changes:
+    QVERIFY(library.writeFileContents(QByteArray("rebuilt library")));
+    QByteArray rebuiltFingerprint = Internal::WarmStandby::fingerprint(files);
+    QVERIFY(rebuiltFingerprint != fingerprint);
+
+    // Modification time changes:
+    QFile otherFile(other.toFSPathString());
+    QVERIFY(otherFile.open(QIODevice::ReadWrite));
+    QVERIFY(otherFile.setFileTime(QDateTime::currentDateTime().addSecs(60), QFileDevice::FileModificationTime));
+    otherFile.close();
+    QVERIFY(Internal::WarmStandby::fingerprint(files) != rebuiltFingerprint);
+
+    // Removal:
+    QVERIFY(library.removeFile());
+    QVERIFY(Internal::WarmStandby::fingerprint(files) != rebuiltFingerprint);
+}
+
+void WarmStandbyTest::testTake(void)
+{
+    Internal::WarmStandby::Launch launch = {
+        .command = Utils::CommandLine(Utils::FilePath::fromString(QLatin1String("qtcreator"))),
+        .environment = Utils::Environment::systemEnvironment(),
+        .workingDirectory = Utils::FilePath::fromString(QDir::tempPath()),
+        .pluginFiles = QList<Utils::FilePath>(),
+        .builtFiles = QList<Utils::FilePath>(),
+    };
+
+    // NOTE Standby instances are never started without plugin files.
+    Internal::WarmStandby::start(launch);
+
+    QByteArray output;
+    QVERIFY(Internal::WarmStandby::take(launch, &output) == nullptr);
+    QVERIFY(output.isEmpty());
+}
+
+/*!
+ * \brief Standby stub
+ *
+ * Writes a shell script which behaves as a standby instance:
+ * it prints some output and Constants::ProbeStandbyMarker, stops itself
+ * and prints more output once it is resumed.
+ * \param dir The directory where the script is written.
+ * \return The command line running the script.
+ */
+static Utils::CommandLine standbyStub(const QTemporaryDir& dir)
+{
+    Utils::FilePath script = Utils::FilePath::fromString(dir.filePath(QLatin1String("standby.sh")));
+    script.writeFileContents(QByteArray("echo loading\n"
+                                        "echo \"") + Constants::ProbeStandbyMarker + "\" >&2\n"
+                                        "kill -STOP $$\n"
+                                        "echo resumed\n");
+    return Utils::CommandLine(Utils::FilePath::fromString(QLatin1String("/bin/sh")), QStringList() << script.nativePath());
+}
+
+void WarmStandbyTest::testStandby(void)
+{
+    if (!Internal::WarmStandby::isAvailable())
+        QSKIP("Standby instances are not available on this host");
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    Utils::FilePath library = Utils::FilePath::fromString(dir.filePath(QLatin1String("libWarmStandbyTest.so")));
+    QVERIFY(library.writeFileContents(QByteArray("library")));
+
+    Internal::WarmStandby::Launch launch = {
+        .command = Utils::CommandLine(Utils::FilePath::fromString(QLatin1String("qtcreator"))),
+        .environment = Utils::Environment::systemEnvironment(),
+        .workingDirectory = Utils::FilePath::fromString(dir.path()),
+        .pluginFiles = QList<Utils::FilePath>() << library,
+        .builtFiles = QList<Utils::FilePath>(),
+    };
+    Internal::WarmStandby::start(launch, standbyStub(dir), launch.environment);
+
+    // The plugin files are shadowed while the plugins are loaded:
+    QVERIFY(!library.exists());
+    QVERIFY(library.stringAppended(QLatin1String(".del")).exists());
+    QTRY_VERIFY(Internal::WarmStandby::isReady());
+    QVERIFY(library.exists());
+    QVERIFY(!library.stringAppended(QLatin1String(".del")).exists());
+
+    QByteArray output;
+    std::shared_ptr<Utils::Process> process = Internal::WarmStandby::take(launch, &output);
+    QVERIFY(process != nullptr);
+    QVERIFY(!Internal::WarmStandby::isReady());
+    QVERIFY(output.contains("loading"));
+    QVERIFY(!output.contains(Constants::ProbeStandbyMarker));
+
+    QByteArray resumedOutput;
+    QObject::connect(process.get(), &Utils::Process::readyReadStandardOutput, this, [process, &resumedOutput] () {
+        resumedOutput += process->readAllRawStandardOutput();
+    });
+#ifdef Q_OS_UNIX
+    ::kill(process->processId(), SIGCONT);
+#endif
+    QTRY_VERIFY(resumedOutput.contains("resumed"));
+    QTRY_COMPARE(process->state(), QProcess::NotRunning);
+}
+
+void WarmStandbyTest::testDiscard(void)
+{
+    if (!Internal::WarmStandby::isAvailable())
+        QSKIP("Standby instances are not available on this host");
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    Utils::FilePath library = Utils::FilePath::fromString(dir.filePath(QLatin1String("libWarmStandbyTest.so")));
+    QVERIFY(library.writeFileContents(QByteArray("library")));
+
+    Internal::WarmStandby::Launch launch = {
+        .command = Utils::CommandLine(Utils::FilePath::fromString(QLatin1String("qtcreator"))),
+        .environment = Utils::Environment::systemEnvironment(),
+        .workingDirectory = Utils::FilePath::fromString(dir.path()),
+        .pluginFiles = QList<Utils::FilePath>() << library,
+        .builtFiles = QList<Utils::FilePath>(),
+    };
+    QByteArray output;
+
+    // Other launch parameters:
+    Internal::WarmStandby::start(launch, standbyStub(dir), launch.environment);
+    QTRY_VERIFY(Internal::WarmStandby::isReady());
+    Internal::WarmStandby::Launch otherLaunch = launch;
+    otherLaunch.command.addArg(QLatin1String("-noload"));
+    QVERIFY(Internal::WarmStandby::take(otherLaunch, &output) == nullptr);
+    QVERIFY(!Internal::WarmStandby::isReady());
+    QVERIFY(Internal::WarmStandby::take(launch, &output) == nullptr);
+
+    // Rebuilt plugin:
+    Internal::WarmStandby::start(launch, standbyStub(dir), launch.environment);
+    QTRY_VERIFY(Internal::WarmStandby::isReady());
+    QVERIFY(library.writeFileContents(QByteArray("rebuilt library")));
+    QVERIFY(Internal::WarmStandby::take(launch, &output) == nullptr);
+    QVERIFY(!Internal::WarmStandby::isReady());
+
+    // Not ready yet (the plugin files are unshadowed when discarded):
+    Internal::WarmStandby::start(launch, standbyStub(dir), launch.environment);
+    QVERIFY(!library.exists());
+    QVERIFY(Internal::WarmStandby::take(launch, &output) == nullptr);
+    QVERIFY(library.exists());
+    QVERIFY(!library.stringAppended(QLatin1String(".del")).exists());
+    QVERIFY(output.isEmpty());
+}
+
+void WarmStandbyTest::testBuiltFiles(void)
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QDir(dir.path()).mkpath(QLatin1String("build"));
+    Utils::FilePath builtLibrary = Utils::FilePath::fromString(dir.filePath(QLatin1String("build/libPlugin.so")));
+    QVERIFY(builtLibrary.writeFileContents(QByteArray("library")));
+
+    QList<Utils::FilePath> pluginFiles = QList<Utils::FilePath>() << Utils::FilePath::fromString(dir.filePath(QLatin1String("install/libPlugin.so")))
+                                                                  << Utils::FilePath::fromString(dir.filePath(QLatin1String("install/libOther.so")));
+    QStringList arguments = QStringList() << QLatin1String("-pluginpath") << dir.filePath(QLatin1String("build"))
+                                          << QLatin1String("-pluginpath") << dir.filePath(QLatin1String("missing"))
+                                          << QLatin1String("-test") << QLatin1String("Plugin");
+
+    QCOMPARE(Internal::WarmStandby::builtFiles(arguments, pluginFiles), QList<Utils::FilePath>() << builtLibrary);
+    QVERIFY(Internal::WarmStandby::builtFiles(QStringList() << QLatin1String("-test") << QLatin1String("Plugin"), pluginFiles).isEmpty());
+}
+
+} // Test
+} // QtcDevPlugin
@@ -0,0 +1,96 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "filestatuscache.h"
+
+#include <QFileInfo>
+
+#include <algorithm>
+
+namespace QtcDevPlugin {
+namespace Widgets {
+
+QMutex FileStatusCache::sMutex;
+QHash<QString, FileStatusCache::Entry> FileStatusCache::sEntries;
+
+FileStatusCache::Status FileStatusCache::status(const QString& path, Permissions permissions)
+{
+    Status status;
+    QDeadlineTimer deadline(TimeToLive);
+    bool cached = false;
+    {
+        QMutexLocker locker(&sMutex);
+        auto it = sEntries.constFind(path);
+        if ((it != sEntries.constEnd()) && !it->deadline.hasExpired()) {
+            if (!it->status.exists || ((it->status.checked & permissions) == permissions))
+                return it->status;
+            // NOTE Only the permissions which were not checked are queried, the entry keeps its deadline.
+            status = it->status;
+            deadline = it->deadline;
+            cached = true;
+        } else {
+            // NOTE Nothing exists under an ancestor which does not exist or is not a directory.
+            for (QString ancestor = parentPath(path); !ancestor.isEmpty(); ancestor = parentPath(ancestor)) {
+                it = sEntries.constFind(ancestor);
+                if ((it != sEntries.constEnd()) && !it->deadline.hasExpired() && !it->status.isDir)
+                    return Status();
+            }
+        }
+    }
+
+    // NOTE QFileInfo caches the result of stat(), but each permission is checked with access() on Unix.
+    QFileInfo info(path);
+    if (!cached) {
+        status.exists = info.exists();
+        status.isFile = status.exists && info.isFile();
+        status.isDir = status.exists && info.isDir();
+    }
+    if (status.exists) {
+        Permissions unchecked = permissions & ~status.checked;
+        if (unchecked & ReadPermission)
+            status.isReadable = info.isReadable();
+        if (unchecked & WritePermission)
+            status.isWritable = info.isWritable();
+        if (unchecked & ExecutePermission)
+            status.isExecutable = info.isExecutable();
+        status.checked |= unchecked;
+    }
+
+    QMutexLocker locker(&sMutex);
+    sEntries.removeIf([] (const QHash<QString, Entry>::iterator& it) {
+        return it->deadline.hasExpired();
+    });
+    sEntries.insert(path, {status, deadline});
+    return status;
+}
+
+QString FileStatusCache::parentPath(const QString& path)
+{
+    int from = ((path.size() > 1) && (path.endsWith(QLatin1Char('/')) || path.endsWith(QLatin1Char('\\')))) ? -2 : -1;
+    int index = std::max(path.lastIndexOf(QLatin1Char('/'), from), path.lastIndexOf(QLatin1Char('\\'), from));
+    return (index <= 0) ? QString() : path.left(index);
+}
+
+void FileStatusCache::clear(void)
+{
+    QMutexLocker locker(&sMutex);
+    sEntries.clear();
+}
+
+} // Widgets
+} // QtcDevPlugin
@@ -0,0 +1,132 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef FILESTATUSCACHE_H
+#define FILESTATUSCACHE_H
+
+#include <QDeadlineTimer>
+#include <QFlags>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+
+namespace QtcDevPlugin {
+namespace Widgets {
+
+/*!
+ * \brief The FileStatusCache class caches the status of recently validated paths
+ *
+ * This class queries the file system once for the existence and type of a path,
+ * checks only the permissions which are requested
+ * (on Unix, each permission is checked with a separate system call)
+ * and keeps the result for a short time (see TimeToLive).
+ * The cache is shared by all the instances of FileTypeValidatingLineEdit
+ * (e.g. the working directory and the settings path of a run configuration),
+ * and may be used from any thread.
+ *
+ * Entries are also shared between paths with a common prefix: a path under a recently queried
+ * ancestor which does not exist (or is not a directory) does not exist either,
+ * hence the file system is not queried for it (e.g. while the user types a new path).
+ *
+ * \sa FileTypeValidatingLineEdit
+ */
+class FileStatusCache
+{
+public:
+    /*!
+     * \enum Permission
+     * \brief Permission of the user on a path
+     * \sa Permissions
+     */
+    enum Permission {
+        NoPermission = 0x0,         /*!< No permission */
+        ReadPermission = 0x1,       /*!< The path is readable */
+        WritePermission = 0x2,      /*!< The path is writable */
+        ExecutePermission = 0x4,    /*!< The path is executable */
+    };
+    /*!
+     * \typedef Permissions
+     * \brief Permission flags
+     *
+     * An OR-ed combination of the flags in enum Permission.
+     */
+    Q_DECLARE_FLAGS(Permissions, Permission);
+#ifdef DOXYGEN
+    typedef QFlags<Permission> Permissions;
+#endif
+
+    /*!
+     * \brief The Status struct describes the status of a path in the file system
+     */
+    struct Status {
+        bool exists = false;        /*!< Whether the path exists */
+        bool isFile = false;        /*!< Whether the path is a regular file (or a link to a regular file) */
+        bool isDir = false;         /*!< Whether the path is a directory (or a link to a directory) */
+        bool isReadable = false;    /*!< Whether the path is readable by the user */
+        bool isWritable = false;    /*!< Whether the path is writable by the user */
+        bool isExecutable = false;  /*!< Whether the path is executable by the user */
+        Permissions checked;        /*!< The permissions which were checked (the others are \c false) */
+    };
+
+    static const int TimeToLive = 2000; /*!< The time during which a status is valid (in milliseconds) */
+
+    /*!
+     * \brief Status of a path
+     *
+     * Returns the status of the given path, from the cache if it
+     * (or an ancestor which does not exist) was queried recently, from the file system otherwise.
+     * The permissions which were not checked recently are checked in the file system.
+     * \param path A path.
+     * \param permissions The permissions to check.
+     * \return The status of the path.
+     */
+    static Status status(const QString& path, Permissions permissions = NoPermission);
+    /*!
+     * \brief Clear the cache
+     *
+     * Removes all the entries in the cache.
+     */
+    static void clear(void);
+private:
+    /*!
+     * \brief Parent path
+     *
+     * Returns the path of the parent directory of the given path, without querying the file system.
+     * \param path A path.
+     * \return The path of the parent directory (empty for a root or relative path without parent).
+     */
+    static QString parentPath(const QString& path);
+
+    /*!
+     * \brief An entry in the cache
+     */
+    struct Entry {
+        Status status;              /*!< The status of the path */
+        QDeadlineTimer deadline;    /*!< The expiration deadline of the entry */
+    };
+
+    static QMutex sMutex;                   /*!< Protects the cache */
+    static QHash<QString, Entry> sEntries;  /*!< The entries in the cache */
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(FileStatusCache::Permissions)
+
+} // Widgets
+} // QtcDevPlugin
+
+#endif // FILESTATUSCACHE_H
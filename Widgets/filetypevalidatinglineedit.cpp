@@ -17,10 +17,14 @@
  */
 
 #include "filetypevalidatinglineedit.h"
+#include "filestatuscache.h"
+#include "../qtcdevpluginlogging.h"
 
+#include <utils/async.h>
 #include <utils/macroexpander.h>
 
 #include <QtCore>
+#include <QtWidgets>
 
 namespace QtcDevPlugin {
 namespace Widgets {
@@ -31,6 +35,17 @@ FileTypeValidatingLineEdit::FileTypeValidatingLineEdit(QWidget* parent) :
     mAccepted |= AcceptsFiles;
     mAccepted |= RequireReadable;
 
+    mValidationTimer.setSingleShot(true);
+    mValidationTimer.setInterval(250);
+    connect(&mValidationTimer, &QTimer::timeout,
+            this, &FileTypeValidatingLineEdit::startValidation);
+    connect(&mValidationWatcher, &QFutureWatcher<Utils::Result<>>::finished,
+            this, &FileTypeValidatingLineEdit::finishValidation);
+
+    setButtonIcon(Utils::FancyLineEdit::Right, style()->standardIcon(QStyle::SP_BrowserReload));
+    setButtonToolTip(Utils::FancyLineEdit::Right, tr("Validating path..."));
+    setButtonVisible(Utils::FancyLineEdit::Right, false);
+
     setValidationFunction([this] (const QString& value) {
         if ((mAccepted & AcceptEmpty) && value.isEmpty())
             return Utils::ResultOk;
@@ -38,23 +53,72 @@ FileTypeValidatingLineEdit::FileTypeValidatingLineEdit(QWidget* parent) :
         QString expandedValue = value;
         if (mMacroExpander != NULL)
             expandedValue = mMacroExpander->expand(value);
-        qDebug() << expandedValue;
-
-        bool exists = QFileInfo::exists(expandedValue);
-        if (!(mAccepted & AcceptNew) && !exists)
-            return Utils::makeResult(false, tr("File \"%1\" does not exist").arg(expandedValue));
-
-        Utils::Result<> result = Utils::ResultOk;
-        if (result)
-            result = validateName(expandedValue);
-        if (exists && result)
-            result = validateType(expandedValue);
-        if (exists && result)
-            result = validatePermissions(expandedValue);
-        return result;
+        qCDebug(validationLog) << expandedValue;
+
+        // NOTE The result is used only once, so that the file system is checked again on next validation.
+        if (mValidationResult.has_value() && (expandedValue == mValidatedPath)) {
+            Utils::Result<> result = *mValidationResult;
+            mValidationResult.reset();
+            return result;
+        }
+
+        mPendingPath = expandedValue;
+        mValidationTimer.start();
+        setPending(true);
+        return Utils::makeResult(false, tr("Validating path..."));
     });
 }
 
+void FileTypeValidatingLineEdit::startValidation(void)
+{
+    mValidatingPath = mPendingPath;
+    // NOTE The previous validation cannot be interrupted, but its result will not be delivered.
+    mValidationWatcher.setFuture(Utils::asyncRun(&FileTypeValidatingLineEdit::validatePath, mValidatingPath, mAccepted, mRequiredExtensions));
+}
+
+void FileTypeValidatingLineEdit::finishValidation(void)
+{
+    if (mValidationWatcher.isCanceled() || (mValidatingPath != mPendingPath))
+        return;
+
+    mValidatedPath = mValidatingPath;
+    mValidationResult = mValidationWatcher.result();
+    if (!mValidationTimer.isActive())
+        setPending(false);
+    validate();
+    if (!isValidating())
+        emit validated(isValid());
+}
+
+void FileTypeValidatingLineEdit::setPending(bool pending)
+{
+    setButtonVisible(Utils::FancyLineEdit::Right, pending);
+}
+
+Utils::Result<> FileTypeValidatingLineEdit::validatePath(const QString& path, Accepts accepted, const QStringList& requiredExtensions)
+{
+    FileStatusCache::Permissions permissions;
+    if (accepted & RequireReadable)
+        permissions |= FileStatusCache::ReadPermission;
+    if (accepted & RequireWritable)
+        permissions |= FileStatusCache::WritePermission;
+    if (accepted & RequireExecutable)
+        permissions |= FileStatusCache::ExecutePermission;
+
+    FileStatusCache::Status status = FileStatusCache::status(path, permissions);
+    if (!(accepted & AcceptNew) && !status.exists)
+        return Utils::makeResult(false, tr("File \"%1\" does not exist").arg(path));
+
+    Utils::Result<> result = Utils::ResultOk;
+    if (result)
+        result = validateName(path, requiredExtensions);
+    if (status.exists && result)
+        result = validateType(status, accepted);
+    if (status.exists && result)
+        result = validatePermissions(status, accepted);
+    return result;
+}
+
 void FileTypeValidatingLineEdit::manageAcceptFlags(Accept flag, bool enable)
 {
     if (enable)
@@ -63,12 +127,12 @@ void FileTypeValidatingLineEdit::manageAcceptFlags(Accept flag, bool enable)
         mAccepted &= ~Accepts(flag);
 }
 
-Utils::Result<> FileTypeValidatingLineEdit::validateName(const QString& value) const
+Utils::Result<> FileTypeValidatingLineEdit::validateName(const QString& value, const QStringList& requiredExtensions)
 {
-    if (mRequiredExtensions.isEmpty())
+    if (requiredExtensions.isEmpty())
         return Utils::ResultOk;
 
-    for (QString ext : mRequiredExtensions) {
+    for (QString ext : requiredExtensions) {
         if (value.endsWith(QLatin1Char('.') + ext))
             return Utils::ResultOk;
     }
@@ -76,27 +140,23 @@ Utils::Result<> FileTypeValidatingLineEdit::validateName(const QString& value) c
     return Utils::makeResult(false, tr("File does not have one of the required extensions."));
 }
 
-Utils::Result<> FileTypeValidatingLineEdit::validateType(const QString& value) const
+Utils::Result<> FileTypeValidatingLineEdit::validateType(const FileStatusCache::Status& status, Accepts accepted)
 {
-    QFileInfo info(value);
-
-    if (info.isFile() && !(mAccepted & AcceptsFiles))
+    if (status.isFile && !(accepted & AcceptsFiles))
         return Utils::makeResult(false, tr("Regular files are not accepted"));
-    if (info.isDir() && !(mAccepted & AcceptsDirectories))
+    if (status.isDir && !(accepted & AcceptsDirectories))
         return Utils::makeResult(false, tr("Directories are not accepted"));
 
     return Utils::ResultOk;
 }
 
-Utils::Result<> FileTypeValidatingLineEdit::validatePermissions(const QString& value) const
+Utils::Result<> FileTypeValidatingLineEdit::validatePermissions(const FileStatusCache::Status& status, Accepts accepted)
 {
-    QFileInfo info(value);
-
-    if ((mAccepted & RequireReadable) && !info.isReadable())
+    if ((accepted & RequireReadable) && !status.isReadable)
         return Utils::makeResult(false, tr("File must be readable"));
-    if ((mAccepted & RequireWritable) && !info.isWritable())
+    if ((accepted & RequireWritable) && !status.isWritable)
         return Utils::makeResult(false, tr("File must be writable"));
-    if ((mAccepted & RequireExecutable) && !info.isExecutable())
+    if ((accepted & RequireExecutable) && !status.isExecutable)
         return Utils::makeResult(false, tr("File must be executable"));
 
     return Utils::ResultOk;
@@ -19,9 +19,15 @@
 #ifndef FILETYPEVALIDATINGLINEEDIT_H
 #define FILETYPEVALIDATINGLINEEDIT_H
 
+#include "filestatuscache.h"
+
 #include <utils/fancylineedit.h>
 
+#include <QFutureWatcher>
 #include <QStringList>
+#include <QTimer>
+
+#include <optional>
 
 namespace Utils {
     class MacroExpander;
@@ -41,6 +47,12 @@ namespace Widgets {
  *
  * It supports Qt Creator macro expander (which allows to add variables in the given paths).
  *
+ * The file system is never accessed from the GUI thread: the path is validated
+ * in a worker thread once the user stops typing for validationDelay() milliseconds.
+ * While a validation is pending (see isValidating()), the line edit is not valid
+ * and shows a pending indicator. Results for a text which has been modified since
+ * the validation started are discarded.
+ *
  * \note When I get these features in Qt Creator FileNameValidatingLineEdit, I will sure use it.
  */
 class FileTypeValidatingLineEdit : public Utils::FancyLineEdit
@@ -270,7 +282,79 @@ public:
      * \sa setMacroExpander()
      */
     inline Utils::MacroExpander* macroExpander(void) const {return mMacroExpander;}
+
+    /*!
+     * \brief Set the validation delay
+     *
+     * Sets the delay between the last modification of the text and its validation.
+     * \param msec The validation delay (in milliseconds).
+     * \sa validationDelay()
+     */
+    inline void setValidationDelay(int msec) {mValidationTimer.setInterval(msec);}
+    /*!
+     * \brief The validation delay
+     *
+     * Returns the delay between the last modification of the text and its validation.
+     * \return The validation delay (in milliseconds).
+     * \sa setValidationDelay()
+     */
+    inline int validationDelay(void) const {return mValidationTimer.interval();}
+    /*!
+     * \brief Whether a validation is pending
+     *
+     * Tells whether the path is being validated in a worker thread.
+     * \return \c true if a validation is pending, \c false otherwise.
+     */
+    inline bool isValidating(void) const {return mValidationTimer.isActive() || mValidationWatcher.isRunning();}
+signals:
+    /*!
+     * \brief Validation finished
+     *
+     * This signal is emitted when the validation of the current text finishes,
+     * even if the validity did not change (contrary to \c validChanged()).
+     * \param valid Whether the current text is valid.
+     * \sa isValidating()
+     */
+    void validated(bool valid);
+private slots:
+    /*!
+     * \brief Start validation
+     *
+     * Starts validating the pending path in a worker thread.
+     * \sa finishValidation()
+     */
+    void startValidation(void);
+    /*!
+     * \brief Finish validation
+     *
+     * Stores the result of the validation (unless it is stale)
+     * and updates the line edit accordingly.
+     * \sa startValidation()
+     */
+    void finishValidation(void);
 private:
+    /*!
+     * \brief Validate a path
+     *
+     * Runs all the checks on the given path.
+     * The status of the path is shared by all the checks and only the required permissions are checked (see FileStatusCache).
+     * This function does not access any member, so that it can safely run in a worker thread.
+     * \param path The path to validate (with expanded macros).
+     * \param accepted The accept flags.
+     * \param requiredExtensions The list of required extensions.
+     * \return \c ResultOk if the given path is valid,
+     * otherwise an error result with a descriptive error message.
+     * \sa validateName(), validateType(), validatePermissions()
+     */
+    static Utils::Result<> validatePath(const QString& path, Accepts accepted, const QStringList& requiredExtensions);
+    /*!
+     * \brief Set pending state
+     *
+     * Shows or hides the pending indicator.
+     * \param pending Whether a validation is pending.
+     */
+    void setPending(bool pending);
+
     /*!
      * \brief Check name and extension of the given path.
      *
@@ -279,30 +363,33 @@ private:
      *  \li Otherwise, the path is valid only if it ends with a dot followed by one of the extensions.
      *
      * \param value The path to validate.
+     * \param requiredExtensions The list of required extensions.
      * \return \c ResultOk if the given string is valid,
      * otherwise an error result with a descriptive error message.
      */
-    Utils::Result<> validateName(const QString& value) const;
+    static Utils::Result<> validateName(const QString& value, const QStringList& requiredExtensions);
     /*!
      * \brief Check the type of the given path.
      *
      * Check that the type of the given path corresponds to an acceptable type
      * (\see acceptFiles(), acceptDirectories())
-     * \param value The path to validate.
+     * \param status The status of the path to validate.
+     * \param accepted The accept flags.
      * \return \c ResultOk if the given string is valid,
      * otherwise an error result with a descriptive error message.
      */
-    Utils::Result<> validateType(const QString& value) const;
+    static Utils::Result<> validateType(const FileStatusCache::Status& status, Accepts accepted);
     /*!
      * \brief Check permissions of the given path.
      *
      * Check that the requirements on the permission (\see requiredPermissions())
      * of the given path are enforced.
-     * \param value The path to validate.
+     * \param status The status of the path to validate.
+     * \param accepted The accept flags.
      * \return \c ResultOk if the given string is valid,
      * otherwise an error result with a descriptive error message.
      */
-    Utils::Result<> validatePermissions(const QString& value) const;
+    static Utils::Result<> validatePermissions(const FileStatusCache::Status& status, Accepts accepted);
 
     /*!
      * \brief Manage accept flags
@@ -316,6 +403,13 @@ private:
     Utils::MacroExpander* mMacroExpander;   /*!< Qt Creator macro expander (or \c NULL if none) */
     QStringList mRequiredExtensions;        /*!< The internal list of required extensions */
     Accepts mAccepted;                      /*!< Accept flags */
+
+    QTimer mValidationTimer;                                /*!< Delays validation until the user stops typing */
+    QFutureWatcher<Utils::Result<>> mValidationWatcher;     /*!< Watches the validation running in a worker thread */
+    QString mPendingPath;                                   /*!< The path waiting for validation (with expanded macros) */
+    QString mValidatingPath;                                /*!< The path being validated (with expanded macros) */
+    QString mValidatedPath;                                 /*!< The last validated path (with expanded macros) */
+    std::optional<Utils::Result<>> mValidationResult;       /*!< The result of the validation of the last validated path */
 };
 
 } // Widgets
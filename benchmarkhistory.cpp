@@ -0,0 +1,160 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "benchmarkhistory.h"
+#include "qtcdevpluginlogging.h"
+
+#include <QtCore>
+
+#include <algorithm>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief Median of a list of values
+ *
+ * Computes the median of the given values.
+ * \param values A non-empty list of values.
+ * \return The median of the values.
+ */
+static double median(QList<double> values)
+{
+    std::sort(values.begin(), values.end());
+    int middle = values.size() / 2;
+    if (values.size() % 2 == 0)
+        return (values.at(middle - 1) + values.at(middle)) / 2;
+    return values.at(middle);
+}
+
+BenchmarkHistory::BenchmarkHistory(const Utils::FilePath& historyFilePath, const QString& buildKey) :
+    mHistoryFilePath(historyFilePath), mBuildKey(buildKey)
+{
+    if (!mHistoryFilePath.isFile())
+        return;
+
+    Utils::Result<QByteArray> contents = mHistoryFilePath.fileContents();
+    if (!contents) {
+        qCWarning(testsLog) << "Could not read benchmark history:" << contents.error();
+        return;
+    }
+    mHistory = QJsonDocument::fromJson(*contents).object();
+}
+
+QList<BenchmarkHistory::Result> BenchmarkHistory::parse(const QString& output)
+{
+    static const QRegularExpression nameRegExp(QLatin1String("^RESULT\\s*:\\s*(.+):\\s*$"));
+    static const QRegularExpression valueRegExp(QLatin1String("^\\s*([0-9.,eE+-]+)\\s+(.+?)\\s+per iteration\\b"));
+
+    QList<Result> results;
+    QString name;
+
+    for (QString line : output.split(QLatin1Char('\n'))) {
+        QRegularExpressionMatch nameMatch = nameRegExp.match(line);
+        if (nameMatch.hasMatch()) {
+            name = nameMatch.captured(1);
+            continue;
+        }
+        if (name.isEmpty())
+            continue;
+
+        QRegularExpressionMatch valueMatch = valueRegExp.match(line);
+        if (valueMatch.hasMatch()) {
+            bool ok;
+            double value = valueMatch.captured(1).remove(QLatin1Char(',')).toDouble(&ok);
+            if (ok)
+                results << Result{name, valueMatch.captured(2), value};
+        }
+        if (!line.trimmed().isEmpty())
+            name.clear();
+    }
+
+    return results;
+}
+
+QList<BenchmarkHistory::Regression> BenchmarkHistory::regressions(const QList<Result>& results, double threshold) const
+{
+    QList<Regression> regressions;
+    QJsonObject benchmarks = mHistory.value(mBuildKey).toObject();
+
+    for (Result result : results) {
+        QJsonObject benchmark = benchmarks.value(result.name).toObject();
+        if (benchmark.value(QLatin1String("unit")).toString() != result.unit)
+            continue;
+
+        QList<double> values;
+        for (QJsonValue value : benchmark.value(QLatin1String("values")).toArray())
+            values << value.toDouble();
+        if (values.isEmpty())
+            continue;
+
+        double baseline = median(values);
+        if (baseline <= 0)
+            continue;
+        double change = 100. * (result.value - baseline) / baseline;
+        if (change <= threshold)
+            continue;
+
+        // NOTE The deviation cannot be estimated reliably with less than 3 values.
+        if (values.size() >= 3) {
+            QList<double> deviations;
+            for (double value : values)
+                deviations << qAbs(value - baseline);
+            double sigma = 1.4826 * median(deviations);
+            if (result.value - baseline <= 3 * sigma)
+                continue;
+        }
+
+        regressions << Regression{result, baseline, change};
+    }
+
+    return regressions;
+}
+
+void BenchmarkHistory::append(const QList<Result>& results)
+{
+    QJsonObject benchmarks = mHistory.value(mBuildKey).toObject();
+
+    for (Result result : results) {
+        QJsonObject benchmark = benchmarks.value(result.name).toObject();
+        QJsonArray values;
+        if (benchmark.value(QLatin1String("unit")).toString() == result.unit)
+            values = benchmark.value(QLatin1String("values")).toArray();
+
+        values.append(result.value);
+        while (values.size() > MaxResults)
+            values.removeFirst();
+
+        benchmark.insert(QLatin1String("unit"), result.unit);
+        benchmark.insert(QLatin1String("values"), values);
+        benchmarks.insert(result.name, benchmark);
+    }
+
+    mHistory.insert(mBuildKey, benchmarks);
+}
+
+bool BenchmarkHistory::save(void) const
+{
+    Utils::Result<qint64> result = mHistoryFilePath.writeFileContents(QJsonDocument(mHistory).toJson(QJsonDocument::Compact));
+    if (!result)
+        qCWarning(testsLog) << "Could not save benchmark history:" << result.error();
+    return (bool) result;
+}
+
+} // Internal
+} // QtcDevPlugin
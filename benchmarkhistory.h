@@ -0,0 +1,127 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef BENCHMARKHISTORY_H
+#define BENCHMARKHISTORY_H
+
+#include <utils/filepath.h>
+
+#include <QJsonObject>
+#include <QStringList>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The BenchmarkHistory class stores the results of \c QBENCHMARK tests
+ *
+ * This class parses the results of \c QBENCHMARK tests from QtTest output
+ * and keeps the last results of each benchmark in a compact JSON file.
+ * New results can be compared to the history to find out
+ * statistically significant regressions.
+ *
+ * The history file contains an object for each plugin (identified by its build key),
+ * in which an object is associated with each benchmark. This object contains the
+ * unit of the results and the list of the last results (oldest first).
+ */
+class BenchmarkHistory
+{
+public:
+    /*!
+     * \brief The result of a benchmark
+     *
+     * This structure stores the result of a benchmark, as printed by QtTest.
+     */
+    typedef struct {
+        QString name;   /*!< The name of the benchmark (test function and data tag) */
+        QString unit;   /*!< The unit of the result (e.g. \c msecs, <tt>CPU ticks</tt>) */
+        double value;   /*!< The result per iteration */
+    } Result;
+
+    /*!
+     * \brief A benchmark regression
+     *
+     * This structure describes a benchmark whose result is significantly
+     * worse than the results in the history.
+     */
+    typedef struct {
+        Result result;      /*!< The new result of the benchmark */
+        double baseline;    /*!< The baseline (median of the results in the history) */
+        double change;      /*!< The relative change to the baseline (in percent) */
+    } Regression;
+
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new history for a plugin and loads it from the history file.
+     * \param historyFilePath The path to the history file.
+     * \param buildKey The build key of the plugin.
+     * \sa save()
+     */
+    BenchmarkHistory(const Utils::FilePath& historyFilePath, const QString& buildKey);
+
+    /*!
+     * \brief Parse benchmark results
+     *
+     * Parses the benchmark results in the given QtTest output.
+     * \param output The output of QtTest (in plain text format).
+     * \return The list of the benchmark results in the output.
+     */
+    static QList<Result> parse(const QString& output);
+
+    /*!
+     * \brief Find regressions
+     *
+     * Compares the given results to the history and returns the significant regressions.
+     * A result is considered as a regression if it exceeds the median of the results in
+     * the history by more than the given threshold and by more than three robust standard
+     * deviations (estimated from the median absolute deviation) when the history
+     * contains enough results.
+     * \param results The new benchmark results.
+     * \param threshold The minimum relative change to report a regression (in percent).
+     * \return The list of the regressions.
+     */
+    QList<Regression> regressions(const QList<Result>& results, double threshold) const;
+    /*!
+     * \brief Append results
+     *
+     * Appends the given results to the history.
+     * Only the last results of each benchmark are kept.
+     * \param results The new benchmark results.
+     * \sa save()
+     */
+    void append(const QList<Result>& results);
+    /*!
+     * \brief Save the history
+     *
+     * Saves the history in the history file.
+     * \return \c true if the history could be saved, \c false otherwise.
+     */
+    bool save(void) const;
+
+    static const int MaxResults = 20;    /*!< The maximum number of results kept for each benchmark */
+private:
+    Utils::FilePath mHistoryFilePath;   /*!< The path to the history file */
+    QString mBuildKey;                  /*!< The build key of the plugin */
+    QJsonObject mHistory;               /*!< The history (for all plugins) */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // BENCHMARKHISTORY_H
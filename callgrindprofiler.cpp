@@ -0,0 +1,231 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "callgrindprofiler.h"
+#include "qtcdevpluginconstants.h"
+#include "qtcdevpluginlogging.h"
+#include "benchmarkhistory.h"
+#include "testimpactanalyzer.h"
+
+#include <utils/aspects.h>
+#include <utils/environment.h>
+
+#include <QtCore>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+// NOTE Test slots have no arguments, unlike most functions of Qt whose names start with "test".
+const QString CallgrindProfiler::FallbackFunctions = QLatin1String("*::test*()");
+
+QStringList CallgrindProfiler::patterns(const QString& functions)
+{
+    QStringList ans;
+    for (QString pattern : functions.split(QLatin1Char(','), Qt::SkipEmptyParts)) {
+        if (!pattern.trimmed().isEmpty())
+            ans << pattern.trimmed();
+    }
+    return ans;
+}
+
+QStringList CallgrindProfiler::testSlotPatterns(const QList<Utils::FilePath>& sourceDirectories)
+{
+    static const QRegularExpression qtTestRegExp(QLatin1String("#\\s*include\\s*[<\"](QtTest|qtest\\.h|QtTest/QtTest|QTest)[>\"]"));
+
+    auto isTestFile = [] (const Utils::FilePath& filePath) {
+        Utils::Result<QByteArray> contents = filePath.fileContents();
+        return contents && qtTestRegExp.match(QString::fromUtf8(*contents)).hasMatch();
+    };
+
+    QStringList ans;
+    Utils::FileFilter headerFilter(QStringList() << QLatin1String("*.h"), QDir::Files, QDirIterator::Subdirectories);
+    for (Utils::FilePath sourceDirectory : sourceDirectories) {
+        for (Utils::FilePath headerFilePath : sourceDirectory.dirEntries(headerFilter)) {
+            // NOTE Test headers often only include QObject, whereas test sources include QtTest.
+            Utils::FilePath sourceFilePath = headerFilePath.parentDir().pathAppended(headerFilePath.completeBaseName() + QLatin1String(".cpp"));
+            if (!isTestFile(headerFilePath) && !isTestFile(sourceFilePath))
+                continue;
+            for (QString testSlot : TestImpactAnalyzer::testSlots(headerFilePath)) {
+                QString pattern = QString(QLatin1String("*%1()")).arg(testSlot);
+                if (!ans.contains(pattern))
+                    ans << pattern;
+            }
+        }
+    }
+    return ans;
+}
+
+QMap<QString, qint64> CallgrindProfiler::inclusiveCosts(const QByteArray& profile, const QStringList& patterns)
+{
+    QList<QRegularExpression> regExps;
+    for (QString pattern : patterns)
+        regExps << QRegularExpression(QRegularExpression::wildcardToRegularExpression(pattern, QRegularExpression::NonPathWildcardConversion));
+
+    QMap<QString, qint64> costs;
+    QMap<QString, QString> names;
+    int positionCount = 1;
+    QString function;
+    bool measured = false;
+
+    for (QByteArray rawLine : profile.split('\n')) {
+        QString line = QString::fromUtf8(rawLine).trimmed();
+        if (line.isEmpty() || line.startsWith(QLatin1Char('#')))
+            continue;
+
+        if (line.startsWith(QLatin1String("positions:"))) {
+            positionCount = line.mid(10).split(QLatin1Char(' '), Qt::SkipEmptyParts).size();
+            continue;
+        }
+
+        // NOTE Function names are compressed: "(id) name" on first use, then "(id)".
+        if (line.startsWith(QLatin1String("fn=")) || line.startsWith(QLatin1String("cfn="))) {
+            static const QRegularExpression nameRegExp(QLatin1String("^c?fn=(\\(\\d+\\))?\\s*(.*)$"));
+            QRegularExpressionMatch match = nameRegExp.match(line);
+            QString name = match.captured(2);
+            if (!match.captured(1).isEmpty()) {
+                if (name.isEmpty())
+                    name = names.value(match.captured(1));
+                else
+                    names.insert(match.captured(1), name);
+            }
+            if (line.startsWith(QLatin1String("fn="))) {
+                function = name;
+                measured = !function.endsWith(QLatin1String("_data()")) && std::any_of(regExps.cbegin(), regExps.cend(), [name] (const QRegularExpression& regExp) {
+                    return regExp.match(name).hasMatch();
+                });
+            }
+            continue;
+        }
+
+        // NOTE Cost lines start with positions (possibly relative), other lines are "key=value" or "key: value".
+        QChar first = line.at(0);
+        if (!first.isDigit() && (first != QLatin1Char('+')) && (first != QLatin1Char('-')) && (first != QLatin1Char('*')))
+            continue;
+        if (!measured)
+            continue;
+
+        // NOTE The cost line following a "calls=" line holds the inclusive cost of the call.
+        QStringList fields = line.split(QLatin1Char(' '), Qt::SkipEmptyParts);
+        if (fields.size() > positionCount)
+            costs[function] += fields.at(positionCount).toLongLong();
+    }
+
+    return costs;
+}
+
+Tasking::Group CallgrindProfiler::receipe(ProjectExplorer::RunControl* runControl)
+{
+    Utils::FilePath valgrindPath = Utils::Environment::systemEnvironment().searchInPath(QLatin1String("valgrind"));
+    if (valgrindPath.isEmpty()) {
+        return Tasking::Group {
+            Tasking::onGroupSetup([runControl] () {
+                runControl->postMessage(tr("Could not find valgrind in PATH."), Utils::ErrorMessageFormat);
+                return Tasking::SetupResult::StopWithError;
+            })
+        };
+    }
+
+    auto functionsData = static_cast<const Utils::StringAspect::Data*>(runControl->aspectData(Utils::Id(Constants::CallgrindFunctionsId)));
+    QStringList functions = patterns((functionsData != nullptr) ? functionsData->value : QString());
+    if (functions.isEmpty()) {
+        auto testedSourcesData = static_cast<const Utils::StringListAspect::Data*>(runControl->aspectData(Utils::Id(Constants::TestedSourcesId)));
+        QList<Utils::FilePath> sourceDirectories;
+        for (int p = 1; (testedSourcesData != nullptr) && (p < testedSourcesData->value.size()); p += 2)
+            sourceDirectories << Utils::FilePath::fromString(testedSourcesData->value.at(p));
+        functions = testSlotPatterns(sourceDirectories);
+    }
+    if (functions.isEmpty())
+        functions = patterns(FallbackFunctions);
+    auto thresholdData = static_cast<const Utils::IntegerAspect::Data*>(runControl->aspectData(Utils::Id(Constants::BenchmarkThresholdId)));
+    const int threshold = (thresholdData != nullptr) ? thresholdData->value : 5;
+
+    const Utils::FilePath callgrindDir = runControl->buildDirectory().pathAppended(QLatin1String(".qtcdevplugin-callgrind"));
+    const Utils::FilePath profilePath = callgrindDir.pathAppended(QString(QLatin1String("callgrind-%1.out")).arg(QDateTime::currentDateTime().toString(QLatin1String("yyyyMMdd-hhmmss"))));
+
+    // NOTE The process receipe reads the command line of the run control, hence it is wrapped here.
+    Utils::CommandLine command(valgrindPath, QStringList() << QLatin1String("--tool=callgrind")
+                                                           << QString(QLatin1String("--callgrind-out-file=%1")).arg(profilePath.nativePath())
+                                                           << QLatin1String("--collect-atstart=no"));
+    for (QString function : functions)
+        command.addArg(QString(QLatin1String("--toggle-collect=%1")).arg(function));
+    command.addCommandLineAsArgs(runControl->commandLine());
+    qCDebug(launchLog) << "Callgrind command:" << command.toUserOutput();
+    runControl->setCommandLine(command);
+
+    const auto onReport = [runControl, profilePath, functions, threshold] () {
+        Utils::Result<QByteArray> profile = profilePath.fileContents();
+        if (!profile) {
+            runControl->postMessage(tr("Could not read Callgrind profile: %1").arg(profile.error()), Utils::ErrorMessageFormat);
+            return Tasking::DoneResult::Error;
+        }
+
+        QMap<QString, qint64> costs = inclusiveCosts(*profile, functions);
+        if (costs.isEmpty()) {
+            runControl->postMessage(tr("No test function matching %1 was executed.").arg(functions.join(QLatin1String(", "))), Utils::ErrorMessageFormat);
+            return Tasking::DoneResult::Error;
+        }
+
+        QList<BenchmarkHistory::Result> results;
+        for (auto it = costs.constBegin(); it != costs.constEnd(); ++it) {
+            results << BenchmarkHistory::Result {
+                .name = it.key(),
+                .unit = QLatin1String("instructions"),
+                .value = (double) it.value(),
+            };
+            runControl->postMessage(tr("%1: %L2 instructions").arg(it.key()).arg(it.value()), Utils::NormalMessageFormat);
+        }
+
+        BenchmarkHistory history(runControl->buildDirectory().pathAppended(QLatin1String(".qtcdevplugin-callgrind.json")), runControl->buildKey());
+        QList<BenchmarkHistory::Regression> regressions = history.regressions(results, threshold);
+        for (BenchmarkHistory::Regression regression : regressions) {
+            runControl->postMessage(tr("Instruction count regression: %1 %L2 instructions (baseline: %L3, %4%)")
+                                        .arg(regression.result.name)
+                                        .arg((qint64) regression.result.value)
+                                        .arg((qint64) regression.baseline)
+                                        .arg(regression.change, 0, 'f', 1),
+                                    Utils::ErrorMessageFormat);
+        }
+        runControl->postMessage(tr("%1 test function(s) measured, %2 regression(s) found. Callgrind profile: %3")
+                                    .arg(results.size())
+                                    .arg(regressions.size())
+                                    .arg(profilePath.toUserOutput()),
+                                regressions.isEmpty() ? Utils::NormalMessageFormat : Utils::ErrorMessageFormat);
+
+        history.append(results);
+        history.save();
+        return Tasking::DoneResult::Success;
+    };
+
+    return Tasking::Group {
+        // NOTE The profile is analysed even when some tests fail.
+        Tasking::continueOnError,
+        Tasking::onGroupSetup([runControl, callgrindDir] () {
+            Utils::Result<> result = callgrindDir.ensureWritableDir();
+            if (!result) {
+                runControl->postMessage(tr("Could not create Callgrind profile directory: %1").arg(result.error()), Utils::ErrorMessageFormat);
+                return Tasking::SetupResult::StopWithError;
+            }
+            return Tasking::SetupResult::Continue;
+        }),
+        ProjectExplorer::processRecipe(runControl),
+        Tasking::Sync(onReport)
+    };
+}
+
+} // Internal
+} // QtcDevPlugin
@@ -0,0 +1,102 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef CALLGRINDPROFILER_H
+#define CALLGRINDPROFILER_H
+
+#include <projectexplorer/runcontrol.h>
+
+#include <utils/filepath.h>
+
+#include <QCoreApplication>
+#include <QMap>
+#include <QStringList>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The CallgrindProfiler class counts the instructions executed by plugin tests
+ *
+ * This class runs the test instance of Qt Creator of a run control
+ * under <tt>valgrind --tool=callgrind</tt>. Event collection is disabled at startup
+ * and toggled (using \c --toggle-collect) when entering and leaving the test functions,
+ * which are given as wildcard patterns. By default, the test slots declared in
+ * the sources of the tested plugins are used (see testSlotPatterns()), so that
+ * functions called by the tests whose names start with \c test
+ * (e.g. \c QWidget::testAttribute_helper()) do not toggle collection.
+ *
+ * Once the instance exits, the inclusive instruction count of each test function
+ * is read from the Callgrind profile. As instruction counts hardly depend on the load
+ * of the machine, they are compared to the history of previous runs (with BenchmarkHistory)
+ * and regressions are reported in the output of the run control.
+ *
+ * The profiles are stored in the \c .qtcdevplugin-callgrind directory of the build directory,
+ * so that they can be further analysed with \c kcachegrind.
+ */
+class CallgrindProfiler
+{
+    Q_DECLARE_TR_FUNCTIONS(QtcDevPlugin::Internal::CallgrindProfiler)
+public:
+    /*!
+     * \brief Test function patterns
+     *
+     * Splits comma separated wildcard patterns.
+     * \param functions Comma separated wildcard patterns.
+     * \return The list of patterns.
+     */
+    static QStringList patterns(const QString& functions);
+    /*!
+     * \brief Test slot patterns
+     *
+     * Finds the test slots declared in the test headers of the given source directories
+     * (i.e. the headers of test classes, see TestImpactAnalyzer::testSlots())
+     * and returns wildcard patterns matching these slots (e.g. <tt>*ModelTest::testIndex()</tt>).
+     * \param sourceDirectories The directories containing the sources of the tested plugins.
+     * \return The list of patterns.
+     */
+    static QStringList testSlotPatterns(const QList<Utils::FilePath>& sourceDirectories);
+    /*!
+     * \brief Inclusive instruction counts
+     *
+     * Parses a Callgrind profile and computes the inclusive instruction count
+     * of each function matching one of the given patterns.
+     * QtTest data functions (whose name ends with \c _data) are ignored.
+     * \param profile The contents of the Callgrind profile.
+     * \param patterns The wildcard patterns of the test functions.
+     * \return The inclusive instruction counts associated to the function names.
+     */
+    static QMap<QString, qint64> inclusiveCosts(const QByteArray& profile, const QStringList& patterns);
+
+    /*!
+     * \brief Receipe for profiling
+     *
+     * Returns the tasks running the test instance of the run control
+     * under Callgrind and reporting the instruction counts of test functions.
+     * \param runControl The run control.
+     * \return The tasks to profile the tests.
+     */
+    static Tasking::Group receipe(ProjectExplorer::RunControl* runControl);
+
+    static const QString FallbackFunctions; /*!< The patterns of the test functions when no test slot is found */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // CALLGRINDPROFILER_H
@@ -20,9 +20,12 @@
 #define CMAKEQTCRUNCONFIGURATIONFACTORY_H
 
 #include "qtcdevpluginconstants.h"
+#include "qtcdevpluginlogging.h"
+#include "tracer.h"
 
 #include "qtcrunconfiguration.h"
 #include "qtctestrunconfiguration.h"
+#include "qtctestallrunconfiguration.h"
 #include "qtcdevpluginconstants.h"
 
 #include <projectexplorer/projectexplorerconstants.h>
@@ -39,7 +42,6 @@
 #include <utils/algorithm.h>
 
 #include <QtCore>
-#include <QtDebug>
 
 #include <optional>
 
@@ -68,7 +70,9 @@ namespace Internal {
  * \tparam RunConfiguration The run configuration type which is produced by the factory.
  * The type must have the following static functions:
  *   - id(): Returns the run configuration id;
- *   - displayNamePattern(): Returns the pattern used for the run configuration display name.
+ *   - displayNamePattern(): Returns the pattern used for the run configuration display name;
+ *   - aggregatesPlugins(): Whether a single run configuration is created for all the plugins
+ *     (in which case the type must also have the static function \c aggregateBuildTargetInfo()).
  *
  * \sa QtcRunConfiguration
  */
@@ -86,6 +90,7 @@ private:
         Utils::FilePath projectFilePath;    /*!< Path to the Qt Creator plugin project file */
         Utils::FilePath targetFilePath;     /*!< Path to the built Qt Creator plugin target file */
         Utils::FilePath targetBuildPath;    /*!< CMake build path for the Qt Creator plugin target */
+        QStringList artifactFilePaths;      /*!< Paths to the built artifacts of the Qt Creator plugin target (see PluginInstaller) */
     } QtcPluginInfo;
 public:
     /*!
@@ -179,8 +184,11 @@ CMakeQtcRunConfigurationFactory<RunConfiguration>::CMakeQtcRunConfigurationFacto
 template <class RunConfiguration>
 QList<ProjectExplorer::RunConfigurationCreationInfo> CMakeQtcRunConfigurationFactory<RunConfiguration>::availableCreators(ProjectExplorer::BuildConfiguration* bc) const
 {
+    TraceSpan span("discovery", QLatin1String("CMake available creators"));
+    span.setArgument(QLatin1String("runConfiguration"), RunConfiguration::id().toString());
+
     QList<ProjectExplorer::RunConfigurationCreationInfo> creators;
-    qDebug() << "availableCreators()" << isReady(bc->project());
+    qCDebug(discoveryLog) << "availableCreators()" << isReady(bc->project());
 
     if (bc->buildSystem() == nullptr)
         return creators;
@@ -189,22 +197,28 @@ QList<ProjectExplorer::RunConfigurationCreationInfo> CMakeQtcRunConfigurationFac
 
     auto buildInfos = bc->buildSystem()->applicationTargets();
     auto qtcPluginInfos = qtCreatorPlugins(bc);
+    QStringList pluginBuildKeys;
     for (ProjectExplorer::BuildTargetInfo info : buildInfos)
-        qDebug() << "BuildTargetInfo:" << info.displayName << info.buildKey << info.projectFilePath << info.workingDirectory << info.targetFilePath;
+        qCDebug(discoveryLog) << "BuildTargetInfo:" << info.displayName << info.buildKey << info.projectFilePath << info.workingDirectory << info.targetFilePath;
     for (QString pluginName: qtcPluginInfos.keys()) {
         ProjectExplorer::BuildTargetInfo info = bc->buildSystem()->buildTarget(pluginName);
 
         if (info.buildKey != pluginName) {
-            qDebug() << __func__ << "Creating:" << qtcPluginInfos.value(pluginName).projectFilePath << qtcPluginInfos.value(pluginName).targetFilePath << qtcPluginInfos.value(pluginName).targetBuildPath;
+            qCDebug(discoveryLog) << __func__ << "Creating:" << qtcPluginInfos.value(pluginName).projectFilePath << qtcPluginInfos.value(pluginName).targetFilePath << qtcPluginInfos.value(pluginName).targetBuildPath;
 
             info.displayName = pluginName;
             info.buildKey = pluginName;
             info.projectFilePath = qtcPluginInfos.value(pluginName).projectFilePath;
             info.targetFilePath = qtcPluginInfos.value(pluginName).targetFilePath;
             info.workingDirectory = qtcPluginInfos.value(pluginName).targetBuildPath;
+            info.additionalData = qtcPluginInfos.value(pluginName).artifactFilePaths;
             buildInfos << info;
         }
 
+        pluginBuildKeys << info.buildKey;
+        if constexpr (RunConfiguration::aggregatesPlugins())
+            continue;
+
         ProjectExplorer::RunConfigurationCreationInfo creator;
         creator.factory = this;
         creator.buildKey = info.buildKey;
@@ -212,6 +226,24 @@ QList<ProjectExplorer::RunConfigurationCreationInfo> CMakeQtcRunConfigurationFac
 
         creators << creator;
     }
+
+    if constexpr (RunConfiguration::aggregatesPlugins()) {
+        // NOTE Aggregating a single plugin is useless.
+        if (pluginBuildKeys.size() > 1) {
+            ProjectExplorer::BuildTargetInfo info = RunConfiguration::aggregateBuildTargetInfo(bc, pluginBuildKeys);
+            buildInfos = Utils::filtered(buildInfos, [info] (const ProjectExplorer::BuildTargetInfo& buildInfo) {
+                return buildInfo.buildKey != info.buildKey;
+            });
+            buildInfos << info;
+
+            ProjectExplorer::RunConfigurationCreationInfo creator;
+            creator.factory = this;
+            creator.buildKey = info.buildKey;
+            creator.displayName = RunConfiguration::displayNamePattern().arg(info.displayName);
+
+            creators << creator;
+        }
+    }
     bc->buildSystem()->setApplicationTargets(buildInfos);
 
     return creators;
@@ -226,7 +258,7 @@ Utils::FilePath CMakeQtcRunConfigurationFactory<RunConfiguration>::cMakeApiPath(
         return Utils::FilePath();
 
     Utils::FilePath apiDirectory = project->activeBuildConfiguration()->buildDirectory().pathAppended(".cmake/api/v1/reply");
-    qDebug() << "CMake API dir:" << apiDirectory;
+    qCDebug(discoveryLog) << "CMake API dir:" << apiDirectory;
     return apiDirectory;
 }
 
@@ -237,15 +269,18 @@ Utils::FilePath CMakeQtcRunConfigurationFactory<RunConfiguration>::cMakeTargetFi
     if (!apiPath.isDir())
         return Utils::FilePath();
 
+    TraceSpan span("discovery", QLatin1String("CMake reply enumeration"));
+    span.setArgument(QLatin1String("target"), targetName);
+
     Utils::FilePath cMakeTargetFilePath;
     Utils::FileFilter cMakeCacheFilter(QStringList() << QLatin1String("target-%1-*.json").arg(targetName), QDir::Files);
     for (Utils::FilePath file : apiPath.dirEntries(cMakeCacheFilter, QDir::Time)) {
         if (!cMakeTargetFilePath.isEmpty())
-            qWarning() << "Multiple target files. Using newest one";
+            qCWarning(discoveryLog) << "Multiple target files. Using newest one";
         cMakeTargetFilePath = file;
     }
 
-    qDebug() << "CMake target path for" << targetName << ":" << cMakeTargetFilePath;
+    qCDebug(discoveryLog) << "CMake target path for" << targetName << ":" << cMakeTargetFilePath;
     return cMakeTargetFilePath;
 }
 
@@ -277,6 +312,9 @@ std::optional<typename CMakeQtcRunConfigurationFactory<RunConfiguration>::QtcPlu
     if (!cMakeTargetFilePath.isFile())
         return std::nullopt;
 
+    TraceSpan span("discovery", QLatin1String("CMake target parse"));
+    span.setArgument(QLatin1String("file"), cMakeTargetFilePath.fileName());
+
     Utils::Result<QByteArray> cMakeTargetData = cMakeTargetFilePath.fileContents();
     QTC_CHECK_RESULT(cMakeTargetData);
     QJsonObject cMakeTargetFile = QJsonDocument::fromJson(*cMakeTargetData).object();
@@ -291,7 +329,7 @@ std::optional<typename CMakeQtcRunConfigurationFactory<RunConfiguration>::QtcPlu
         return std::nullopt;
 
     if (cMakeTargetFile.value(QLatin1String("artifacts")).toArray().size() > 1)
-        qWarning() << "More than one artifact in " << cMakeTargetFilePath;
+        qCWarning(discoveryLog) << "More than one artifact in " << cMakeTargetFilePath;
 
     Utils::FilePath projectFilePath = bc->project()->projectFilePath().parentDir();
     QString subProjectPath = cMakeTargetFile.value(QLatin1String("paths")).toObject()
@@ -302,15 +340,24 @@ std::optional<typename CMakeQtcRunConfigurationFactory<RunConfiguration>::QtcPlu
     Utils::FilePath targetFilePath = Utils::FilePath::fromString(cMakeTargetFile.value(QLatin1String("artifacts")).toArray()
                                                                                 .at(0).toObject()
                                                                                 .value(QLatin1String("path")).toString());
-    Utils::FilePath targetInstallPath = Utils::FilePath::fromString(cMakeTargetFile.value(QLatin1String("install")).toObject()
-                                                                                   .value(QLatin1String("destinations")).toArray()
-                                                                                   .at(0).toObject()
-                                                                                   .value(QLatin1String("path")).toString());
+    QJsonObject install = cMakeTargetFile.value(QLatin1String("install")).toObject();
+    // NOTE Relative destinations are relative to the install prefix.
+    Utils::FilePath targetInstallPath = Utils::FilePath::fromString(install.value(QLatin1String("prefix")).toObject()
+                                                                           .value(QLatin1String("path")).toString())
+                                            .resolvePath(install.value(QLatin1String("destinations")).toArray()
+                                                                .at(0).toObject()
+                                                                .value(QLatin1String("path")).toString());
+
+    // NOTE Artifact paths are relative to the build directory.
+    QStringList artifactFilePaths;
+    for (QJsonValue artifact : cMakeTargetFile.value(QLatin1String("artifacts")).toArray())
+        artifactFilePaths << bc->buildDirectory().resolvePath(artifact.toObject().value(QLatin1String("path")).toString()).toFSPathString();
 
     return std::make_optional<QtcPluginInfo>({
         .projectFilePath = projectFilePath,
         .targetFilePath = targetInstallPath.pathAppended(targetFilePath.fileName()),
         .targetBuildPath = bc->buildDirectory(),
+        .artifactFilePaths = artifactFilePaths,
     });
 }
 
@@ -326,7 +373,7 @@ QMap<QString, typename CMakeQtcRunConfigurationFactory<RunConfiguration>::QtcPlu
     for (ProjectExplorer::Node* child : root->nodes()) {
         if (child->displayName().contains(QLatin1String("_autogen"), Qt::CaseSensitive))
             continue;
-        qDebug() << child->displayName() << child->isProjectNodeType() << child->isFolderNodeType() << child->isVirtualFolderType() << child->isGenerated();
+        qCDebug(discoveryLog) << child->displayName() << child->isProjectNodeType() << child->isFolderNodeType() << child->isVirtualFolderType() << child->isGenerated();
         if (QString::compare(child->displayName(), QLatin1String("CMakeLists.txt"), Qt::CaseSensitive) == 0)
             continue;
 
@@ -341,7 +388,7 @@ QMap<QString, typename CMakeQtcRunConfigurationFactory<RunConfiguration>::QtcPlu
         }
     }
 
-    qDebug() << "Plugin names:" << qtcPlugins.keys().join(QLatin1String(", "));
+    qCDebug(discoveryLog) << "Plugin names:" << qtcPlugins.keys().join(QLatin1String(", "));
 
     return qtcPlugins;
 }
@@ -0,0 +1,296 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "heapprofiler.h"
+#include "qtcdevpluginconstants.h"
+#include "qtcdevpluginlogging.h"
+
+#include <utils/aspects.h>
+#include <utils/environment.h>
+#include <utils/qtcprocess.h>
+
+#include <QtCore>
+
+#include <cmath>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+HeapProfiler::HeapProfiler(const QStringList& pluginFileNames) :
+    mPluginFileNames(pluginFileNames), mSection(NoSection), mEntryCost(-1),
+    mTotal({0, 0, 0, 0}), mPlugin({0, 0, 0, 0})
+{
+}
+
+void HeapProfiler::addOutput(const QByteArray& output)
+{
+    mBuffer.append(output);
+
+    int begin = 0;
+    int end = mBuffer.indexOf('\n', begin);
+    while (end >= 0) {
+        parseLine(QString::fromUtf8(mBuffer.mid(begin, end - begin)));
+        begin = end + 1;
+        end = mBuffer.indexOf('\n', begin);
+    }
+    mBuffer.remove(0, begin);
+}
+
+void HeapProfiler::finish(void)
+{
+    if (!mBuffer.isEmpty())
+        parseLine(QString::fromUtf8(mBuffer));
+    mBuffer.clear();
+    endEntry();
+}
+
+qint64 HeapProfiler::parseBytes(const QString& size)
+{
+    static const QRegularExpression sizeRegExp(QLatin1String("^(\\d+(?:\\.\\d+)?)([KMGT]?)i?B?$"));
+    QRegularExpressionMatch match = sizeRegExp.match(size.trimmed());
+    if (!match.hasMatch())
+        return -1;
+
+    // NOTE heaptrack uses decimal units.
+    int exponent = match.captured(2).isEmpty() ? 0 : QString(QLatin1String("KMGT")).indexOf(match.captured(2)) + 1;
+    return std::llround(match.captured(1).toDouble() * std::pow(1000., exponent));
+}
+
+void HeapProfiler::parseLine(const QString& line)
+{
+    static const QMap<QString, Section> sections = {
+        {QLatin1String("MOST CALLS TO ALLOCATION FUNCTIONS"), CallsSection},
+        {QLatin1String("PEAK MEMORY CONSUMERS"), PeakSection},
+        {QLatin1String("MEMORY LEAKS"), LeaksSection},
+        {QLatin1String("MOST TEMPORARY ALLOCATIONS"), TemporarySection},
+    };
+
+    if (line.trimmed().isEmpty()) {
+        endEntry();
+        return;
+    }
+
+    if (!line.at(0).isSpace()) {
+        endEntry();
+
+        if (sections.contains(line.trimmed())) {
+            mSection = sections.value(line.trimmed());
+            return;
+        }
+
+        // NOTE Entries start with their cost (e.g. "1.20M peak memory consumed over 12 calls from").
+        static const QRegularExpression entryRegExp(QLatin1String("^(\\S+)\\s.*\\sfrom:?$"));
+        QRegularExpressionMatch entryMatch = entryRegExp.match(line);
+        if ((mSection != NoSection) && entryMatch.hasMatch()) {
+            mEntryCost = ((mSection == CallsSection) || (mSection == TemporarySection))
+                ? entryMatch.captured(1).toLongLong()
+                : parseBytes(entryMatch.captured(1));
+            return;
+        }
+
+        // NOTE The summary follows the sections.
+        static const QRegularExpression totalRegExp(QLatin1String("^(calls to allocation functions|temporary memory allocations|peak heap memory consumption|total memory leaked):\\s*(\\S+)"));
+        QRegularExpressionMatch totalMatch = totalRegExp.match(line);
+        if (totalMatch.hasMatch()) {
+            mSection = NoSection;
+            if (totalMatch.captured(1) == QLatin1String("calls to allocation functions"))
+                mTotal.calls = totalMatch.captured(2).toLongLong();
+            else if (totalMatch.captured(1) == QLatin1String("temporary memory allocations"))
+                mTotal.temporary = totalMatch.captured(2).toLongLong();
+            else if (totalMatch.captured(1) == QLatin1String("peak heap memory consumption"))
+                mTotal.peak = parseBytes(totalMatch.captured(2));
+            else
+                mTotal.leaked = parseBytes(totalMatch.captured(2));
+        }
+        return;
+    }
+
+    if (mEntryCost < 0)
+        return;
+
+    // NOTE Frames are printed as the function name followed by indented "at <file>:<line>" and "in <library>" lines.
+    QString frame = line.trimmed();
+    if (frame.startsWith(QLatin1String("at ")))
+        return;
+    if (frame.startsWith(QLatin1String("in "))) {
+        QString library = QFileInfo(frame.mid(3).trimmed()).fileName();
+        if (mPluginFunction.isEmpty() && mPluginFileNames.contains(library))
+            mPluginFunction = mFunction.isEmpty() ? QString(QLatin1String("[%1]")).arg(library) : mFunction;
+        return;
+    }
+    mFunction = frame;
+}
+
+void HeapProfiler::endEntry(void)
+{
+    if ((mEntryCost >= 0) && !mPluginFunction.isEmpty()) {
+        Costs& site = mSites[mPluginFunction];
+        qint64 Costs::* member = nullptr;
+        switch (mSection) {
+        case CallsSection:
+            member = &Costs::calls;
+            break;
+        case PeakSection:
+            member = &Costs::peak;
+            break;
+        case LeaksSection:
+            member = &Costs::leaked;
+            break;
+        case TemporarySection:
+            member = &Costs::temporary;
+            break;
+        default:
+            break;
+        }
+        if (member != nullptr) {
+            site.*member += mEntryCost;
+            mPlugin.*member += mEntryCost;
+        }
+    }
+
+    mEntryCost = -1;
+    mFunction.clear();
+    mPluginFunction.clear();
+}
+
+QStringList HeapProfiler::report(int count) const
+{
+    QStringList lines;
+    QLocale locale = QLocale::system();
+
+    auto percent = [] (qint64 value, qint64 total) {
+        return (total > 0) ? QString::number(100. * value / total, 'f', 1) : QString(QLatin1String("-"));
+    };
+
+    lines << tr("Calls to allocation functions: %1 of %2 (%3%) from the plugin(s).")
+                 .arg(mPlugin.calls).arg(mTotal.calls).arg(percent(mPlugin.calls, mTotal.calls));
+    lines << tr("Temporary allocations: %1 of %2 (%3%) from the plugin(s).")
+                 .arg(mPlugin.temporary).arg(mTotal.temporary).arg(percent(mPlugin.temporary, mTotal.temporary));
+    lines << tr("Peak heap consumption: %1 of %2 (%3%) from the plugin(s).")
+                 .arg(locale.formattedDataSize(mPlugin.peak)).arg(locale.formattedDataSize(mTotal.peak)).arg(percent(mPlugin.peak, mTotal.peak));
+    lines << tr("Leaked memory: %1 of %2 (%3%) from the plugin(s).")
+                 .arg(locale.formattedDataSize(mPlugin.leaked)).arg(locale.formattedDataSize(mTotal.leaked)).arg(percent(mPlugin.leaked, mTotal.leaked));
+
+    if (mSites.isEmpty())
+        return lines;
+
+    QStringList functions = mSites.keys();
+    std::stable_sort(functions.begin(), functions.end(), [this] (const QString& f1, const QString& f2) {
+        const Costs c1 = mSites.value(f1);
+        const Costs c2 = mSites.value(f2);
+        if (c1.peak != c2.peak)
+            return c1.peak > c2.peak;
+        return c1.calls > c2.calls;
+    });
+    lines << tr("Top allocation sites of the plugin(s) (peak, calls, temporary, leaked):");
+    for (QString function : functions.mid(0, count)) {
+        const Costs costs = mSites.value(function);
+        lines << QString(QLatin1String("  %1 %2 %3 %4 %5"))
+                     .arg(locale.formattedDataSize(costs.peak), 10)
+                     .arg(costs.calls, 8)
+                     .arg(costs.temporary, 8)
+                     .arg(locale.formattedDataSize(costs.leaked), 10)
+                     .arg(function);
+    }
+
+    return lines;
+}
+
+Tasking::Group HeapProfiler::receipe(ProjectExplorer::RunControl* runControl)
+{
+    Utils::FilePath heaptrackPath = Utils::Environment::systemEnvironment().searchInPath(QLatin1String("heaptrack"));
+    Utils::FilePath printPath = Utils::Environment::systemEnvironment().searchInPath(QLatin1String("heaptrack_print"));
+    if (heaptrackPath.isEmpty() || printPath.isEmpty()) {
+        return Tasking::Group {
+            Tasking::onGroupSetup([runControl] () {
+                runControl->postMessage(tr("Could not find heaptrack and heaptrack_print in PATH."), Utils::ErrorMessageFormat);
+                return Tasking::SetupResult::StopWithError;
+            })
+        };
+    }
+
+    QStringList pluginFileNames;
+    if (!runControl->targetFilePath().isEmpty())
+        pluginFileNames << runControl->targetFilePath().fileName();
+    auto testedPluginsData = static_cast<const Utils::StringListAspect::Data*>(runControl->aspectData(Utils::Id(Constants::TestedPluginsId)));
+    if (testedPluginsData != nullptr) {
+        for (QString path : testedPluginsData->value)
+            pluginFileNames << Utils::FilePath::fromString(path).fileName();
+    }
+
+    const Utils::FilePath heaptrackDir = runControl->buildDirectory().pathAppended(QLatin1String(".qtcdevplugin-heaptrack"));
+    const QString baseName = QString(QLatin1String("heaptrack-%1")).arg(QDateTime::currentDateTime().toString(QLatin1String("yyyyMMdd-hhmmss")));
+
+    // NOTE The process receipe reads the command line of the run control, hence it is wrapped here.
+    Utils::CommandLine command(heaptrackPath, QStringList() << QLatin1String("--output") << heaptrackDir.pathAppended(baseName).nativePath());
+    command.addCommandLineAsArgs(runControl->commandLine());
+    qCDebug(launchLog) << "Heaptrack command:" << command.toUserOutput();
+    runControl->setCommandLine(command);
+
+    auto profiler = std::make_shared<HeapProfiler>(pluginFileNames);
+
+    const auto onPrintSetup = [runControl, printPath, heaptrackDir, baseName, pluginFileNames, profiler] (Utils::Process& process) {
+        // NOTE heaptrack appends the process id and a compression suffix to the output file name.
+        Utils::FilePaths dataPaths = heaptrackDir.dirEntries(Utils::FileFilter(QStringList() << baseName + QLatin1String("*"), QDir::Files));
+        if (dataPaths.isEmpty()) {
+            runControl->postMessage(tr("No heaptrack data was recorded."), Utils::ErrorMessageFormat);
+            return Tasking::SetupResult::StopWithError;
+        }
+
+        process.setCommand(Utils::CommandLine(printPath, QStringList() << QLatin1String("--print-leaks=1")
+                                                                       << QLatin1String("--merge-backtraces=0")
+                                                                       << QLatin1String("--peak-limit=1000000")
+                                                                       << dataPaths.first().nativePath()));
+        QObject::connect(&process, &Utils::Process::readyReadStandardOutput, &process, [&process, profiler] () {
+            profiler->addOutput(process.readAllRawStandardOutput());
+        });
+
+        runControl->postMessage(tr("Analysing heap usage of %1 in %2.").arg(pluginFileNames.join(QLatin1String(", "))).arg(dataPaths.first().toUserOutput()),
+                                Utils::NormalMessageFormat);
+        return Tasking::SetupResult::Continue;
+    };
+    const auto onPrintDone = [runControl, profiler] (const Utils::Process& process, Tasking::DoneWith result) {
+        if (result != Tasking::DoneWith::Success) {
+            runControl->postMessage(tr("heaptrack_print failed: %1").arg(process.exitMessage()), Utils::ErrorMessageFormat);
+            return Tasking::DoneResult::Error;
+        }
+
+        profiler->finish();
+        for (QString line : profiler->report())
+            runControl->postMessage(line, Utils::NormalMessageFormat);
+        return Tasking::DoneResult::Success;
+    };
+
+    return Tasking::Group {
+        // NOTE The recording is analysed even when Qt Creator exits with an error.
+        Tasking::continueOnError,
+        Tasking::onGroupSetup([runControl, heaptrackDir] () {
+            Utils::Result<> result = heaptrackDir.ensureWritableDir();
+            if (!result) {
+                runControl->postMessage(tr("Could not create heaptrack data directory: %1").arg(result.error()), Utils::ErrorMessageFormat);
+                return Tasking::SetupResult::StopWithError;
+            }
+            return Tasking::SetupResult::Continue;
+        }),
+        ProjectExplorer::processRecipe(runControl),
+        Utils::ProcessTask(onPrintSetup, onPrintDone)
+    };
+}
+
+} // Internal
+} // QtcDevPlugin
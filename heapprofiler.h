@@ -0,0 +1,159 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HEAPPROFILER_H
+#define HEAPPROFILER_H
+
+#include <projectexplorer/runcontrol.h>
+
+#include <utils/filepath.h>
+
+#include <QCoreApplication>
+#include <QMap>
+#include <QStringList>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The HeapProfiler class profiles the heap usage of the plugins with \c heaptrack
+ *
+ * This class runs the Qt Creator instance of a run control under \c heaptrack.
+ * Once the instance exits, the recording is analysed with \c heaptrack_print
+ * (with unmerged backtraces, so that each call stack is reported separately).
+ *
+ * The costs of the call stacks going through the libraries of the plugins being developped
+ * (number of allocations, temporary allocations, contribution to the peak heap consumption
+ * and leaked memory) are attributed to the innermost function of the plugins
+ * in the call stack. The totals and the allocation sites of the plugins contributing
+ * the most to the peak heap consumption are reported in the output of the run control.
+ *
+ * The recordings are stored in the \c .qtcdevplugin-heaptrack directory of the build directory,
+ * so that they can be further analysed with \c heaptrack_gui.
+ */
+class HeapProfiler
+{
+    Q_DECLARE_TR_FUNCTIONS(QtcDevPlugin::Internal::HeapProfiler)
+public:
+    /*!
+     * \brief Heap costs
+     */
+    typedef struct {
+        qint64 calls;       /*!< Number of calls to allocation functions */
+        qint64 temporary;   /*!< Number of temporary allocations (immediately freed) */
+        qint64 peak;        /*!< Contribution to the peak heap consumption (in bytes) */
+        qint64 leaked;      /*!< Leaked memory (in bytes) */
+    } Costs;
+
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new profiler attributing costs to the given libraries.
+     * \param pluginFileNames The file names of the libraries of the plugins.
+     */
+    HeapProfiler(const QStringList& pluginFileNames);
+
+    /*!
+     * \brief Add output of \c heaptrack_print
+     *
+     * Parses a chunk of the output of \c heaptrack_print.
+     * Chunks do not need to end on line boundaries.
+     * \param output A chunk of the output of \c heaptrack_print.
+     * \sa finish()
+     */
+    void addOutput(const QByteArray& output);
+    /*!
+     * \brief Finish parsing
+     *
+     * Parses the remainder of the output of \c heaptrack_print.
+     * \sa addOutput()
+     */
+    void finish(void);
+
+    /*!
+     * \brief Total costs
+     * \return The costs of the whole Qt Creator instance.
+     */
+    inline Costs totalCosts(void) const {return mTotal;}
+    /*!
+     * \brief Plugin costs
+     * \return The costs of the call stacks going through the plugins.
+     */
+    inline Costs pluginCosts(void) const {return mPlugin;}
+    /*!
+     * \brief Plugin allocation site costs
+     * \return The costs attributed to each function of the plugins.
+     */
+    inline QMap<QString, Costs> siteCosts(void) const {return mSites;}
+    /*!
+     * \brief Profiling report
+     *
+     * Returns a human readable report of the heap usage of the plugins.
+     * \param count The maximum number of allocation sites in the report.
+     * \return The lines of the report.
+     */
+    QStringList report(int count = 10) const;
+
+    /*!
+     * \brief Parse a size
+     *
+     * Parses a size as formatted by \c heaptrack_print (e.g. \c 12B, \c 1.50K, \c 2.30M).
+     * \param size A formatted size.
+     * \return The size in bytes or a negative value if the size could not be parsed.
+     */
+    static qint64 parseBytes(const QString& size);
+
+    /*!
+     * \brief Receipe for profiling
+     *
+     * Returns the tasks running the Qt Creator instance of the run control
+     * under \c heaptrack and reporting the heap usage of the plugins.
+     * \param runControl The run control.
+     * \return The tasks to profile the plugins.
+     */
+    static Tasking::Group receipe(ProjectExplorer::RunControl* runControl);
+private:
+    /*!
+     * \brief Sections of the output of \c heaptrack_print
+     */
+    enum Section {
+        NoSection,          /*!< Outside of any section */
+        CallsSection,       /*!< Most calls to allocation functions */
+        PeakSection,        /*!< Peak memory consumers */
+        LeaksSection,       /*!< Memory leaks */
+        TemporarySection,   /*!< Most temporary allocations */
+    };
+
+    void parseLine(const QString& line);
+    void endEntry(void);
+
+    QStringList mPluginFileNames;   /*!< The file names of the libraries of the plugins */
+    QByteArray mBuffer;             /*!< Output which has not been parsed yet (incomplete line) */
+    Section mSection;               /*!< Current section */
+    qint64 mEntryCost;              /*!< Cost of the current entry (negative outside of an entry) */
+    QString mFunction;              /*!< Last function read in the call stack of the current entry */
+    QString mPluginFunction;        /*!< Innermost function of the plugins in the call stack of the current entry */
+    Costs mTotal;                   /*!< Costs of the whole Qt Creator instance */
+    Costs mPlugin;                  /*!< Costs of the call stacks going through the plugins */
+    QMap<QString, Costs> mSites;    /*!< Costs attributed to each function of the plugins */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // HEAPPROFILER_H
@@ -0,0 +1,133 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "launchpreparation.h"
+
+#include "qtcdevpluginconstants.h"
+#include "qtcdevpluginlogging.h"
+#include "qtcrunconfiguration.h"
+#include "settingsclone.h"
+
+#include <coreplugin/actionmanager/actionmanager.h>
+#include <coreplugin/actionmanager/command.h>
+
+#include <debugger/debuggerconstants.h>
+
+#include <projectexplorer/buildmanager.h>
+#include <projectexplorer/project.h>
+#include <projectexplorer/projectexplorerconstants.h>
+#include <projectexplorer/runconfiguration.h>
+#include <projectexplorer/target.h>
+
+#include <utils/aspects.h>
+#include <utils/async.h>
+
+#include <QAction>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+LaunchPreparation* LaunchPreparation::sInstance = nullptr;
+
+LaunchPreparation::LaunchPreparation(QObject* parent) :
+    QObject(parent)
+{
+    sInstance = this;
+
+    /* NOTE The run actions start the build before this slot is called (the action of the command forwards
+     * to the actions registered by ProjectExplorer and Debugger, which were connected first). */
+    for (const char* runActionId : {ProjectExplorer::Constants::RUN, ProjectExplorer::Constants::RUNWITHOUTDEPLOY, Debugger::Constants::DEBUG}) {
+        Core::Command* command = Core::ActionManager::command(Utils::Id(runActionId));
+        if (command != nullptr)
+            connect(command->action(), &QAction::triggered,
+                    this, &LaunchPreparation::handleRunTriggered);
+    }
+    // NOTE Queued, so that the run control started after the build has taken the preparations.
+    connect(ProjectExplorer::BuildManager::instance(), &ProjectExplorer::BuildManager::buildQueueFinished,
+            this, &LaunchPreparation::discard, Qt::QueuedConnection);
+}
+
+LaunchPreparation::~LaunchPreparation(void)
+{
+    if (sInstance == this)
+        sInstance = nullptr;
+}
+
+void LaunchPreparation::handleRunTriggered(void)
+{
+    prepareRun(ProjectExplorer::activeRunConfigForActiveProject());
+}
+
+void LaunchPreparation::prepareRun(ProjectExplorer::RunConfiguration* runConfig)
+{
+    QtcRunConfiguration* qtcRunConfig = qobject_cast<QtcRunConfiguration*>(runConfig);
+    if ((sInstance == nullptr) || (qtcRunConfig == nullptr) || !ProjectExplorer::BuildManager::isBuilding(qtcRunConfig->project()))
+        return;
+
+    sInstance->prepare(qtcRunConfig);
+}
+
+void LaunchPreparation::prepare(QtcRunConfiguration* runConfig)
+{
+    if (mPrepared.contains(runConfig))
+        return;
+
+    qCDebug(launchLog) << "Preparing launch of" << runConfig->displayName() << "during the build";
+    runConfig->prepareLaunch();
+    mPrepared << runConfig;
+
+    Utils::BoolAspect* cloneSettingsAspect = static_cast<Utils::BoolAspect*>(runConfig->aspect(Utils::Id(Constants::CloneSettingsId)));
+    Utils::BoolAspect* tmpfsAspect = static_cast<Utils::BoolAspect*>(runConfig->aspect(Utils::Id(Constants::TmpfsId)));
+    // NOTE Settings in memory are cloned in the directory created by the run worker.
+    if ((cloneSettingsAspect == nullptr) || !cloneSettingsAspect->value() || ((tmpfsAspect != nullptr) && tmpfsAspect->value()))
+        return;
+
+    QString templatePath = SettingsClone::templatePath(runConfig->commandLineArgumentsList());
+    if (templatePath.isEmpty() || mSettingsClones.contains(templatePath))
+        return;
+    // NOTE The task keeps the clone alive until it is finished, even if the preparation is discarded meanwhile.
+    auto settingsClone = std::make_shared<SettingsClone>(templatePath);
+    mSettingsClones.insert(templatePath, {settingsClone, Utils::asyncRun([settingsClone] () {
+        return settingsClone->clone();
+    })});
+}
+
+void LaunchPreparation::discard(void)
+{
+    for (QPointer<QtcRunConfiguration> runConfig : mPrepared) {
+        if (!runConfig.isNull())
+            runConfig->discardPreparedLaunch();
+    }
+    mPrepared.clear();
+
+    // NOTE The clones are removed when they are destroyed.
+    if (!mSettingsClones.isEmpty())
+        qCDebug(launchLog) << "Discarding unused settings clones of" << mSettingsClones.keys();
+    mSettingsClones.clear();
+}
+
+LaunchPreparation::PreparedSettingsClone LaunchPreparation::takeSettingsClone(const QString& templatePath)
+{
+    if (sInstance == nullptr)
+        return PreparedSettingsClone();
+
+    return sInstance->mSettingsClones.take(templatePath);
+}
+
+} // Internal
+} // QtcDevPlugin
@@ -0,0 +1,135 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef LAUNCHPREPARATION_H
+#define LAUNCHPREPARATION_H
+
+#include <utils/result.h>
+
+#include <QFuture>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+
+#include <memory>
+
+namespace ProjectExplorer {
+    class RunConfiguration;
+}
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+class QtcRunConfiguration;
+class SettingsClone;
+
+/*!
+ * \brief The LaunchPreparation class prepares launches while the plugins are being built
+ *
+ * When a QtcRunConfiguration is run and its launch waits for a build
+ * (e.g. because the user pressed Run), this class prepares what does not depend
+ * on the built plugins, so that the launch only waits for the build:
+ *  \li The runnable (command line, theme lookup and environment) is computed
+ *  (see QtcRunConfiguration::prepareLaunch());
+ *  \li When the alternative settings are cloned for each run, the template
+ *  is cloned in a worker thread (see SettingsClone).
+ *
+ * Builds which are not followed by a run (e.g. Build Project) are not prepared for.
+ * The run worker then takes the prepared settings clone (see takeSettingsClone()).
+ * Preparations which were not used by a launch are discarded once the build queue is finished.
+ */
+class LaunchPreparation : public QObject
+{
+    Q_OBJECT
+public:
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new launch preparation.
+     * There should be only one instance (which is used by takeSettingsClone()).
+     * \param parent The parent object.
+     */
+    LaunchPreparation(QObject* parent = nullptr);
+    /*!
+     * \brief Destructor
+     */
+    ~LaunchPreparation(void);
+
+    /*!
+     * \brief A prepared settings clone
+     *
+     * Describes a settings clone which is being prepared in a worker thread.
+     */
+    struct PreparedSettingsClone {
+        std::shared_ptr<SettingsClone> clone;   /*!< The settings clone (its path is known before it is cloned) */
+        QFuture<Utils::Result<>> result;        /*!< The result of the cloning (see SettingsClone::clone()) */
+    };
+
+    /*!
+     * \brief Take a prepared settings clone
+     *
+     * Returns a settings clone prepared for the given template and forgets about it.
+     * This function does not wait for the settings to be cloned.
+     * \param templatePath The path to the template settings directory.
+     * \return The prepared settings clone (whose clone is \c nullptr if there is none).
+     */
+    static PreparedSettingsClone takeSettingsClone(const QString& templatePath);
+    /*!
+     * \brief Prepare a run
+     *
+     * Prepares the launch of the given run configuration, if it is a QtcRunConfiguration
+     * and its project is being built (i.e. the run waits for the build).
+     * This function should be called right after the run is requested
+     * (e.g. with ProjectExplorer::ProjectExplorerPlugin::runRunConfiguration()).
+     * \param runConfig The run configuration which is run.
+     */
+    static void prepareRun(ProjectExplorer::RunConfiguration* runConfig);
+private slots:
+    /*!
+     * \brief Handle run actions
+     *
+     * This slot is called when the user runs (or debugs) the active run configuration of the active project.
+     * Since the run action starts the build first, the launch is prepared if the build is running.
+     */
+    void handleRunTriggered(void);
+    /*!
+     * \brief Discard preparations
+     *
+     * Discards the preparations which were not used by a launch.
+     */
+    void discard(void);
+private:
+    static LaunchPreparation* sInstance;                                        /*!< The instance */
+
+    QList<QPointer<QtcRunConfiguration>> mPrepared;                             /*!< The run configurations whose launch is prepared */
+    QHash<QString, PreparedSettingsClone> mSettingsClones;                      /*!< The settings clones being prepared (by template path) */
+
+    /*!
+     * \brief Prepare a launch
+     *
+     * Prepares the launch of the given run configuration (see prepareRun()).
+     * \param runConfig The run configuration which is run.
+     */
+    void prepare(QtcRunConfiguration* runConfig);
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // LAUNCHPREPARATION_H
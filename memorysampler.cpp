@@ -0,0 +1,217 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "memorysampler.h"
+#include "benchmarkhistory.h"
+
+#include <projectexplorer/runcontrol.h>
+
+#include <utils/hostosinfo.h>
+#include <utils/processhandle.h>
+
+#include <QtCore>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+MemorySampler::MemorySampler(ProjectExplorer::RunControl* runControl, int interval) :
+    QObject(runControl), mRunControl(runControl), mPeak({-1, -1, -1}),
+    mFunctionStartRss(-1), mFunctionPeakRss(-1), mLastRss(-1)
+{
+    if (runControl == nullptr)
+        return;
+
+    connect(runControl, &ProjectExplorer::RunControl::appendMessage,
+            this, &MemorySampler::handleOutput);
+    connect(runControl, &ProjectExplorer::RunControl::stopped,
+            this, &MemorySampler::finish);
+
+    mSampleTimer.setInterval(interval);
+    connect(&mSampleTimer, &QTimer::timeout,
+            this, &MemorySampler::sample);
+    mSampleTimer.start();
+}
+
+MemorySampler::Sample MemorySampler::parse(const QString& smapsRollup)
+{
+    static const QRegularExpression rssRegExp(QLatin1String("^Rss:\\s*(\\d+)\\s*kB"), QRegularExpression::MultilineOption);
+    static const QRegularExpression pssRegExp(QLatin1String("^Pss:\\s*(\\d+)\\s*kB"), QRegularExpression::MultilineOption);
+    static const QRegularExpression anonymousRegExp(QLatin1String("^Anonymous:\\s*(\\d+)\\s*kB"), QRegularExpression::MultilineOption);
+
+    auto value = [smapsRollup] (const QRegularExpression& regExp) -> qint64 {
+        QRegularExpressionMatch match = regExp.match(smapsRollup);
+        return match.hasMatch() ? match.captured(1).toLongLong() : -1;
+    };
+
+    return Sample {
+        .rss = value(rssRegExp),
+        .pss = value(pssRegExp),
+        .anonymous = value(anonymousRegExp),
+    };
+}
+
+MemorySampler::Sample MemorySampler::read(qint64 pid)
+{
+    if (!Utils::HostOsInfo::isLinuxHost() || (pid <= 0))
+        return Sample {-1, -1, -1};
+
+    QFile smapsRollupFile(QString::fromLatin1("/proc/%1/smaps_rollup").arg(pid));
+    if (!smapsRollupFile.open(QIODevice::ReadOnly | QIODevice::Text))
+        return Sample {-1, -1, -1};
+    return parse(QString::fromLatin1(smapsRollupFile.readAll()));
+}
+
+void MemorySampler::addSample(const Sample& sample)
+{
+    if (sample.rss < 0)
+        return;
+
+    mPeak.rss = qMax(mPeak.rss, sample.rss);
+    mPeak.pss = qMax(mPeak.pss, sample.pss);
+    mPeak.anonymous = qMax(mPeak.anonymous, sample.anonymous);
+
+    mLastRss = sample.rss;
+    if (mFunctionStartRss < 0)
+        mFunctionStartRss = sample.rss;
+    mFunctionPeakRss = qMax(mFunctionPeakRss, sample.rss);
+}
+
+void MemorySampler::handleOutput(const QString& msg, Utils::OutputFormat format)
+{
+    if ((format != Utils::StdOutFormat) && (format != Utils::StdErrFormat))
+        return;
+
+    mLineBuffer.append(msg);
+    int newLine;
+    while ((newLine = mLineBuffer.indexOf(QLatin1Char('\n'))) != -1) {
+        handleLine(mLineBuffer.left(newLine));
+        mLineBuffer.remove(0, newLine + 1);
+    }
+}
+
+void MemorySampler::handleLine(const QString& line)
+{
+    static const QRegularExpression endRegExp(QLatin1String("^(?:PASS|FAIL!|SKIP)\\s*:\\s*([\\w:]+)\\("));
+    static const QRegularExpression startRegExp(QLatin1String("^\\*+\\s*Start testing of "));
+
+    if (startRegExp.match(line.trimmed()).hasMatch()) {
+        /* NOTE The first test function of a test class (initTestCase()) starts now,
+         * hence Qt Creator startup and plugin loading are not counted in its memory growth. */
+        if (mRunControl != nullptr)
+            sample();
+        mFunctionStartRss = mLastRss;
+        mFunctionPeakRss = mLastRss;
+        return;
+    }
+
+    QRegularExpressionMatch match = endRegExp.match(line.trimmed());
+    if (!match.hasMatch())
+        return;
+
+    // NOTE Sample now, so that the end of the test function is accurate.
+    if (mRunControl != nullptr)
+        sample();
+
+    if (mFunctionStartRss >= 0) {
+        FunctionMemory& function = mFunctions[match.captured(1)];
+        function.peakRss = qMax(function.peakRss, mFunctionPeakRss);
+        function.growth += mLastRss - mFunctionStartRss;
+    }
+
+    // NOTE The next test function (or data row) starts now.
+    mFunctionStartRss = mLastRss;
+    mFunctionPeakRss = mLastRss;
+}
+
+void MemorySampler::sample(void)
+{
+    addSample(read(mRunControl->applicationProcessHandle().pid()));
+}
+
+QStringList MemorySampler::report(int count) const
+{
+    QStringList lines;
+    QLocale locale = QLocale::system();
+
+    if (mPeak.rss < 0) {
+        lines << tr("The memory usage of the test instance could not be sampled.");
+        return lines;
+    }
+
+    lines << tr("Peak memory of the test instance: %1 RSS, %2 PSS, %3 heap (anonymous memory).")
+                 .arg(locale.formattedDataSize(1024 * mPeak.rss))
+                 .arg(locale.formattedDataSize(1024 * mPeak.pss))
+                 .arg(locale.formattedDataSize(1024 * mPeak.anonymous));
+
+    QStringList names;
+    for (auto it = mFunctions.constBegin(); it != mFunctions.constEnd(); ++it) {
+        if (it.value().growth > 0)
+            names << it.key();
+    }
+    if (names.isEmpty())
+        return lines;
+
+    std::stable_sort(names.begin(), names.end(), [this] (const QString& n1, const QString& n2) {
+        return mFunctions.value(n1).growth > mFunctions.value(n2).growth;
+    });
+    lines << tr("Test functions with the largest memory growth:");
+    for (QString name : names.mid(0, count)) {
+        const FunctionMemory function = mFunctions.value(name);
+        lines << tr("  %1: +%2 (peak RSS %3)")
+                     .arg(name)
+                     .arg(locale.formattedDataSize(1024 * function.growth))
+                     .arg(locale.formattedDataSize(1024 * function.peakRss));
+    }
+
+    return lines;
+}
+
+void MemorySampler::finish(void)
+{
+    mSampleTimer.stop();
+
+    for (QString line : report())
+        mRunControl->postMessage(line, Utils::NormalMessageFormat);
+
+    QList<BenchmarkHistory::Result> results;
+    if (mPeak.rss >= 0)
+        results << BenchmarkHistory::Result {QLatin1String("Peak RSS"), QLatin1String("KiB"), (double) mPeak.rss};
+    if (mPeak.pss >= 0)
+        results << BenchmarkHistory::Result {QLatin1String("Peak PSS"), QLatin1String("KiB"), (double) mPeak.pss};
+    if (mPeak.anonymous >= 0)
+        results << BenchmarkHistory::Result {QLatin1String("Peak heap"), QLatin1String("KiB"), (double) mPeak.anonymous};
+
+    if (!results.isEmpty()) {
+        BenchmarkHistory history(mRunControl->buildDirectory().pathAppended(QLatin1String(".qtcdevplugin-memory.json")), mRunControl->buildKey());
+        for (BenchmarkHistory::Regression regression : history.regressions(results, RegressionThreshold)) {
+            mRunControl->postMessage(tr("Memory regression: %1 %2 (baseline: %3, +%4%)")
+                                         .arg(regression.result.name)
+                                         .arg(QLocale::system().formattedDataSize(1024 * (qint64) regression.result.value))
+                                         .arg(QLocale::system().formattedDataSize(1024 * (qint64) regression.baseline))
+                                         .arg(regression.change, 0, 'f', 1),
+                                     Utils::ErrorMessageFormat);
+        }
+        history.append(results);
+        history.save();
+    }
+
+    deleteLater();
+}
+
+} // Internal
+} // QtcDevPlugin
@@ -0,0 +1,178 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef MEMORYSAMPLER_H
+#define MEMORYSAMPLER_H
+
+#include <utils/outputformat.h>
+
+#include <QMap>
+#include <QObject>
+#include <QTimer>
+
+namespace ProjectExplorer {
+    class RunControl;
+}
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The MemorySampler class tracks the memory usage of test instances
+ *
+ * This class periodically samples the resident set size, the proportional set size
+ * and the anonymous memory (most of which is heap) of a test instance of Qt Creator
+ * from <tt>/proc/<pid>/smaps_rollup</tt> (hence it only works on Linux).
+ *
+ * It follows the QtTest output of the test instance (as TestWatchdog does)
+ * to attribute the samples to test functions: a test function (or data row)
+ * spans from the end of the previous one (or the start of its test class) to its result line.
+ * For each test function, the peak resident set size and the memory growth
+ * (difference of resident set size between its end and its start) are computed.
+ *
+ * When the run control stops, the peaks and the test functions with the largest growth
+ * are reported in the output. The peaks are compared to the history of previous runs
+ * (with BenchmarkHistory) and regressions larger than RegressionThreshold are reported.
+ * The sampler deletes itself afterwards.
+ *
+ * \note The sampler is only used in the normal run mode, where the application process
+ * of the run control is the test instance (and not a wrapper, e.g. a profiler).
+ */
+class MemorySampler : public QObject
+{
+    Q_OBJECT
+public:
+    /*!
+     * \brief Memory usage sample
+     */
+    typedef struct {
+        qint64 rss;         /*!< The resident set size (in kibibytes, negative if unknown) */
+        qint64 pss;         /*!< The proportional set size (in kibibytes, negative if unknown) */
+        qint64 anonymous;   /*!< The anonymous memory, i.e. heap and other private allocations (in kibibytes, negative if unknown) */
+    } Sample;
+
+    /*!
+     * \brief Memory usage of a test function
+     */
+    typedef struct {
+        qint64 peakRss;     /*!< The peak resident set size while the test function runs (in kibibytes) */
+        qint64 growth;      /*!< The growth of the resident set size over the test function (in kibibytes, summed over data rows) */
+    } FunctionMemory;
+
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new sampler for the given run control.
+     * \param runControl The run control of the test instance (also the parent of the sampler).
+     * When it is \c nullptr, nothing is sampled automatically (see addSample() and handleLine()).
+     * \param interval The sampling interval (in milliseconds).
+     */
+    MemorySampler(ProjectExplorer::RunControl* runControl, int interval);
+
+    /*!
+     * \brief Parse memory usage
+     *
+     * Parses the contents of <tt>/proc/<pid>/smaps_rollup</tt>.
+     * \param smapsRollup The contents of <tt>/proc/<pid>/smaps_rollup</tt>.
+     * \return The memory usage sample.
+     */
+    static Sample parse(const QString& smapsRollup);
+    /*!
+     * \brief Read memory usage
+     *
+     * Reads the memory usage of a process in <tt>/proc/<pid>/smaps_rollup</tt>.
+     * \param pid The process identifier.
+     * \return The memory usage sample (with negative values if it could not be read).
+     */
+    static Sample read(qint64 pid);
+
+    /*!
+     * \brief Add a sample
+     *
+     * Records a memory usage sample of the running test function.
+     * \param sample The memory usage sample.
+     */
+    void addSample(const Sample& sample);
+    /*!
+     * \brief Handle a line of output
+     *
+     * Attributes the samples since the end of the previous test function
+     * to the test function whose result is given in the line of QtTest output.
+     * When QtTest starts testing a test class, the samples taken before
+     * (e.g. during Qt Creator startup) are not attributed to any test function.
+     * \param line A line of QtTest output.
+     */
+    void handleLine(const QString& line);
+
+    /*!
+     * \brief Peak memory usage
+     * \return The peak values of the samples.
+     */
+    inline Sample peak(void) const {return mPeak;}
+    /*!
+     * \brief Memory usage of test functions
+     * \return The memory usage associated to test function names.
+     */
+    inline QMap<QString, FunctionMemory> functions(void) const {return mFunctions;}
+    /*!
+     * \brief Memory report
+     *
+     * Returns a human readable report of the memory usage of the test instance.
+     * \param count The maximum number of test functions in the report.
+     * \return The lines of the report.
+     */
+    QStringList report(int count = 10) const;
+
+    static const int RegressionThreshold = 20;  /*!< The minimum peak memory increase reported as a regression (in percent) */
+private slots:
+    /*!
+     * \brief Handle output
+     *
+     * This slot is called when the run control outputs a message.
+     * \param msg The message.
+     * \param format The format of the message.
+     */
+    void handleOutput(const QString& msg, Utils::OutputFormat format);
+    /*!
+     * \brief Sample memory usage
+     *
+     * This slot is called periodically to sample the memory usage of the test instance.
+     */
+    void sample(void);
+    /*!
+     * \brief Finish
+     *
+     * This slot is called when the run control stops. It reports the memory usage,
+     * updates the history and deletes the sampler.
+     */
+    void finish(void);
+private:
+    ProjectExplorer::RunControl* mRunControl;       /*!< The run control of the test instance */
+    QString mLineBuffer;                            /*!< The incomplete line of output */
+    QTimer mSampleTimer;                            /*!< Periodic timer for sampling */
+    Sample mPeak;                                   /*!< The peak values of the samples */
+    qint64 mFunctionStartRss;                       /*!< The resident set size at the start of the running test function (negative if unknown) */
+    qint64 mFunctionPeakRss;                        /*!< The peak resident set size of the running test function (negative if unknown) */
+    qint64 mLastRss;                                /*!< The resident set size of the last sample (negative if unknown) */
+    QMap<QString, FunctionMemory> mFunctions;       /*!< The memory usage of test functions */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // MEMORYSAMPLER_H
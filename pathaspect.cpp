@@ -18,6 +18,7 @@
 
 #include "pathaspect.h"
 #include "Widgets/filetypevalidatinglineedit.h"
+#include "qtcdevpluginlogging.h"
 
 #include <utils/variablechooser.h>
 #include <utils/layoutbuilder.h>
@@ -32,7 +33,7 @@ void PathAspect::fromMap(const Utils::Store& map)
 {
     QTC_ASSERT(!settingsKey().isEmpty(), return);
     mValue = Utils::FilePath::fromSettings(map.value(settingsKey(), mDefaultValue.toSettings()));
-    qDebug() << __func__ << settingsKey().toByteArray() << "value:" << mValue;
+    qCDebug(aspectsLog) << __func__ << settingsKey().toByteArray() << "value:" << mValue;
 }
 
 void PathAspect::toMap(Utils::Store& map) const
@@ -55,7 +56,7 @@ void PathAspect::setValue(const Utils::FilePath& value)
 {
     bool same = (mValue == value);
     mValue = value;
-    qDebug() << __func__ << settingsKey().toByteArray() << "value:" << mValue;
+    qCDebug(aspectsLog) << __func__ << settingsKey().toByteArray() << "value:" << mValue;
 
     if (!same)
         emit changed();
@@ -78,6 +79,8 @@ void PathAspect::addToLayoutImpl(Layouting::Layout& builder)
 
     connect(mEdit, SIGNAL(validChanged(bool)), this, SLOT(update(bool)));
     connect(mEdit, SIGNAL(editingFinished()), this, SLOT(update()));
+    connect(mEdit, SIGNAL(validated(bool)), this, SLOT(finishUpdate(bool)));
+    connect(mEdit, SIGNAL(textEdited(QString)), this, SLOT(cancelUpdate()));
     connect(mButton, SIGNAL(released()), this, SLOT(browse()));
 
     QLayout* fieldLayout = new QHBoxLayout;
@@ -113,6 +116,10 @@ void PathAspect::manageAcceptFlags(Widgets::FileTypeValidatingLineEdit::Accept f
 
 void PathAspect::update(void)
 {
+    // NOTE The update is finished by finishUpdate() when the validation finishes.
+    mUpdatePending = mEdit->isValidating();
+    if (mUpdatePending)
+        return;
     if (mEdit->isValid())
         setValue(Utils::FilePath::fromUserInput(mEdit->text()));
     mEdit->setText(mValue.nativePath());
@@ -124,6 +131,21 @@ void PathAspect::update(bool valid)
         setValue(Utils::FilePath::fromUserInput(mEdit->text()));
 }
 
+void PathAspect::finishUpdate(bool valid)
+{
+    Q_UNUSED(valid)
+    if (!mUpdatePending)
+        return;
+
+    mUpdatePending = false;
+    update();
+}
+
+void PathAspect::cancelUpdate(void)
+{
+    mUpdatePending = false;
+}
+
 void PathAspect::updateState(bool checked)
 {
     mEdit->setEnabled(checked);
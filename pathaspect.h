@@ -52,7 +52,7 @@ public:
      * \param container Container of the aspect.
      */
     inline PathAspect(Utils::AspectContainer* container)
-        : Utils::BaseAspect(container), mCheckable(false) {}
+        : Utils::BaseAspect(container), mCheckable(false), mUpdatePending(false) {}
 
     /*!
      * \brief Conversion from map
@@ -280,7 +280,8 @@ private slots:
      *
      * This slot is called when the user finishes editing the path in \ref mEdit.
      * It saves the path, if it is valid or restores the previous one if it is invalid.
-     * \sa update(bool)
+     * While the path is being validated, the update is postponed until the validation finishes.
+     * \sa update(bool), finishUpdate()
      */
     void update(void);
     /*!
@@ -292,6 +293,24 @@ private slots:
      * \sa update()
      */
     void update(bool valid);
+    /*!
+     * \brief Finishes a postponed update
+     *
+     * This slot is called when the validation of the path in \ref mEdit finishes.
+     * If the user finished editing the path while it was being validated,
+     * the path is saved if it is valid and the previous one is restored otherwise.
+     * \param valid Whether the current path is valid in \ref mEdit
+     * \sa update()
+     */
+    void finishUpdate(bool valid);
+    /*!
+     * \brief Cancels a postponed update
+     *
+     * This slot is called when the user edits the path in \ref mEdit again,
+     * so that the path is not restored while it is being typed.
+     * \sa update(), finishUpdate()
+     */
+    void cancelUpdate(void);
     /*!
      * \brief Updates the state of the path line.
      *
@@ -332,6 +351,7 @@ private:
     Utils::FilePath mValue;                                 /*!< The current value for this aspect. */
     Utils::FilePath mDefaultValue;                          /*!< The default value for this aspect. */
     bool mCheckable;                                        /*!< Whether this aspect is optional. */
+    bool mUpdatePending;                                    /*!< Whether the update is postponed until the validation finishes. */
     Utils::MacroExpanderProvider mMacroExpanderProvider;    /*!< The provider for the macro expander. */
     QStringList mRequiredExtensions;                        /*!< The internal list of required extensions */
     Widgets::FileTypeValidatingLineEdit::Accepts mAccepted; /*!< Accept flags */
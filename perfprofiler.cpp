@@ -0,0 +1,251 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "perfprofiler.h"
+#include "qtcdevpluginconstants.h"
+#include "qtcdevpluginlogging.h"
+
+#include <utils/aspects.h>
+#include <utils/environment.h>
+#include <utils/qtcprocess.h>
+
+#include <QtCore>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+PerfProfiler::PerfProfiler(const QStringList& pluginFileNames) :
+    mPluginFileNames(pluginFileNames), mSampleCount(0), mPluginSampleCount(0)
+{
+}
+
+void PerfProfiler::addOutput(const QByteArray& output)
+{
+    mBuffer.append(output);
+
+    int begin = 0;
+    int end = mBuffer.indexOf('\n', begin);
+    while (end >= 0) {
+        parseLine(QString::fromUtf8(mBuffer.mid(begin, end - begin)));
+        begin = end + 1;
+        end = mBuffer.indexOf('\n', begin);
+    }
+    mBuffer.remove(0, begin);
+}
+
+void PerfProfiler::finish(void)
+{
+    if (!mBuffer.isEmpty())
+        parseLine(QString::fromUtf8(mBuffer));
+    mBuffer.clear();
+    endSample();
+}
+
+void PerfProfiler::parseLine(const QString& line)
+{
+    // NOTE Samples are separated by empty lines.
+    if (line.trimmed().isEmpty()) {
+        endSample();
+        return;
+    }
+
+    // NOTE Sample headers start with the thread name, frames are indented.
+    if (!line.at(0).isSpace()) {
+        endSample();
+        static const QRegularExpression headerRegExp(QLatin1String("^(.*?)\\s+\\d+(?:/\\d+)?\\s"));
+        QRegularExpressionMatch match = headerRegExp.match(line);
+        mThread = match.hasMatch() ? match.captured(1) : line.section(QLatin1Char(' '), 0, 0);
+        mThread.replace(QLatin1Char(' '), QLatin1Char('_'));
+        mThread.replace(QLatin1Char(';'), QLatin1Char(':'));
+        return;
+    }
+
+    static const QRegularExpression frameRegExp(QLatin1String("^\\s*[0-9a-fA-F]+\\s+(.*)\\s+\\(([^()]*?)(?:\\s+\\(deleted\\))?\\)\\s*$"));
+    QRegularExpressionMatch match = frameRegExp.match(line);
+    if (!match.hasMatch()) {
+        qCDebug(launchLog) << "Unexpected perf script line:" << line;
+        return;
+    }
+
+    static const QRegularExpression offsetRegExp(QLatin1String("\\+0x[0-9a-fA-F]+$"));
+    QString symbol = match.captured(1).trimmed().remove(offsetRegExp);
+    QString library = QFileInfo(match.captured(2)).fileName();
+    if (symbol.isEmpty() || (symbol == QLatin1String("[unknown]")))
+        symbol = library.startsWith(QLatin1Char('[')) ? library : QString(QLatin1String("[%1]")).arg(library);
+    symbol.replace(QLatin1Char(';'), QLatin1Char(':'));
+
+    mFrames << Frame {
+        .symbol = symbol,
+        .inPlugin = mPluginFileNames.contains(library),
+    };
+}
+
+void PerfProfiler::endSample(void)
+{
+    if (mThread.isEmpty() && mFrames.isEmpty())
+        return;
+
+    mSampleCount++;
+
+    QStringList stack;
+    QSet<QString> pluginSymbols;
+    QString self;
+    for (Frame frame : mFrames) {
+        stack.prepend(frame.symbol);
+        if (!frame.inPlugin)
+            continue;
+        if (self.isEmpty())
+            self = frame.symbol;
+        pluginSymbols.insert(frame.symbol);
+    }
+
+    if (!self.isEmpty()) {
+        mPluginSampleCount++;
+        if (!mThread.isEmpty())
+            stack.prepend(mThread);
+        mStacks[stack.join(QLatin1Char(';'))]++;
+        mSelf[self]++;
+        for (QString symbol : pluginSymbols)
+            mTotal[symbol]++;
+    }
+
+    mThread.clear();
+    mFrames.clear();
+}
+
+QByteArray PerfProfiler::folded(void) const
+{
+    QByteArray ans;
+    for (auto it = mStacks.constBegin(); it != mStacks.constEnd(); ++it)
+        ans.append(QString(QLatin1String("%1 %2\n")).arg(it.key()).arg(it.value()).toUtf8());
+    return ans;
+}
+
+QStringList PerfProfiler::report(int count) const
+{
+    QStringList lines;
+
+    if (mPluginSampleCount == 0) {
+        lines << tr("None of the %1 samples goes through the plugin(s).").arg(mSampleCount);
+        return lines;
+    }
+
+    auto percent = [this] (int samples) {
+        return QString::number(100. * samples / mSampleCount, 'f', 1);
+    };
+
+    lines << tr("%1 of the %2 samples (%3%) go through the plugin(s).").arg(mPluginSampleCount).arg(mSampleCount).arg(percent(mPluginSampleCount));
+
+    QStringList symbols = mTotal.keys();
+    std::stable_sort(symbols.begin(), symbols.end(), [this] (const QString& s1, const QString& s2) {
+        return mTotal.value(s1) > mTotal.value(s2);
+    });
+    lines << tr("Hottest functions of the plugin(s) (total %, self %):");
+    for (QString symbol : symbols.mid(0, count))
+        lines << QString(QLatin1String("  %1% %2% %3")).arg(percent(mTotal.value(symbol)), 5).arg(percent(mSelf.value(symbol)), 5).arg(symbol);
+
+    return lines;
+}
+
+Tasking::Group PerfProfiler::receipe(ProjectExplorer::RunControl* runControl)
+{
+    Utils::FilePath perfPath = Utils::Environment::systemEnvironment().searchInPath(QLatin1String("perf"));
+    if (perfPath.isEmpty()) {
+        return Tasking::Group {
+            Tasking::onGroupSetup([runControl] () {
+                runControl->postMessage(tr("Could not find perf in PATH."), Utils::ErrorMessageFormat);
+                return Tasking::SetupResult::StopWithError;
+            })
+        };
+    }
+
+    QStringList pluginFileNames;
+    if (!runControl->targetFilePath().isEmpty())
+        pluginFileNames << runControl->targetFilePath().fileName();
+    auto testedPluginsData = static_cast<const Utils::StringListAspect::Data*>(runControl->aspectData(Utils::Id(Constants::TestedPluginsId)));
+    if (testedPluginsData != nullptr) {
+        for (QString path : testedPluginsData->value)
+            pluginFileNames << Utils::FilePath::fromString(path).fileName();
+    }
+
+    const Utils::FilePath perfDir = runControl->buildDirectory().pathAppended(QLatin1String(".qtcdevplugin-perf"));
+    const QString baseName = QString(QLatin1String("perf-%1")).arg(QDateTime::currentDateTime().toString(QLatin1String("yyyyMMdd-hhmmss")));
+    const Utils::FilePath dataPath = perfDir.pathAppended(baseName + QLatin1String(".data"));
+    const Utils::FilePath foldedPath = perfDir.pathAppended(baseName + QLatin1String(".folded"));
+
+    // NOTE The process receipe reads the command line of the run control, hence it is wrapped here.
+    Utils::CommandLine command(perfPath, QStringList() << QLatin1String("record") << QLatin1String("-g")
+                                                       << QLatin1String("-o") << dataPath.nativePath()
+                                                       << QLatin1String("--"));
+    command.addCommandLineAsArgs(runControl->commandLine());
+    qCDebug(launchLog) << "Perf command:" << command.toUserOutput();
+    runControl->setCommandLine(command);
+
+    auto profiler = std::make_shared<PerfProfiler>(pluginFileNames);
+
+    const auto onScriptSetup = [runControl, perfPath, dataPath, pluginFileNames, profiler] (Utils::Process& process) {
+        if (!dataPath.exists()) {
+            runControl->postMessage(tr("No perf data was recorded."), Utils::ErrorMessageFormat);
+            return Tasking::SetupResult::StopWithError;
+        }
+
+        process.setCommand(Utils::CommandLine(perfPath, QStringList() << QLatin1String("script") << QLatin1String("-i") << dataPath.nativePath()));
+        QObject::connect(&process, &Utils::Process::readyReadStandardOutput, &process, [&process, profiler] () {
+            profiler->addOutput(process.readAllRawStandardOutput());
+        });
+
+        runControl->postMessage(tr("Processing perf samples of %1.").arg(pluginFileNames.join(QLatin1String(", "))), Utils::NormalMessageFormat);
+        return Tasking::SetupResult::Continue;
+    };
+    const auto onScriptDone = [runControl, foldedPath, profiler] (const Utils::Process& process, Tasking::DoneWith result) {
+        if (result != Tasking::DoneWith::Success) {
+            runControl->postMessage(tr("perf script failed: %1").arg(process.exitMessage()), Utils::ErrorMessageFormat);
+            return Tasking::DoneResult::Error;
+        }
+
+        profiler->finish();
+        for (QString line : profiler->report())
+            runControl->postMessage(line, Utils::NormalMessageFormat);
+
+        Utils::Result<qint64> written = foldedPath.writeFileContents(profiler->folded());
+        if (!written) {
+            runControl->postMessage(tr("Could not write folded call stacks: %1").arg(written.error()), Utils::ErrorMessageFormat);
+            return Tasking::DoneResult::Error;
+        }
+        runControl->postMessage(tr("Folded call stacks written to %1 (e.g. for flamegraph.pl).").arg(foldedPath.toUserOutput()), Utils::NormalMessageFormat);
+        return Tasking::DoneResult::Success;
+    };
+
+    return Tasking::Group {
+        // NOTE The samples are processed even when Qt Creator exits with an error.
+        Tasking::continueOnError,
+        Tasking::onGroupSetup([runControl, perfDir] () {
+            Utils::Result<> result = perfDir.ensureWritableDir();
+            if (!result) {
+                runControl->postMessage(tr("Could not create perf data directory: %1").arg(result.error()), Utils::ErrorMessageFormat);
+                return Tasking::SetupResult::StopWithError;
+            }
+            return Tasking::SetupResult::Continue;
+        }),
+        ProjectExplorer::processRecipe(runControl),
+        Utils::ProcessTask(onScriptSetup, onScriptDone)
+    };
+}
+
+} // Internal
+} // QtcDevPlugin
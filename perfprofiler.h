@@ -0,0 +1,139 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef PERFPROFILER_H
+#define PERFPROFILER_H
+
+#include <projectexplorer/runcontrol.h>
+
+#include <utils/filepath.h>
+
+#include <QCoreApplication>
+#include <QMap>
+#include <QStringList>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The PerfProfiler class profiles the plugins with \c perf
+ *
+ * This class runs the Qt Creator instance of a run control under <tt>perf record -g</tt>.
+ * Once the instance exits, the recorded samples are read back with <tt>perf script</tt>
+ * and only the samples whose call stack goes through the libraries of the plugins
+ * being developped are kept.
+ *
+ * These samples are folded (one line per distinct call stack, frames from the root to the leaf
+ * separated by semicolons, followed by the number of samples) in a file which can be
+ * directly given to \c flamegraph.pl. A summary of the hottest functions of the plugins
+ * is reported in the output of the run control.
+ *
+ * The recordings are stored in the \c .qtcdevplugin-perf directory of the build directory.
+ */
+class PerfProfiler
+{
+    Q_DECLARE_TR_FUNCTIONS(QtcDevPlugin::Internal::PerfProfiler)
+public:
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new profiler keeping the samples going through the given libraries.
+     * \param pluginFileNames The file names of the libraries of the plugins.
+     */
+    PerfProfiler(const QStringList& pluginFileNames);
+
+    /*!
+     * \brief Add output of \c perf
+     *
+     * Parses a chunk of the output of <tt>perf script</tt>.
+     * Chunks do not need to end on line boundaries.
+     * \param output A chunk of the output of <tt>perf script</tt>.
+     * \sa finish()
+     */
+    void addOutput(const QByteArray& output);
+    /*!
+     * \brief Finish parsing
+     *
+     * Parses the remainder of the output of <tt>perf script</tt>.
+     * \sa addOutput()
+     */
+    void finish(void);
+
+    /*!
+     * \brief Number of samples
+     * \return The number of samples parsed so far.
+     */
+    inline int sampleCount(void) const {return mSampleCount;}
+    /*!
+     * \brief Number of plugin samples
+     * \return The number of samples parsed so far, whose call stack goes through the plugins.
+     */
+    inline int pluginSampleCount(void) const {return mPluginSampleCount;}
+    /*!
+     * \brief Folded stacks
+     *
+     * Returns the folded call stacks of the samples going through the plugins,
+     * in the format expected by \c flamegraph.pl.
+     * \return The folded call stacks.
+     */
+    QByteArray folded(void) const;
+    /*!
+     * \brief Profiling report
+     *
+     * Returns a human readable report of the hottest functions of the plugins.
+     * \param count The maximum number of functions in the report.
+     * \return The lines of the report.
+     */
+    QStringList report(int count = 10) const;
+
+    /*!
+     * \brief Receipe for profiling
+     *
+     * Returns the tasks running the Qt Creator instance of the run control
+     * under <tt>perf record</tt> and reporting the samples of the plugins.
+     * \param runControl The run control.
+     * \return The tasks to profile the plugins.
+     */
+    static Tasking::Group receipe(ProjectExplorer::RunControl* runControl);
+private:
+    /*!
+     * \brief Frame of a call stack
+     */
+    typedef struct {
+        QString symbol;     /*!< The function name (or the library name if unknown) */
+        bool inPlugin;      /*!< Whether the function belongs to a plugin library */
+    } Frame;
+
+    void parseLine(const QString& line);
+    void endSample(void);
+
+    QStringList mPluginFileNames;   /*!< The file names of the libraries of the plugins */
+    QByteArray mBuffer;             /*!< Output which has not been parsed yet (incomplete line) */
+    QString mThread;                /*!< Thread of the current sample */
+    QList<Frame> mFrames;           /*!< Frames of the current sample (from the leaf to the root) */
+    int mSampleCount;               /*!< Number of samples */
+    int mPluginSampleCount;         /*!< Number of samples going through the plugins */
+    QMap<QString, int> mStacks;     /*!< Number of samples of each folded call stack */
+    QMap<QString, int> mSelf;       /*!< Number of samples of each plugin function, when it is the innermost plugin frame */
+    QMap<QString, int> mTotal;      /*!< Number of samples of each plugin function, when it is in the call stack */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // PERFPROFILER_H
@@ -0,0 +1,131 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "plugininstaller.h"
+#include "qtcdevpluginlogging.h"
+#include "tracer.h"
+
+#include <QtCore>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+Utils::Result<PluginInstaller::Statistics> PluginInstaller::install(const QList<File>& files)
+{
+    TraceSpan span("launch", QLatin1String("Plugin installation"));
+
+    Statistics stats = {0, 0, 0};
+    for (File file : files) {
+        if (isUpToDate(file)) {
+            stats.unchanged++;
+            continue;
+        }
+
+        Utils::Result<> result = installFile(file);
+        if (!result)
+            return Utils::ResultError(result.error());
+        stats.copied++;
+        stats.copiedBytes += file.source.fileSize();
+    }
+
+    qCDebug(launchLog) << "Plugin files installed:" << stats.copied << "copied," << stats.unchanged << "unchanged";
+    return stats;
+}
+
+bool PluginInstaller::isUpToDate(const File& file)
+{
+    if (!file.target.isFile())
+        return false;
+    // NOTE Sizes are compared first, to avoid reading files which obviously differ.
+    if (file.source.fileSize() != file.target.fileSize())
+        return false;
+
+    QByteArray sourceHash = hash(file.source);
+    return !sourceHash.isEmpty() && (sourceHash == hash(file.target));
+}
+
+Utils::Result<> PluginInstaller::installFile(const File& file)
+{
+    QFile source(file.source.toFSPathString());
+    if (!source.open(QIODevice::ReadOnly))
+        return Utils::ResultError(tr("Could not read \"%1\": %2").arg(file.source.toUserOutput()).arg(source.errorString()));
+
+    if (!file.target.parentDir().ensureWritableDir())
+        return Utils::ResultError(tr("Could not create directory \"%1\".").arg(file.target.parentDir().toUserOutput()));
+
+    QSaveFile target(file.target.toFSPathString());
+    if (!target.open(QIODevice::WriteOnly))
+        return Utils::ResultError(tr("Could not write \"%1\": %2").arg(file.target.toUserOutput()).arg(target.errorString()));
+
+    while (!source.atEnd()) {
+        QByteArray chunk = source.read(1 << 20);
+        if (target.write(chunk) != chunk.size()) {
+            target.cancelWriting();
+            break;
+        }
+    }
+    if (!target.commit())
+        return Utils::ResultError(tr("Could not write \"%1\": %2").arg(file.target.toUserOutput()).arg(target.errorString()));
+
+    QFile::setPermissions(file.target.toFSPathString(), source.permissions());
+    return Utils::ResultOk;
+}
+
+QByteArray PluginInstaller::hash(const Utils::FilePath& filePath)
+{
+    QFile file(filePath.toFSPathString());
+    if (!file.open(QIODevice::ReadOnly))
+        return QByteArray();
+
+    QCryptographicHash hash(QCryptographicHash::Blake2b_256);
+    if (!hash.addData(&file))
+        return QByteArray();
+    return hash.result();
+}
+
+QList<PluginInstaller::File> PluginInstaller::files(const ProjectExplorer::BuildTargetInfo& info)
+{
+    QList<File> files;
+    if (info.targetFilePath.isEmpty())
+        return files;
+
+    for (QString path : info.additionalData.toStringList()) {
+        Utils::FilePath source = Utils::FilePath::fromString(path);
+        files << File{source, info.targetFilePath.parentDir().pathAppended(source.fileName())};
+    }
+    return files;
+}
+
+QStringList PluginInstaller::encode(const QList<File>& files)
+{
+    QStringList paths;
+    for (File file : files)
+        paths << file.source.toFSPathString() << file.target.toFSPathString();
+    return paths;
+}
+
+QList<PluginInstaller::File> PluginInstaller::decode(const QStringList& paths)
+{
+    QList<File> files;
+    for (int p = 0; p + 1 < paths.size(); p += 2)
+        files << File{Utils::FilePath::fromString(paths.at(p)), Utils::FilePath::fromString(paths.at(p + 1))};
+    return files;
+}
+
+} // Internal
+} // QtcDevPlugin
@@ -0,0 +1,133 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef PLUGININSTALLER_H
+#define PLUGININSTALLER_H
+
+#include <projectexplorer/buildtargetinfo.h>
+
+#include <utils/filepath.h>
+#include <utils/result.h>
+
+#include <QCoreApplication>
+#include <QList>
+#include <QStringList>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The PluginInstaller class installs the changed files of plugins
+ *
+ * This class installs the files built for plugins (the artifacts listed in CMake file API)
+ * next to the installed plugin library, as <tt>cmake --install</tt> would, but only copies
+ * the files whose contents changed: the contents hash of each built file is compared
+ * with the one of its installed copy.
+ *
+ * Files are replaced atomically (they are written to a temporary file which is then renamed),
+ * so that running Qt Creator instances keep using the former version.
+ */
+class PluginInstaller
+{
+    Q_DECLARE_TR_FUNCTIONS(QtcDevPlugin::Internal::PluginInstaller)
+public:
+    /*!
+     * \brief A file to install
+     */
+    typedef struct {
+        Utils::FilePath source;     /*!< The path to the built file */
+        Utils::FilePath target;     /*!< The path to the installed file */
+    } File;
+
+    /*!
+     * \brief Installation statistics
+     */
+    typedef struct {
+        int copied;                 /*!< Number of files which were copied */
+        int unchanged;              /*!< Number of files which were already installed */
+        qint64 copiedBytes;         /*!< Size of the copied files (in bytes) */
+    } Statistics;
+
+    /*!
+     * \brief Install files
+     *
+     * Copies the files whose installed copy is missing or differs.
+     * \param files The files to install.
+     * \return The installation statistics or an error.
+     */
+    static Utils::Result<Statistics> install(const QList<File>& files);
+    /*!
+     * \brief Whether a file is installed
+     *
+     * Tells whether the installed copy of a file has the same contents as the built file.
+     * \param file A file.
+     * \return \c true if the installed copy is up to date, \c false otherwise.
+     */
+    static bool isUpToDate(const File& file);
+    /*!
+     * \brief Install a file
+     *
+     * Copies the built file to its installed location atomically.
+     * \param file A file.
+     * \return \c ResultOk if the file was installed, an error otherwise.
+     */
+    static Utils::Result<> installFile(const File& file);
+    /*!
+     * \brief Contents hash
+     *
+     * Computes the hash of the contents of a file.
+     * \param filePath The path to a file.
+     * \return The hash of the contents of the file or an empty array if it cannot be read.
+     */
+    static QByteArray hash(const Utils::FilePath& filePath);
+
+    /*!
+     * \brief Files of a plugin
+     *
+     * Returns the files to install for a plugin. The built files are stored
+     * in the additional data of the build target information by the run configuration factories
+     * and they are installed next to the plugin library.
+     * \param info The build target information of the plugin.
+     * \return The files to install for the plugin.
+     */
+    static QList<File> files(const ProjectExplorer::BuildTargetInfo& info);
+    /*!
+     * \brief Encode files
+     *
+     * Encodes files as a string list (alternating built and installed paths),
+     * to be passed to the run control in an aspect.
+     * \param files The files.
+     * \return The encoded files.
+     * \sa decode()
+     */
+    static QStringList encode(const QList<File>& files);
+    /*!
+     * \brief Decode files
+     *
+     * Decodes files encoded with encode().
+     * \param paths The encoded files.
+     * \return The files.
+     * \sa encode()
+     */
+    static QList<File> decode(const QStringList& paths);
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // PLUGININSTALLER_H
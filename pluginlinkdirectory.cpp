@@ -0,0 +1,137 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "pluginlinkdirectory.h"
+#include "qtcdevpluginlogging.h"
+
+#include <utils/hostosinfo.h>
+
+#include <QtCore>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+static Utils::FilePath pluginPath(QString argument)
+{
+    if ((argument.size() >= 2) && argument.startsWith(QLatin1Char('"')) && argument.endsWith(QLatin1Char('"')))
+        argument = argument.mid(1, argument.size() - 2);
+    return Utils::FilePath::fromUserInput(argument);
+}
+
+PluginLinkDirectory::PluginLinkDirectory(const QString& rootPath) :
+    mDir(QDir(rootPath).filePath(QLatin1String("qtcdevplugin-plugins-XXXXXX"))), mLinkCount(0)
+{
+}
+
+Utils::Result<> PluginLinkDirectory::link(const QList<Utils::FilePath>& files)
+{
+    if (!mDir.isValid())
+        return Utils::ResultError(tr("Could not create plugin link directory: %1").arg(mDir.errorString()));
+
+    for (Utils::FilePath file : files) {
+        if (!file.isFile())
+            return Utils::ResultError(tr("\"%1\" was not built.").arg(file.toUserOutput()));
+
+        QString linkPath = mDir.filePath(file.fileName());
+        if (QFileInfo(linkPath).isSymLink()) {
+            qCWarning(launchLog) << "Several plugin files are named" << file.fileName() << ". Only the first one is linked";
+            continue;
+        }
+        if (!QFile::link(file.toFSPathString(), linkPath))
+            return Utils::ResultError(tr("Could not link \"%1\".").arg(file.toUserOutput()));
+        mLinkCount++;
+    }
+
+    qCDebug(launchLog) << "Plugin files linked in" << mDir.path() << ":" << mLinkCount;
+    return Utils::ResultOk;
+}
+
+QStringList PluginLinkDirectory::replacePluginPaths(const QStringList& arguments, const QList<Utils::FilePath>& files, const QString& linkPath)
+{
+    QStringList ans;
+    bool replaced = false;
+    QList<Utils::FilePath> pluginDirs = replacedPluginPaths(arguments, files);
+
+    for (int a = 0; a < arguments.size(); a++) {
+        if ((arguments.at(a) != QLatin1String("-pluginpath")) || (a + 1 >= arguments.size())) {
+            ans << arguments.at(a);
+            continue;
+        }
+
+        a++;
+        if (!pluginDirs.contains(pluginPath(arguments.at(a)))) {
+            ans << QLatin1String("-pluginpath") << arguments.at(a);
+        } else if (!replaced) {
+            ans << QLatin1String("-pluginpath") << linkPath;
+            replaced = true;
+        }
+    }
+
+    return ans;
+}
+
+QList<Utils::FilePath> PluginLinkDirectory::siblingPlugins(const QStringList& arguments, const QList<Utils::FilePath>& files)
+{
+    QList<Utils::FilePath> ans;
+    QStringList fileNames;
+    for (Utils::FilePath file : files)
+        fileNames << file.fileName();
+    QStringList libraryFilters(Utils::HostOsInfo::isMacHost() ? QLatin1String("*.dylib") : QLatin1String("*.so"));
+
+    for (Utils::FilePath pluginDir : replacedPluginPaths(arguments, files)) {
+        QDirIterator it(pluginDir.toFSPathString(), libraryFilters, QDir::Files, QDirIterator::Subdirectories);
+        while (it.hasNext()) {
+            Utils::FilePath library = Utils::FilePath::fromString(it.next());
+            if (fileNames.contains(library.fileName()))
+                continue;
+            fileNames << library.fileName();
+            ans << library;
+        }
+    }
+
+    qCDebug(launchLog) << "Sibling plugins:" << ans;
+    return ans;
+}
+
+QList<Utils::FilePath> PluginLinkDirectory::replacedPluginPaths(const QStringList& arguments, const QList<Utils::FilePath>& files)
+{
+    QList<Utils::FilePath> ans;
+
+    for (int a = 0; a + 1 < arguments.size(); a++) {
+        if (arguments.at(a) != QLatin1String("-pluginpath"))
+            continue;
+
+        Utils::FilePath pluginDir = pluginPath(arguments.at(++a));
+        bool containsFiles = std::any_of(files.cbegin(), files.cend(), [pluginDir] (const Utils::FilePath& file) {
+            return file.isChildOf(pluginDir);
+        });
+        if (containsFiles && !ans.contains(pluginDir))
+            ans << pluginDir;
+    }
+
+    return ans;
+}
+
+bool PluginLinkDirectory::isAvailable(void)
+{
+    // NOTE QFile::link() creates shortcuts on Windows, which Qt Creator does not follow.
+    return !Utils::HostOsInfo::isWindowsHost();
+}
+
+} // Internal
+} // QtcDevPlugin
@@ -0,0 +1,127 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef PLUGINLINKDIRECTORY_H
+#define PLUGINLINKDIRECTORY_H
+
+#include <utils/filepath.h>
+#include <utils/result.h>
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QStringList>
+#include <QTemporaryDir>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The PluginLinkDirectory class links the built plugins in a directory for a run
+ *
+ * This class creates a temporary directory containing symbolic links
+ * to the files built for the plugin(s) being developped (see PluginInstaller::files()).
+ * The Qt Creator instance is then given this directory with \c -pluginpath instead
+ * of the build directory, so that it loads the plugins straight from the build tree
+ * (no file is copied) without scanning the whole build tree for plugins.
+ * The other plugin libraries in the replaced plugin paths are linked as well
+ * (see siblingPlugins()), so that the plugins built along the tested one are still loaded.
+ *
+ * Symbolic links are not supported on Windows.
+ * The directory is removed when the instance is destroyed.
+ */
+class PluginLinkDirectory
+{
+    Q_DECLARE_TR_FUNCTIONS(QtcDevPlugin::Internal::PluginLinkDirectory)
+public:
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new empty directory.
+     * \param rootPath The directory where the directory is created (the temporary directory by default).
+     */
+    PluginLinkDirectory(const QString& rootPath = QDir::tempPath());
+
+    /*!
+     * \brief Link files
+     *
+     * Creates a symbolic link to each of the given files in the directory.
+     * \param files The paths to the files.
+     * \return \c ResultOk if all the files were linked, an error otherwise.
+     */
+    Utils::Result<> link(const QList<Utils::FilePath>& files);
+    /*!
+     * \brief Remove the directory
+     *
+     * Removes the directory and the links (but not the linked files).
+     */
+    inline void remove(void) {mDir.remove();}
+
+    /*!
+     * \brief Directory path
+     * \return The path to the directory.
+     */
+    inline QString path(void) const {return mDir.path();}
+    /*!
+     * \brief Number of links
+     * \return The number of links in the directory.
+     */
+    inline int linkCount(void) const {return mLinkCount;}
+
+    /*!
+     * \brief Replace plugin paths
+     *
+     * Replaces the plugin paths (given with \c -pluginpath) containing the given files
+     * in the command line arguments of Qt Creator by the given path.
+     * Other plugin paths (e.g. the one of the probe plugin) are kept.
+     * \note The other plugins in the replaced paths must also be linked (see siblingPlugins()).
+     * \param arguments The command line arguments of Qt Creator.
+     * \param files The paths to the linked files.
+     * \param linkPath The path to the directory containing the links.
+     * \return The modified command line arguments.
+     */
+    static QStringList replacePluginPaths(const QStringList& arguments, const QList<Utils::FilePath>& files, const QString& linkPath);
+    /*!
+     * \brief Sibling plugins
+     *
+     * Lists the plugin libraries found in the plugin paths replaced by replacePluginPaths()
+     * (e.g. the other plugins of a multi-plugin project), except the given files.
+     * They must be linked too, otherwise Qt Creator loads their installed copies
+     * (or does not find them at all).
+     * \param arguments The command line arguments of Qt Creator.
+     * \param files The paths to the linked files.
+     * \return The paths to the other plugin libraries in the replaced plugin paths.
+     */
+    static QList<Utils::FilePath> siblingPlugins(const QStringList& arguments, const QList<Utils::FilePath>& files);
+    /*!
+     * \brief Whether links are available
+     *
+     * Tells whether plugins can be linked on this host.
+     * \return \c true if plugins can be linked, \c false otherwise.
+     */
+    static bool isAvailable(void);
+private:
+    static QList<Utils::FilePath> replacedPluginPaths(const QStringList& arguments, const QList<Utils::FilePath>& files);
+
+    QTemporaryDir mDir;     /*!< The directory */
+    int mLinkCount;         /*!< The number of links in the directory */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // PLUGINLINKDIRECTORY_H
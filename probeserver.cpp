@@ -0,0 +1,157 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "probeserver.h"
+#include "qtcdevpluginlogging.h"
+
+#include <utils/filepath.h>
+
+#include <QtCore>
+#include <QtNetwork>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+ProbeServer::ProbeServer(QObject* parent) :
+    QObject(parent)
+{
+    static int serverCount = 0;
+
+    mServer = new QLocalServer(this);
+    mServer->setSocketOptions(QLocalServer::UserAccessOption);
+    connect(mServer, &QLocalServer::newConnection,
+            this, &ProbeServer::handleNewConnection);
+
+    QString name = QString::fromLatin1("qtcdevprobe-%1-%2").arg(QCoreApplication::applicationPid()).arg(serverCount++);
+    if (!mServer->listen(name))
+        qCWarning(launchLog) << "Probe server could not listen on" << name << ":" << mServer->errorString();
+}
+
+bool ProbeServer::isListening(void) const
+{
+    return mServer->isListening();
+}
+
+QString ProbeServer::serverName(void) const
+{
+    return mServer->fullServerName();
+}
+
+void ProbeServer::handleNewConnection(void)
+{
+    while (QLocalSocket* socket = mServer->nextPendingConnection()) {
+        qCDebug(launchLog) << "Probe connected";
+        connect(socket, &QLocalSocket::readyRead,
+                this, &ProbeServer::readMessages);
+        connect(socket, &QLocalSocket::disconnected,
+                socket, &QObject::deleteLater);
+    }
+}
+
+void ProbeServer::readMessages(void)
+{
+    QLocalSocket* socket = qobject_cast<QLocalSocket*>(sender());
+    if (socket == nullptr)
+        return;
+
+    while (socket->canReadLine()) {
+        QJsonParseError error;
+        QJsonDocument message = QJsonDocument::fromJson(socket->readLine(), &error);
+        if (error.error != QJsonParseError::NoError) {
+            qCWarning(launchLog) << "Invalid probe message:" << error.errorString();
+            continue;
+        }
+
+        for (QString line : render(message.object(), mPluginFileNames))
+            emit reported(line);
+    }
+}
+
+QStringList ProbeServer::render(const QJsonObject& message, const QStringList& pluginFileNames)
+{
+    QStringList lines;
+    QString type = message.value(QLatin1String("type")).toString();
+
+    if (type == QLatin1String("plugins")) {
+        QList<QJsonObject> plugins;
+        for (QJsonValue plugin : message.value(QLatin1String("plugins")).toArray())
+            plugins << plugin.toObject();
+        auto total = [] (const QJsonObject& plugin) {
+            return plugin.value(QLatin1String("load")).toDouble()
+                 + plugin.value(QLatin1String("initialize")).toDouble()
+                 + plugin.value(QLatin1String("extensionsInitialized")).toDouble()
+                 + plugin.value(QLatin1String("delayedInitialize")).toDouble();
+        };
+        std::stable_sort(plugins.begin(), plugins.end(), [total] (const QJsonObject& p1, const QJsonObject& p2) {
+            return total(p1) > total(p2);
+        });
+
+        for (QJsonObject plugin : plugins) {
+            lines << tr("Probe: %1 started in %2 ms (load %3 ms, initialize %4 ms, extensions initialized %5 ms, delayed initialize %6 ms)")
+                         .arg(plugin.value(QLatin1String("name")).toString())
+                         .arg(total(plugin))
+                         .arg(plugin.value(QLatin1String("load")).toDouble())
+                         .arg(plugin.value(QLatin1String("initialize")).toDouble())
+                         .arg(plugin.value(QLatin1String("extensionsInitialized")).toDouble())
+                         .arg(plugin.value(QLatin1String("delayedInitialize")).toDouble());
+        }
+    } else if (type == QLatin1String("sample")) {
+        double rss = message.value(QLatin1String("rss")).toDouble(-1.);
+        lines << tr("Probe: event loop latency %1 ms, RSS %2, %3 widgets, %4 objects in pool")
+                     .arg(message.value(QLatin1String("latency")).toDouble(), 0, 'f', 1)
+                     .arg(rss < 0 ? tr("unknown") : tr("%1 MiB").arg(rss / 1024., 0, 'f', 1))
+                     .arg(message.value(QLatin1String("widgets")).toInt())
+                     .arg(message.value(QLatin1String("objects")).toInt());
+    } else if (type == QLatin1String("stall")) {
+        QJsonArray frames = message.value(QLatin1String("frames")).toArray();
+        auto moduleName = [] (const QJsonValue& frame) {
+            return Utils::FilePath::fromString(frame.toObject().value(QLatin1String("module")).toString()).fileName();
+        };
+        auto inPlugin = [pluginFileNames, moduleName] (const QJsonValue& frame) {
+            return pluginFileNames.contains(moduleName(frame));
+        };
+
+        auto pluginFrame = std::find_if(frames.begin(), frames.end(), inPlugin);
+        if (pluginFrame != frames.end()) {
+            lines << tr("Probe: main thread stalled for %1 ms in %2 (%3)")
+                         .arg(message.value(QLatin1String("duration")).toInteger())
+                         .arg(moduleName(*pluginFrame))
+                         .arg((*pluginFrame).toObject().value(QLatin1String("symbol")).toString(QLatin1String("??")));
+        } else {
+            lines << tr("Probe: main thread stalled for %1 ms outside of the plugin(s)")
+                         .arg(message.value(QLatin1String("duration")).toInteger());
+        }
+
+        for (int f = 0; (f < frames.size()) && (f < MaxStallFrames); f++) {
+            QJsonObject frame = frames.at(f).toObject();
+            lines << QString::fromLatin1("  %1#%2 %3 (%4+0x%5)")
+                         .arg(inPlugin(frame) ? QLatin1String("> ") : QLatin1String("  "))
+                         .arg(f)
+                         .arg(frame.value(QLatin1String("symbol")).toString(QLatin1String("??")))
+                         .arg(moduleName(frame))
+                         .arg(frame.value(QLatin1String("offset")).toInteger(), 0, 16);
+        }
+    } else {
+        qCWarning(launchLog) << "Unknown probe message type:" << type;
+    }
+
+    return lines;
+}
+
+} // Internal
+} // QtcDevPlugin
@@ -0,0 +1,128 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef PROBESERVER_H
+#define PROBESERVER_H
+
+#include <QJsonObject>
+#include <QObject>
+#include <QStringList>
+
+class QLocalServer;
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The ProbeServer class receives the metrics streamed by the probe plugin
+ *
+ * This class listens on a local socket, to which the probe plugin
+ * (\c QtcDevProbe, loaded in the Qt Creator instance) connects.
+ * The name of the socket is passed to the probe in the environment
+ * variable named Constants::ProbeServerVariable.
+ *
+ * The probe sends one JSON object per line. Two kinds of messages are supported:
+ *  \li \c plugins messages, containing the initialisation timings of each plugin,
+ *  sent once Qt Creator startup is done;
+ *  \li \c sample messages, containing the event loop latency, the resident set size,
+ *  the number of widgets and the number of objects in the plugin manager pool,
+ *  sent periodically;
+ *  \li \c stall messages, containing the duration of a main thread event loop stall
+ *  and a stack sample of the main thread, which is attributed to the plugin(s) being developped
+ *  (see setPluginFileNames()).
+ *
+ * The messages are rendered as human readable lines (see reported()).
+ */
+class ProbeServer : public QObject
+{
+    Q_OBJECT
+public:
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new probe server and starts listening.
+     * \param parent The parent object.
+     * \sa isListening(), serverName()
+     */
+    ProbeServer(QObject* parent = nullptr);
+
+    /*!
+     * \brief Whether the server listens
+     *
+     * Tells whether the server could start listening.
+     * \return \c true if the server listens, \c false otherwise.
+     */
+    bool isListening(void) const;
+    /*!
+     * \brief Server name
+     *
+     * Returns the name of the local socket the probe should connect to.
+     * \return The name of the local socket.
+     */
+    QString serverName(void) const;
+    /*!
+     * \brief Set plugin file names
+     *
+     * Sets the file names of the libraries of the plugins being developped,
+     * to which event loop stalls are attributed.
+     * \param pluginFileNames The file names of the plugin libraries.
+     */
+    inline void setPluginFileNames(const QStringList& pluginFileNames) {mPluginFileNames = pluginFileNames;}
+
+    /*!
+     * \brief Render a message
+     *
+     * Renders a message from the probe as human readable lines.
+     * \param message A message from the probe.
+     * \param pluginFileNames The file names of the plugin libraries (to attribute stalls).
+     * \return The lines describing the message (empty if the message is not understood).
+     */
+    static QStringList render(const QJsonObject& message, const QStringList& pluginFileNames = QStringList());
+
+    static const int MaxStallFrames = 32;   /*!< The maximum number of frames shown for a stall */
+signals:
+    /*!
+     * \brief Metrics reported
+     *
+     * This signal is emitted for each line rendered from the messages of the probe.
+     * \param line A human readable line.
+     */
+    void reported(const QString& line);
+private slots:
+    /*!
+     * \brief Handle new connections
+     *
+     * This slot is called when a probe connects to the server.
+     */
+    void handleNewConnection(void);
+    /*!
+     * \brief Read messages
+     *
+     * This slot is called when data is available from a probe.
+     * It parses the complete lines and emits reported() for each of them.
+     */
+    void readMessages(void);
+private:
+    QLocalServer* mServer;          /*!< The local server the probes connect to */
+    QStringList mPluginFileNames;   /*!< The file names of the plugin libraries */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // PROBESERVER_H
@@ -20,9 +20,12 @@
 #define QMAKEQTCRUNCONFIGURATIONFACTORY_H
 
 #include "qtcdevpluginconstants.h"
+#include "qtcdevpluginlogging.h"
+#include "tracer.h"
 
 #include "qtcrunconfiguration.h"
 #include "qtctestrunconfiguration.h"
+#include "qtctestallrunconfiguration.h"
 #include "qtcdevpluginconstants.h"
 
 #include <projectexplorer/projectexplorerconstants.h>
@@ -33,7 +36,8 @@
 #include <qmakeprojectmanager/qmakeproject.h>
 #include <qmakeprojectmanager/qmakeprojectmanagerconstants.h>
 
-#include <QtDebug>
+#include <utils/algorithm.h>
+
 
 namespace ProjectExplorer {
     class ProjectNode;
@@ -65,7 +69,9 @@ namespace Internal {
  * \tparam RunConfiguration The run configuration type which is produced by the factory.
  * The type must have the following static functions:
  *   - id(): Returns the run configuration id;
- *   - displayNamePattern(): Returns the pattern used for the run configuration display name.
+ *   - displayNamePattern(): Returns the pattern used for the run configuration display name;
+ *   - aggregatesPlugins(): Whether a single run configuration is created for all the plugins
+ *     (in which case the type must also have the static function \c aggregateBuildTargetInfo()).
  *
  * \sa QtcRunConfiguration
  */
@@ -188,8 +194,11 @@ QMakeQtcRunConfigurationFactory<RunConfiguration>::QMakeQtcRunConfigurationFacto
 template <class RunConfiguration>
 QList<ProjectExplorer::RunConfigurationCreationInfo> QMakeQtcRunConfigurationFactory<RunConfiguration>::availableCreators(ProjectExplorer::BuildConfiguration* bc) const
 {
+    TraceSpan span("discovery", QLatin1String("qmake available creators"));
+    span.setArgument(QLatin1String("runConfiguration"), RunConfiguration::id().toString());
+
     QList<ProjectExplorer::RunConfigurationCreationInfo> creators;
-    qDebug() << "availableCreators()" << isReady(bc->project()) << isUseful(bc->project());
+    qCDebug(discoveryLog) << "availableCreators()" << isReady(bc->project()) << isUseful(bc->project());
 
     if (bc->buildSystem() == nullptr)
         return creators;
@@ -197,16 +206,23 @@ QList<ProjectExplorer::RunConfigurationCreationInfo> QMakeQtcRunConfigurationFac
         return creators;
 
     QList<ProjectExplorer::BuildTargetInfo> buildInfos = bc->buildSystem()->applicationTargets();
+    QStringList pluginBuildKeys;
     for (ProjectExplorer::BuildTargetInfo info : buildInfos)
-        qDebug() << "BuildTargetInfo:" << info.displayName << info.buildKey << info.projectFilePath << info.workingDirectory << info.targetFilePath;
-    for (ProjectExplorer::ProjectNode* node: qtCreatorPlugins(bc->project()->rootProjectNode())) {
+        qCDebug(discoveryLog) << "BuildTargetInfo:" << info.displayName << info.buildKey << info.projectFilePath << info.workingDirectory << info.targetFilePath;
+    QList<ProjectExplorer::ProjectNode*> pluginNodes;
+    {
+        TraceSpan walkSpan("discovery", QLatin1String("qmake tree walk"));
+        pluginNodes = qtCreatorPlugins(bc->project()->rootProjectNode());
+        walkSpan.setArgument(QLatin1String("plugins"), pluginNodes.size());
+    }
+    for (ProjectExplorer::ProjectNode* node: pluginNodes) {
         QmakeProjectManager::QmakeProFileNode* qMakeNode = static_cast<QmakeProjectManager::QmakeProFileNode*>(node);
 
         QFileInfo proFileInfo = qMakeNode->filePath().toFileInfo();
         ProjectExplorer::BuildTargetInfo info = bc->buildSystem()->buildTarget(proFileInfo.canonicalFilePath());
 
         if (info.buildKey != proFileInfo.canonicalFilePath()) {
-            qDebug() << __func__ << "Creating:" << proFileInfo.canonicalFilePath() << proFileInfo.baseName() << targetBuildPath(qMakeNode->proFile()) << targetInstallPath(qMakeNode->proFile());
+            qCDebug(discoveryLog) << __func__ << "Creating:" << proFileInfo.canonicalFilePath() << proFileInfo.baseName() << targetBuildPath(qMakeNode->proFile()) << targetInstallPath(qMakeNode->proFile());
 
             info.displayName = proFileInfo.baseName();
             info.buildKey = proFileInfo.canonicalFilePath();
@@ -216,6 +232,10 @@ QList<ProjectExplorer::RunConfigurationCreationInfo> QMakeQtcRunConfigurationFac
             buildInfos << info;
         }
 
+        pluginBuildKeys << info.buildKey;
+        if constexpr (RunConfiguration::aggregatesPlugins())
+            continue;
+
         ProjectExplorer::RunConfigurationCreationInfo creator;
         creator.factory = this;
         creator.buildKey = info.buildKey;
@@ -223,6 +243,24 @@ QList<ProjectExplorer::RunConfigurationCreationInfo> QMakeQtcRunConfigurationFac
 
         creators << creator;
     }
+
+    if constexpr (RunConfiguration::aggregatesPlugins()) {
+        // NOTE Aggregating a single plugin is useless.
+        if (pluginBuildKeys.size() > 1) {
+            ProjectExplorer::BuildTargetInfo info = RunConfiguration::aggregateBuildTargetInfo(bc, pluginBuildKeys);
+            buildInfos = Utils::filtered(buildInfos, [info] (const ProjectExplorer::BuildTargetInfo& buildInfo) {
+                return buildInfo.buildKey != info.buildKey;
+            });
+            buildInfos << info;
+
+            ProjectExplorer::RunConfigurationCreationInfo creator;
+            creator.factory = this;
+            creator.buildKey = info.buildKey;
+            creator.displayName = RunConfiguration::displayNamePattern().arg(info.displayName);
+
+            creators << creator;
+        }
+    }
     bc->buildSystem()->setApplicationTargets(buildInfos);
 
     return creators;
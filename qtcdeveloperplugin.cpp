@@ -19,38 +19,98 @@
 #include "qtcdeveloperplugin.h"
 
 #include "qtcdevpluginconstants.h"
+#include "qtcdevpluginlogging.h"
 #include "cmakeqtcrunconfigurationfactory.h"
 #include "qmakeqtcrunconfigurationfactory.h"
 #include "qtcrunconfiguration.h"
 #include "qtctestrunconfiguration.h"
+#include "qtctestallrunconfiguration.h"
 #include "qtcrunworkerfactory.h"
+#include "callgrindprofiler.h"
+#include "heapprofiler.h"
+#include "perfprofiler.h"
+#include "startupcomparison.h"
+#include "launchpreparation.h"
+#include "testwatcher.h"
+#include "tracer.h"
+#include "warmstandby.h"
 
 #ifdef BUILD_TESTS
 #   include "Test/qtcrunconfigurationfactorytest.h"
 #   include "Test/qtcrunconfigurationtest.h"
 #   include "Test/qtcpluginrunnertest.h"
+#   include "Test/testimpactanalyzertest.h"
+#   include "Test/benchmarkhistorytest.h"
+#   include "Test/testwatchdogtest.h"
+#   include "Test/discoverybenchmarktest.h"
+#   include "Test/startupcomparisontest.h"
+#   include "Test/probeservertest.h"
+#   include "Test/perfprofilertest.h"
+#   include "Test/heapprofilertest.h"
+#   include "Test/callgrindprofilertest.h"
+#   include "Test/memorysamplertest.h"
+#   include "Test/settingsclonetest.h"
+#   include "Test/tmpfsdirectorytest.h"
+#   include "Test/plugininstallertest.h"
+#   include "Test/pluginlinkdirectorytest.h"
+#   include "Test/virtualframebuffertest.h"
+#   include "Test/pathaspecttest.h"
+#   include "Test/testwatchertest.h"
+#   include "Test/filestatuscachetest.h"
+#   include "Test/warmstandbytest.h"
+#   include "Test/launchpreparationtest.h"
+#   include "Test/tracertest.h"
 #endif
 
 #include <projectexplorer/projectexplorer.h>
+#include <projectexplorer/projectexplorerconstants.h>
 #include <projectexplorer/runcontrol.h>
+#include <projectexplorer/target.h>
 
 #include <debugger/debuggerruncontrol.h>
 
+#include <coreplugin/actionmanager/actioncontainer.h>
+#include <coreplugin/actionmanager/actionmanager.h>
+#include <coreplugin/actionmanager/command.h>
 #include <coreplugin/icore.h>
+#include <coreplugin/messagemanager.h>
 
 #include <extensionsystem/pluginmanager.h>
 
 #include <QtCore>
+#include <QAction>
 
 using namespace QtcDevPlugin::Internal;
 
-QtcDeveloperPlugin::QtcDeveloperPlugin()
+QtcDeveloperPlugin::QtcDeveloperPlugin() :
+    mTestWatcher(nullptr), mLaunchPreparation(nullptr), mWarmStandby(nullptr)
 {
     // Create your members
 #ifdef BUILD_TESTS
     addTest<Test::QtcRunConfigurationFactoryTest>();
     addTest<Test::QtcRunConfigurationTest>();
     addTest<Test::QtcPluginRunnerTest>();
+    addTest<Test::TestImpactAnalyzerTest>();
+    addTest<Test::BenchmarkHistoryTest>();
+    addTest<Test::TestWatchdogTest>();
+    addTest<Test::DiscoveryBenchmarkTest>();
+    addTest<Test::StartupComparisonTest>();
+    addTest<Test::ProbeServerTest>();
+    addTest<Test::PerfProfilerTest>();
+    addTest<Test::HeapProfilerTest>();
+    addTest<Test::CallgrindProfilerTest>();
+    addTest<Test::MemorySamplerTest>();
+    addTest<Test::SettingsCloneTest>();
+    addTest<Test::TmpfsDirectoryTest>();
+    addTest<Test::PluginInstallerTest>();
+    addTest<Test::PluginLinkDirectoryTest>();
+    addTest<Test::VirtualFramebufferTest>();
+    addTest<Test::PathAspectTest>();
+    addTest<Test::TestWatcherTest>();
+    addTest<Test::FileStatusCacheTest>();
+    addTest<Test::WarmStandbyTest>();
+    addTest<Test::LaunchPreparationTest>();
+    addTest<Test::TracerTest>();
 #endif
 }
 
@@ -86,25 +146,74 @@ Utils::Result<> QtcDeveloperPlugin::initialize(const QStringList& arguments)
     if (translator->load(qmFile, Core::ICore::resourcePath("translations").nativePath()) ||
         translator->load(qmFile, Core::ICore::userResourcePath("translations").nativePath())) {
         if (!qApp->installTranslator(translator))
-            qWarning() << qPrintable(QString(QLatin1String("Failed to install translator (%1)")).arg(qmFile));
+            qCWarning(pluginLog) << qPrintable(QString(QLatin1String("Failed to install translator (%1)")).arg(qmFile));
     } else {
-        qWarning() << qPrintable(QString(QLatin1String("Translator file \"%1\" not found")).arg(qmFile));
+        qCWarning(pluginLog) << qPrintable(QString(QLatin1String("Translator file \"%1\" not found")).arg(qmFile));
     }
 
     mRunConfigurationFactories << new CMakeQtcRunConfigurationFactory<QtcRunConfiguration>();
     mRunConfigurationFactories << new CMakeQtcRunConfigurationFactory<QtcTestRunConfiguration>();
+    mRunConfigurationFactories << new CMakeQtcRunConfigurationFactory<QtcTestAllRunConfiguration>();
     mRunConfigurationFactories << new QMakeQtcRunConfigurationFactory<QtcRunConfiguration>();
     mRunConfigurationFactories << new QMakeQtcRunConfigurationFactory<QtcTestRunConfiguration>();
+    mRunConfigurationFactories << new QMakeQtcRunConfigurationFactory<QtcTestAllRunConfiguration>();
     mRunWorkerFactories << new QtcRunWorkerFactory(ProjectExplorer::Constants::NORMAL_RUN_MODE, [] (ProjectExplorer::RunControl* runControl) {
         return ProjectExplorer::processRecipe(runControl);
     });
     mRunWorkerFactories << new QtcRunWorkerFactory(ProjectExplorer::Constants::DEBUG_RUN_MODE, [] (ProjectExplorer::RunControl* runControl) {
         return Debugger::debuggerRecipe(runControl, Debugger::DebuggerRunParameters::fromRunControl(runControl));
     });
+    mRunWorkerFactories << new QtcRunWorkerFactory(Utils::Id(Constants::StartupComparisonRunMode), [] (ProjectExplorer::RunControl* runControl) {
+        return StartupComparison::receipe(runControl);
+    });
+
+    mRunWorkerFactories << new QtcRunWorkerFactory(Utils::Id(Constants::PerfRunMode), [] (ProjectExplorer::RunControl* runControl) {
+        return PerfProfiler::receipe(runControl);
+    });
+    mRunWorkerFactories << new QtcRunWorkerFactory(Utils::Id(Constants::HeapRunMode), [] (ProjectExplorer::RunControl* runControl) {
+        return HeapProfiler::receipe(runControl);
+    });
+    mRunWorkerFactories << new QtcRunWorkerFactory(Utils::Id(Constants::CallgrindRunMode), [] (ProjectExplorer::RunControl* runControl) {
+        return CallgrindProfiler::receipe(runControl);
+    });
+
+    addRunModeAction(Constants::StartupComparisonActionId, tr("Compare Qt Creator Startup With and Without Plugin"), Constants::StartupComparisonRunMode,
+                     QList<Utils::Id>() << Utils::Id(Constants::QtcRunConfigurationId));
+    addRunModeAction(Constants::PerfActionId, tr("Profile Plugin With perf"), Constants::PerfRunMode,
+                     QList<Utils::Id>() << Utils::Id(Constants::QtcRunConfigurationId)
+                                        << Utils::Id(Constants::QtcTestRunConfigurationId)
+                                        << Utils::Id(Constants::QtcTestAllRunConfigurationId));
+    addRunModeAction(Constants::HeapActionId, tr("Profile Plugin Heap Usage With heaptrack"), Constants::HeapRunMode,
+                     QList<Utils::Id>() << Utils::Id(Constants::QtcRunConfigurationId)
+                                        << Utils::Id(Constants::QtcTestRunConfigurationId)
+                                        << Utils::Id(Constants::QtcTestAllRunConfigurationId));
+    addRunModeAction(Constants::CallgrindActionId, tr("Count Plugin Test Instructions With Callgrind"), Constants::CallgrindRunMode,
+                     QList<Utils::Id>() << Utils::Id(Constants::QtcTestRunConfigurationId)
+                                        << Utils::Id(Constants::QtcTestAllRunConfigurationId));
+
+    mTestWatcher = new TestWatcher(this);
+    mLaunchPreparation = new LaunchPreparation(this);
+    mWarmStandby = new WarmStandby(this);
 
     return Utils::ResultOk;
 }
 
+void QtcDeveloperPlugin::addRunModeAction(const char* actionId, const QString& text, const char* runMode, const QList<Utils::Id>& runConfigIds)
+{
+    QAction* action = new QAction(text, this);
+    Core::Command* command = Core::ActionManager::registerAction(action, Utils::Id(actionId));
+    Core::ActionManager::actionContainer(ProjectExplorer::Constants::M_DEBUG)->addAction(command);
+    connect(action, &QAction::triggered, this, [runMode, runConfigIds] () {
+        ProjectExplorer::RunConfiguration* runConfig = ProjectExplorer::activeRunConfigForActiveProject();
+        if ((runConfig == nullptr) || !runConfigIds.contains(runConfig->id())) {
+            Core::MessageManager::writeFlashing(tr("The active run configuration does not run Qt Creator with a plugin."));
+            return;
+        }
+        ProjectExplorer::ProjectExplorerPlugin::runRunConfiguration(runConfig, Utils::Id(runMode));
+        LaunchPreparation::prepareRun(runConfig);
+    });
+}
+
 void QtcDeveloperPlugin::extensionsInitialized()
 {
     // Retrieve objects from the plugin manager's object pool
@@ -117,5 +226,6 @@ ExtensionSystem::IPlugin::ShutdownFlag QtcDeveloperPlugin::aboutToShutdown()
     // Save settings
     // Disconnect from signals that are not needed during shutdown
     // Hide UI (if you add UI that is not in the main window directly)
+    Tracer::save();
     return SynchronousShutdown;
 }
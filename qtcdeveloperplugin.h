@@ -23,6 +23,7 @@
 
 #include <extensionsystem/iplugin.h>
 #include <utils/fileutils.h>
+#include <utils/id.h>
 
 #include <QLinkedList>
 
@@ -35,6 +36,9 @@ namespace ProjectExplorer {
 namespace QtcDevPlugin {
 namespace Internal {
     class QtcRunConfiguration;
+    class TestWatcher;
+    class LaunchPreparation;
+    class WarmStandby;
 
 /*!
  * \mainpage QtcDev plugin: Qt Creator plugin to develop plugins.
@@ -45,6 +49,25 @@ namespace Internal {
  *  \li Allows to test the current version of the plugin
  *  \li Auto-detection of plugin build output dir (\c DESTDIR) and install dir
  *  \li Tuning theme settings path and working directory of test instance
+ *  \li Running only the tests affected by changes since the last successful test run
+ *  \li Recording \c QBENCHMARK results and reporting regressions
+ *  \li Running tests headless (offscreen or in a private \c Xvfb instance)
+ *  \li Rerunning tests when sources are saved
+ *  \li Stopping hung tests after a timeout, with thread stacks dumped in the output
+ *  \li Testing all the plugins of a project in a single Qt Creator instance
+ *  \li Comparing Qt Creator startup time and peak memory with and without the plugin
+ *  \li Streaming plugin timings, event loop latency and memory usage from the running instance
+ *  \li Reporting main thread stalls with stacks attributed to the plugin
+ *  \li Profiling the plugin with \c perf, with call stacks folded for flame graphs
+ *  \li Profiling the allocations, peak heap and leaks of the plugin with \c heaptrack
+ *  \li Counting the instructions of test functions with Callgrind and reporting regressions
+ *  \li Tracking peak memory and memory growth per test function, with regressions across runs
+ *  \li Cloning a template settings directory for each run (with reflinks or hard links)
+ *  \li Keeping the settings and caches of test instances in memory (in /dev/shm), with a size limit
+ *  \li Preparing launches (command line, environment, settings clone) while the plugins are being built
+ *  \li Installing only the changed plugin files before running, atomically
+ *  \li Loading the plugins through symbolic links to the build tree, without copying them
+ *  \li Keeping a paused Qt Creator instance ready to resume for the next run
  *
  * \section future Planned developments
  * Here are some ideas I plan to implement later:
@@ -169,8 +192,23 @@ public:
      */
     ShutdownFlag aboutToShutdown() override;
 private:
+    /*!
+     * \brief Add a run mode action
+     *
+     * Adds an action to the Debug menu, which runs the active run configuration
+     * in the given run mode, provided it is one of the given run configurations.
+     * \param actionId The id of the action.
+     * \param text The text of the action.
+     * \param runMode The run mode.
+     * \param runConfigIds The ids of the run configurations supported by the run mode.
+     */
+    void addRunModeAction(const char* actionId, const QString& text, const char* runMode, const QList<Utils::Id>& runConfigIds);
+
     QList<ProjectExplorer::RunConfigurationFactory*> mRunConfigurationFactories; /*!< List of run configuration factories created by this plugin (for deletion) */
     QList<ProjectExplorer::RunWorkerFactory*> mRunWorkerFactories;               /*!< List of run worker factory created by this plugin (for deletion) */
+    TestWatcher* mTestWatcher;                                                   /*!< Reruns tests when sources are saved */
+    LaunchPreparation* mLaunchPreparation;                                       /*!< Prepares launches while the plugins are being built */
+    WarmStandby* mWarmStandby;                                                   /*!< Keeps a paused instance ready for the next run */
 };
 
 } // namespace Internal
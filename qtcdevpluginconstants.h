@@ -26,9 +26,36 @@ namespace Constants {
 
 #define QTC_RUN_CONFIGURATION_ID "QtcDevPlugin.QtcRunConfiguration"
 #define QTC_TEST_RUN_CONFIGURATION_ID "QtcDevPlugin.QtcTestRunConfiguration"
+#define QTC_TEST_ALL_RUN_CONFIGURATION_ID "QtcDevPlugin.QtcTestAllRunConfiguration"
 #define QTC_WORKING_DIRECTORY_ID QTC_RUN_CONFIGURATION_ID ".WorkingDirectory"
 #define QTC_SETTINGS_PATH_ID QTC_RUN_CONFIGURATION_ID ".SettingsPath"
 #define QTC_THEME_ID QTC_RUN_CONFIGURATION_ID ".Theme"
+#define QTC_CLONE_SETTINGS_ID QTC_RUN_CONFIGURATION_ID ".CloneSettings"
+#define QTC_STARTUP_LAUNCHES_ID QTC_RUN_CONFIGURATION_ID ".StartupLaunches"
+#define QTC_PROBE_ID QTC_RUN_CONFIGURATION_ID ".Probe"
+#define QTC_STALL_THRESHOLD_ID QTC_RUN_CONFIGURATION_ID ".StallThreshold"
+#define QTC_INSTALL_ID QTC_RUN_CONFIGURATION_ID ".Install"
+#define QTC_INSTALLED_FILES_ID QTC_RUN_CONFIGURATION_ID ".InstalledFiles"
+#define QTC_LINK_PLUGINS_ID QTC_RUN_CONFIGURATION_ID ".LinkPlugins"
+#define QTC_PREWARM_ID QTC_RUN_CONFIGURATION_ID ".Prewarm"
+#define QTC_IMPACTED_TESTS_ONLY_ID QTC_TEST_RUN_CONFIGURATION_ID ".ImpactedTestsOnly"
+#define QTC_TESTED_SOURCES_ID QTC_TEST_RUN_CONFIGURATION_ID ".TestedSources"
+#define QTC_BENCHMARK_ID QTC_TEST_RUN_CONFIGURATION_ID ".Benchmark"
+#define QTC_BENCHMARK_THRESHOLD_ID QTC_TEST_RUN_CONFIGURATION_ID ".BenchmarkThreshold"
+#define QTC_DISPLAY_ID QTC_TEST_RUN_CONFIGURATION_ID ".Display"
+#define QTC_WATCH_ID QTC_TEST_RUN_CONFIGURATION_ID ".Watch"
+#define QTC_WATCH_DELAY_ID QTC_TEST_RUN_CONFIGURATION_ID ".WatchDelay"
+#define QTC_TIMEOUT_ID QTC_TEST_RUN_CONFIGURATION_ID ".Timeout"
+#define QTC_FUNCTION_TIMEOUTS_ID QTC_TEST_RUN_CONFIGURATION_ID ".FunctionTimeouts"
+#define QTC_CALLGRIND_FUNCTIONS_ID QTC_TEST_RUN_CONFIGURATION_ID ".CallgrindFunctions"
+#define QTC_MEMORY_SAMPLING_INTERVAL_ID QTC_TEST_RUN_CONFIGURATION_ID ".MemorySamplingInterval"
+#define QTC_TMPFS_ID QTC_TEST_RUN_CONFIGURATION_ID ".Tmpfs"
+#define QTC_TMPFS_SIZE_LIMIT_ID QTC_TEST_RUN_CONFIGURATION_ID ".TmpfsSizeLimit"
+#define QTC_TESTED_PLUGINS_ID QTC_TEST_ALL_RUN_CONFIGURATION_ID ".TestedPlugins"
+#define QTC_STARTUP_COMPARISON_RUN_MODE "QtcDevPlugin.StartupComparisonRunMode"
+#define QTC_PERF_RUN_MODE "QtcDevPlugin.PerfRunMode"
+#define QTC_HEAP_RUN_MODE "QtcDevPlugin.HeapRunMode"
+#define QTC_CALLGRIND_RUN_MODE "QtcDevPlugin.CallgrindRunMode"
 
 /*!
  * \defgroup QtcDevPluginConstants QtcDevPlugin constants
@@ -36,6 +63,13 @@ namespace Constants {
  */
 const QString PluginName = QLatin1String("QtcDevPlugin");                                           /*!< The name of the plugin (used as root group name in the settings) */
 const QString QtCreatorPluginPriName = QLatin1String("qtcreatorplugin.pri");                        /*!< The name of the project include file for Qt Creator plugins */
+const QString ProbePluginName = QLatin1String("QtcDevProbe");                                       /*!< The name of the probe plugin (see Probe::QtcDevProbe) */
+const QString ProbeDirectoryName = QLatin1String("qtcdevprobe");                                    /*!< The name of the directory containing the probe plugin (next to QtcDevPlugin) */
+const char ProbeServerVariable [] = "QTCDEVPLUGIN_PROBE_SERVER";                                    /*!< The environment variable giving the probe server name to the probe plugin */
+const char ProbeStallThresholdVariable [] = "QTCDEVPLUGIN_PROBE_STALL_THRESHOLD";                   /*!< The environment variable giving the event loop stall threshold to the probe plugin */
+const char ProbeStandbyVariable [] = "QTCDEVPLUGIN_PROBE_STANDBY";                                  /*!< The environment variable asking the probe plugin to stop the instance once plugins are loaded (see Internal::WarmStandby) */
+const char ProbeStandbyMarker [] = "QtcDevProbe: standby";                                          /*!< The line printed by the probe plugin before it stops a standby instance */
+const QString AllPluginsBuildKey = QLatin1String(QTC_TEST_ALL_RUN_CONFIGURATION_ID ".AllPlugins");  /*!< The build key for all the plugins of a project (see Internal::QtcTestAllRunConfiguration) */
 
 /*!
  * \defgroup QtcDevPluginIds QtcDevPlugin Ids
@@ -43,9 +77,40 @@ const QString QtCreatorPluginPriName = QLatin1String("qtcreatorplugin.pri");
  */
 const char QtcRunConfigurationId [] = QTC_RUN_CONFIGURATION_ID;                                     /*!< Id for Internal::QtcRunConfiguration */
 const char QtcTestRunConfigurationId [] = QTC_TEST_RUN_CONFIGURATION_ID;                            /*!< Id for Internal::QtcTestRunConfiguration */
+const char QtcTestAllRunConfigurationId [] = QTC_TEST_ALL_RUN_CONFIGURATION_ID;                     /*!< Id for Internal::QtcTestAllRunConfiguration */
 const char WorkingDirectoryId [] = QTC_WORKING_DIRECTORY_ID;
 const char SettingsPathId [] = QTC_SETTINGS_PATH_ID;
 const char ThemeId [] = QTC_THEME_ID;
+const char CloneSettingsId [] = QTC_CLONE_SETTINGS_ID;
+const char StartupLaunchesId [] = QTC_STARTUP_LAUNCHES_ID;
+const char ProbeId [] = QTC_PROBE_ID;
+const char StallThresholdId [] = QTC_STALL_THRESHOLD_ID;
+const char InstallId [] = QTC_INSTALL_ID;
+const char InstalledFilesId [] = QTC_INSTALLED_FILES_ID;
+const char LinkPluginsId [] = QTC_LINK_PLUGINS_ID;
+const char PrewarmId [] = QTC_PREWARM_ID;
+const char ImpactedTestsOnlyId [] = QTC_IMPACTED_TESTS_ONLY_ID;
+const char TestedSourcesId [] = QTC_TESTED_SOURCES_ID;
+const char BenchmarkId [] = QTC_BENCHMARK_ID;
+const char BenchmarkThresholdId [] = QTC_BENCHMARK_THRESHOLD_ID;
+const char DisplayId [] = QTC_DISPLAY_ID;
+const char WatchId [] = QTC_WATCH_ID;
+const char WatchDelayId [] = QTC_WATCH_DELAY_ID;
+const char TimeoutId [] = QTC_TIMEOUT_ID;
+const char FunctionTimeoutsId [] = QTC_FUNCTION_TIMEOUTS_ID;
+const char CallgrindFunctionsId [] = QTC_CALLGRIND_FUNCTIONS_ID;
+const char MemorySamplingIntervalId [] = QTC_MEMORY_SAMPLING_INTERVAL_ID;
+const char TmpfsId [] = QTC_TMPFS_ID;
+const char TmpfsSizeLimitId [] = QTC_TMPFS_SIZE_LIMIT_ID;
+const char TestedPluginsId [] = QTC_TESTED_PLUGINS_ID;
+const char StartupComparisonRunMode [] = QTC_STARTUP_COMPARISON_RUN_MODE;                           /*!< Run mode comparing startup with and without the plugins (see Internal::StartupComparison) */
+const char StartupComparisonActionId [] = QTC_STARTUP_COMPARISON_RUN_MODE ".Action";                /*!< Id for the action starting Internal::StartupComparison */
+const char PerfRunMode [] = QTC_PERF_RUN_MODE;                                                      /*!< Run mode profiling the plugins with perf (see Internal::PerfProfiler) */
+const char PerfActionId [] = QTC_PERF_RUN_MODE ".Action";                                           /*!< Id for the action starting Internal::PerfProfiler */
+const char HeapRunMode [] = QTC_HEAP_RUN_MODE;                                                      /*!< Run mode profiling the heap usage of the plugins with heaptrack (see Internal::HeapProfiler) */
+const char HeapActionId [] = QTC_HEAP_RUN_MODE ".Action";                                           /*!< Id for the action starting Internal::HeapProfiler */
+const char CallgrindRunMode [] = QTC_CALLGRIND_RUN_MODE;                                            /*!< Run mode counting the instructions of test functions with Callgrind (see Internal::CallgrindProfiler) */
+const char CallgrindActionId [] = QTC_CALLGRIND_RUN_MODE ".Action";                                 /*!< Id for the action starting Internal::CallgrindProfiler */
 /*!@}*/
 
 /*!
@@ -55,6 +120,31 @@ const char ThemeId [] = QTC_THEME_ID;
 const char WorkingDirectoryKey [] = QTC_RUN_CONFIGURATION_ID ".WorkingDirectory";                   /*!< Key for working directory path Internal::QtcRunConfiguration */
 const char SettingsPathKey [] = QTC_RUN_CONFIGURATION_ID ".SettingsPath";                           /*!< Key for Qt Creator settings path Internal::QtcRunConfiguration */
 const char ThemeKey [] = QTC_RUN_CONFIGURATION_ID ".Theme";                                         /*!< Key for the theme in Internal::QtcRunConfiguration */
+const char CloneSettingsKey [] = QTC_RUN_CONFIGURATION_ID ".CloneSettings";                         /*!< Key for cloning the settings path for each run in Internal::QtcRunConfiguration */
+const char StartupLaunchesKey [] = QTC_RUN_CONFIGURATION_ID ".StartupLaunches";                     /*!< Key for the number of launches of startup comparisons in Internal::QtcRunConfiguration */
+const char ProbeKey [] = QTC_RUN_CONFIGURATION_ID ".Probe";                                         /*!< Key for streaming runtime metrics with the probe plugin in Internal::QtcRunConfiguration */
+const char StallThresholdKey [] = QTC_RUN_CONFIGURATION_ID ".StallThreshold";                       /*!< Key for the event loop stall threshold in Internal::QtcRunConfiguration */
+const char InstallKey [] = QTC_RUN_CONFIGURATION_ID ".Install";                                     /*!< Key for installing the changed plugin files before running in Internal::QtcRunConfiguration */
+const char LinkPluginsKey [] = QTC_RUN_CONFIGURATION_ID ".LinkPlugins";                             /*!< Key for loading the plugins through links to the build tree in Internal::QtcRunConfiguration */
+const char PrewarmKey [] = QTC_RUN_CONFIGURATION_ID ".Prewarm";                                     /*!< Key for keeping a paused instance ready for the next run in Internal::QtcRunConfiguration */
+/*!@}*/
+
+/*!
+ * \defgroup QtcTestRunConfigurationSettings QtcTestRunConfiguration settings
+ * @{
+ */
+const char ImpactedTestsOnlyKey [] = QTC_TEST_RUN_CONFIGURATION_ID ".ImpactedTestsOnly";           /*!< Key for running only the tests affected by changes in Internal::QtcTestRunConfiguration */
+const char BenchmarkKey [] = QTC_TEST_RUN_CONFIGURATION_ID ".Benchmark";                            /*!< Key for recording benchmark results in Internal::QtcTestRunConfiguration */
+const char BenchmarkThresholdKey [] = QTC_TEST_RUN_CONFIGURATION_ID ".BenchmarkThreshold";          /*!< Key for the benchmark regression threshold in Internal::QtcTestRunConfiguration */
+const char DisplayKey [] = QTC_TEST_RUN_CONFIGURATION_ID ".Display";                                /*!< Key for the display of the test instance in Internal::QtcTestRunConfiguration */
+const char WatchKey [] = QTC_TEST_RUN_CONFIGURATION_ID ".Watch";                                    /*!< Key for rerunning tests on save in Internal::QtcTestRunConfiguration */
+const char WatchDelayKey [] = QTC_TEST_RUN_CONFIGURATION_ID ".WatchDelay";                          /*!< Key for the delay before rerunning tests on save in Internal::QtcTestRunConfiguration */
+const char TimeoutKey [] = QTC_TEST_RUN_CONFIGURATION_ID ".Timeout";                                /*!< Key for the timeout of test functions in Internal::QtcTestRunConfiguration */
+const char FunctionTimeoutsKey [] = QTC_TEST_RUN_CONFIGURATION_ID ".FunctionTimeouts";              /*!< Key for the timeouts of specific test functions in Internal::QtcTestRunConfiguration */
+const char CallgrindFunctionsKey [] = QTC_TEST_RUN_CONFIGURATION_ID ".CallgrindFunctions";          /*!< Key for the test functions measured by Callgrind in Internal::QtcTestRunConfiguration */
+const char MemorySamplingIntervalKey [] = QTC_TEST_RUN_CONFIGURATION_ID ".MemorySamplingInterval";  /*!< Key for the memory sampling interval in Internal::QtcTestRunConfiguration */
+const char TmpfsKey [] = QTC_TEST_RUN_CONFIGURATION_ID ".Tmpfs";                                    /*!< Key for using ephemeral settings and cache directories in memory in Internal::QtcTestRunConfiguration */
+const char TmpfsSizeLimitKey [] = QTC_TEST_RUN_CONFIGURATION_ID ".TmpfsSizeLimit";                  /*!< Key for the size limit of ephemeral settings and cache directories in Internal::QtcTestRunConfiguration */
 /*!@}*/
 
 /*!@}*/
@@ -0,0 +1,44 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef QTCDEVPLUGINLOGGING_H
+#define QTCDEVPLUGINLOGGING_H
+
+#include <QLoggingCategory>
+
+namespace QtcDevPlugin {
+
+/*!
+ * \defgroup QtcDevPluginLogging QtcDevPlugin logging categories
+ *
+ * Debug messages are disabled by default in all these categories.
+ * They can be enabled with logging rules, e.g.
+ * <tt>QT_LOGGING_RULES="qtcdevplugin.*.debug=true"</tt>.
+ * @{
+ */
+Q_DECLARE_LOGGING_CATEGORY(pluginLog)       /*!< Plugin initialization (\c qtcdevplugin.plugin) */
+Q_DECLARE_LOGGING_CATEGORY(discoveryLog)    /*!< Discovery of Qt Creator plugins in projects (\c qtcdevplugin.discovery) */
+Q_DECLARE_LOGGING_CATEGORY(launchLog)       /*!< Preparation and launch of Qt Creator instances (\c qtcdevplugin.launch) */
+Q_DECLARE_LOGGING_CATEGORY(aspectsLog)      /*!< Run configuration aspects (\c qtcdevplugin.aspects) */
+Q_DECLARE_LOGGING_CATEGORY(validationLog)   /*!< Path validation (\c qtcdevplugin.validation) */
+Q_DECLARE_LOGGING_CATEGORY(testsLog)        /*!< Test selection, benchmarks and watchdog (\c qtcdevplugin.tests) */
+/*!@}*/
+
+} // QtcDevPlugin
+
+#endif // QTCDEVPLUGINLOGGING_H
@@ -19,7 +19,13 @@
 #include "qtcrunconfiguration.h"
 #include "qtcdevpluginconstants.h"
 #include "pathaspect.h"
+#include "pluginlinkdirectory.h"
+#include "qtcdevpluginlogging.h"
+#include "startupcomparison.h"
+#include "tracer.h"
+#include "warmstandby.h"
 
+#include <projectexplorer/buildsystem.h>
 #include <projectexplorer/runconfigurationaspects.h>
 #include <projectexplorer/devicesupport/devicemanager.h>
 #include <projectexplorer/target.h>
@@ -32,11 +38,13 @@
 
 #include <coreplugin/icore.h>
 
+#include <extensionsystem/pluginmanager.h>
+#include <extensionsystem/pluginspec.h>
+
 #include <utils/macroexpander.h>
 #include <utils/processinterface.h>
 #include <utils/theme/theme.h>
 
-#include <QtDebug>
 
 namespace QtcDevPlugin {
 namespace Internal {
@@ -50,6 +58,8 @@ namespace Internal {
 // TODO this should be available from Qt Creator util library
 QStringList availableThemes(void)
 {
+    TraceSpan span("launch", QLatin1String("Theme scan"));
+
     QStringList themes;
     Utils::FileFilter fileFilter(QStringList() << QLatin1String("*.creatortheme"), QDir::Files);
 
@@ -67,9 +77,9 @@ QStringList availableThemes(void)
     if (currentIndex != -1)
         themes.prepend(themes.takeAt(currentIndex));
     else
-        qWarning() << "Current theme \"" + Utils::creatorTheme()->displayName() + "\" theme not found in ressource path.";
+        qCWarning(launchLog) << "Current theme \"" + Utils::creatorTheme()->displayName() + "\" theme not found in ressource path.";
 
-    qDebug() << themes << Core::ICore::resourcePath("themes") << Core::ICore::userResourcePath("themes");
+    qCDebug(launchLog) << themes << Core::ICore::resourcePath("themes") << Core::ICore::userResourcePath("themes");
 
     return themes;
 }
@@ -94,6 +104,12 @@ QtcRunConfiguration::QtcRunConfiguration(ProjectExplorer::BuildConfiguration* pa
     mSettingsPathAspect.setCheckable(true);
     mSettingsPathAspect.setMacroExpanderProvider([this] {return const_cast<Utils::MacroExpander*>(macroExpander());});
 
+    mCloneSettingsAspect.setId(Utils::Id(Constants::CloneSettingsId));
+    mCloneSettingsAspect.setSettingsKey(Utils::Key(Constants::CloneSettingsKey));
+    mCloneSettingsAspect.setLabelText(tr("Use the alternative settings as a template cloned for each run"));
+    mCloneSettingsAspect.setToolTip(tr("Each run uses a fresh clone of the alternative settings directory (with reflinks or hard links when possible), so that runs never modify it."));
+    mCloneSettingsAspect.setDefaultValue(false);
+
     mThemeAspect.setId(Utils::Id(Constants::ThemeId));
     mThemeAspect.setSettingsKey(Utils::Key(Constants::ThemeKey));
     mThemeAspect.setDisplayName(tr("Theme:"));
@@ -101,14 +117,72 @@ QtcRunConfiguration::QtcRunConfiguration(ProjectExplorer::BuildConfiguration* pa
     for (QString theme: availableThemes())
         mThemeAspect.addOption(theme);
 
+    // NOTE Startup comparisons make no sense for test instances, which exit after the tests.
+    mStartupLaunchesAspect.setId(Utils::Id(Constants::StartupLaunchesId));
+    mStartupLaunchesAspect.setSettingsKey(Utils::Key(Constants::StartupLaunchesKey));
+    mStartupLaunchesAspect.setLabelText(tr("Startup comparison launches:"));
+    mStartupLaunchesAspect.setToolTip(tr("Number of launches with and without the plugin when comparing Qt Creator startup."));
+    mStartupLaunchesAspect.setRange(1, 100);
+    mStartupLaunchesAspect.setDefaultValue(StartupComparison::DefaultLaunches);
+    mStartupLaunchesAspect.setVisible(id == Utils::Id(Constants::QtcRunConfigurationId));
+
+    mProbeAspect.setId(Utils::Id(Constants::ProbeId));
+    mProbeAspect.setSettingsKey(Utils::Key(Constants::ProbeKey));
+    mProbeAspect.setLabelText(tr("Stream runtime metrics from the instance"));
+    mProbeAspect.setToolTip(tr("Loads a probe plugin in the instance, which reports plugin initialisation timings, event loop latency, memory usage and object counts."));
+    mProbeAspect.setDefaultValue(false);
+    mProbeAspect.setVisible(id == Utils::Id(Constants::QtcRunConfigurationId));
+
+    mStallThresholdAspect.setId(Utils::Id(Constants::StallThresholdId));
+    mStallThresholdAspect.setSettingsKey(Utils::Key(Constants::StallThresholdKey));
+    mStallThresholdAspect.setLabelText(tr("Event loop stall threshold:"));
+    mStallThresholdAspect.setToolTip(tr("The probe reports the stack of the main thread when its event loop is blocked longer (0 disables stall detection)."));
+    mStallThresholdAspect.setSuffix(QLatin1String(" ms"));
+    mStallThresholdAspect.setRange(0, 60000);
+    mStallThresholdAspect.setDefaultValue(0);
+    mStallThresholdAspect.setEnabler(&mProbeAspect);
+    mStallThresholdAspect.setVisible(id == Utils::Id(Constants::QtcRunConfigurationId));
+
+    mInstallAspect.setId(Utils::Id(Constants::InstallId));
+    mInstallAspect.setSettingsKey(Utils::Key(Constants::InstallKey));
+    mInstallAspect.setLabelText(tr("Install changed plugin files before running"));
+    mInstallAspect.setToolTip(tr("The built plugin files whose contents differ from the installed ones are copied to the install directory before running."));
+    mInstallAspect.setDefaultValue(false);
+
+    // NOTE This aspect has no settings key (it is not saved) and no widget.
+    mInstalledFilesAspect.setId(Utils::Id(Constants::InstalledFilesId));
+
+    mLinkPluginsAspect.setId(Utils::Id(Constants::LinkPluginsId));
+    mLinkPluginsAspect.setSettingsKey(Utils::Key(Constants::LinkPluginsKey));
+    mLinkPluginsAspect.setLabelText(tr("Load the plugins through links to the build tree"));
+    mLinkPluginsAspect.setToolTip(tr("The instance loads the plugins from a directory of symbolic links to the built plugin files, created for each run, instead of searching the build directory."));
+    mLinkPluginsAspect.setDefaultValue(false);
+    mLinkPluginsAspect.setVisible(PluginLinkDirectory::isAvailable());
+
+    mPrewarmAspect.setId(Utils::Id(Constants::PrewarmId));
+    mPrewarmAspect.setSettingsKey(Utils::Key(Constants::PrewarmKey));
+    mPrewarmAspect.setLabelText(tr("Keep a paused instance ready for the next run"));
+    mPrewarmAspect.setToolTip(tr("After each run, the next instance is started in the background and paused once the plugins are loaded. "
+                                 "It is resumed by the next run, unless the plugins were rebuilt meanwhile. "
+                                 "This is not used with a virtual framebuffer, the probe plugin, cloned or in memory settings and plugin links."));
+    mPrewarmAspect.setDefaultValue(false);
+    mPrewarmAspect.setVisible(WarmStandby::isAvailable());
+
+    setUpdater([this] {
+        updateInstalledFiles();
+    });
+
     mEnvironmentAspect.setSupportForBuildEnvironment(parent);
 
-    /* TODO ensure this run configuration cannot be run with valgrind...
-     * To do this, the code of the Valgrind plugin should be altered:
-     * 1.ValgrindRunControlFactory should check the type of the given RunConfiguration (e.g. in canRun())
-     * and addAspects() should only add aspects provided bu runnable RunControl factories.
-     * 2.Alternatively, ValgrindPlugin, should ensure the extra aspects are added to
-     * sensible RunConfiguration and RunConfiguration::addExtraAspects() should be removed. */
+    connect(this, &Utils::AspectContainer::changed, this, &QtcRunConfiguration::discardPreparedLaunch);
+    connect(&mEnvironmentAspect, &ProjectExplorer::EnvironmentAspect::environmentChanged, this, &QtcRunConfiguration::discardPreparedLaunch);
+    // NOTE The project may be parsed again during the build (e.g. CMake reconfigures), which changes the build target info.
+    if (buildSystem() != nullptr)
+        connect(buildSystem(), &ProjectExplorer::BuildSystem::parsingFinished, this, &QtcRunConfiguration::discardPreparedLaunch);
+
+    /* NOTE Valgrind is supported through the run modes of QtcRunWorkerFactory
+     * (see CallgrindProfiler), which apply plugin shadowing and wrap
+     * the command line of the instance, rather than through Valgrind plugin run modes. */
 }
 
 QString QtcRunConfiguration::pluginName(void) const
@@ -116,8 +190,44 @@ QString QtcRunConfiguration::pluginName(void) const
     return buildTargetInfo().displayName;
 }
 
+QList<Utils::FilePath> QtcRunConfiguration::pluginSearchPaths(void) const
+{
+    return QList<Utils::FilePath>() << buildTargetInfo().workingDirectory;
+}
+
+QList<PluginInstaller::File> QtcRunConfiguration::installedFiles(void) const
+{
+    return PluginInstaller::files(buildTargetInfo());
+}
+
+void QtcRunConfiguration::updateInstalledFiles(void)
+{
+    mInstalledFilesAspect.setValue(PluginInstaller::encode(installedFiles()));
+}
+
+Utils::FilePath QtcRunConfiguration::probePath(void)
+{
+    ExtensionSystem::PluginSpec* spec = ExtensionSystem::PluginManager::specById(QLatin1String("qtcdevplugin"));
+    if (spec == nullptr)
+        return Utils::FilePath();
+
+    Utils::FilePath path = spec->filePath().parentDir().pathAppended(Constants::ProbeDirectoryName);
+    return path.isDir() ? path : Utils::FilePath();
+}
+
+void QtcRunConfiguration::prepareLaunch(void)
+{
+    mPreparedRunnable.reset();
+
+    TraceSpan span("launch", QLatin1String("Launch preparation"));
+    mPreparedRunnable = runnable();
+}
+
 Utils::ProcessRunData QtcRunConfiguration::runnable(void) const
 {
+    if (mPreparedRunnable.has_value())
+        return *mPreparedRunnable;
+
     Utils::ProcessRunData runnable;
     runnable.command = Utils::CommandLine(
         Utils::FilePath::fromString(QCoreApplication::applicationFilePath()),
@@ -139,11 +249,27 @@ QStringList QtcRunConfiguration::commandLineArgumentsList(void) const
     if ((themeIndex >= 0) && (themeIndex < themes.size()))
         cmdArgs << QLatin1String("-theme") << themes[themeIndex];
 
-    QString pluginsPath = buildTargetInfo().workingDirectory.nativePath();
-    pluginsPath.replace(QLatin1Char('"'), QLatin1String("\\\""));
-    if (pluginsPath.contains(QLatin1Char(' ')))
-        pluginsPath.prepend(QLatin1Char('"')).append(QLatin1Char('"'));
-    cmdArgs << QLatin1String("-pluginpath") << pluginsPath;
+    for (Utils::FilePath pluginSearchPath : pluginSearchPaths()) {
+        QString pluginsPath = pluginSearchPath.nativePath();
+        pluginsPath.replace(QLatin1Char('"'), QLatin1String("\\\""));
+        if (pluginsPath.contains(QLatin1Char(' ')))
+            pluginsPath.prepend(QLatin1Char('"')).append(QLatin1Char('"'));
+        cmdArgs << QLatin1String("-pluginpath") << pluginsPath;
+    }
+
+    if (mProbeAspect()) {
+        Utils::FilePath probeSearchPath = probePath();
+        if (probeSearchPath.isEmpty()) {
+            qCWarning(launchLog) << "Probe plugin is not installed";
+        } else {
+            QString probeDir = probeSearchPath.nativePath();
+            probeDir.replace(QLatin1Char('"'), QLatin1String("\\\""));
+            if (probeDir.contains(QLatin1Char(' ')))
+                probeDir.prepend(QLatin1Char('"')).append(QLatin1Char('"'));
+            cmdArgs << QLatin1String("-pluginpath") << probeDir;
+            cmdArgs << QLatin1String("-load") << Constants::ProbePluginName;
+        }
+    }
 
     QString settingsPath = static_cast<PathAspect*>(aspect(Utils::Id(Constants::SettingsPathId)))->value().nativePath();
     if (macroExpander() != NULL)
@@ -154,7 +280,7 @@ QStringList QtcRunConfiguration::commandLineArgumentsList(void) const
     if (!settingsPath.isEmpty())
         cmdArgs << QLatin1String("-settingspath") << settingsPath;
 
-    qDebug() << "Run config command line arguments:" << cmdArgs;
+    qCDebug(launchLog) << "Run config command line arguments:" << cmdArgs;
     return cmdArgs;
 }
 
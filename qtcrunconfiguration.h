@@ -21,6 +21,7 @@
 
 #include "qtcdevpluginconstants.h"
 #include "pathaspect.h"
+#include "plugininstaller.h"
 
 #include <projectexplorer/environmentaspect.h>
 #include <projectexplorer/projectconfiguration.h>
@@ -29,6 +30,8 @@
 #include <utils/fileutils.h>
 #include <utils/aspects.h>
 
+#include <optional>
+
 namespace ProjectExplorer {
     class ProjectNode;
     class Project;
@@ -85,6 +88,30 @@ public:
      * \return The runnable for this runconfiguration
      */
     virtual Utils::ProcessRunData runnable(void) const override;
+    /*!
+     * \brief Prepare the launch
+     *
+     * Computes the runnable ahead of the launch (e.g. while the plugin is being built),
+     * so that runnable() returns it at once until discardPreparedLaunch() is called,
+     * the run configuration changes or the project is parsed again.
+     *
+     * The tests affected by changes are selected by the run worker,
+     * since they are found with the dependency files written by the build.
+     * \sa LaunchPreparation
+     */
+    void prepareLaunch(void);
+    /*!
+     * \brief Discard the prepared launch
+     *
+     * Discards the runnable computed by prepareLaunch(), so that the next calls to runnable()
+     * compute it again.
+     */
+    inline void discardPreparedLaunch(void) {mPreparedRunnable.reset();}
+    /*!
+     * \brief Whether the launch is prepared
+     * \return \c true if the runnable was computed by prepareLaunch() and not discarded yet.
+     */
+    inline bool isLaunchPrepared(void) const {return mPreparedRunnable.has_value();}
 
     /*!
      * \brief The path of the plugin when installed
@@ -104,6 +131,33 @@ public:
      * \sa targetFilePath()
      */
     QString pluginName(void) const;
+    /*!
+     * \brief The plugin search paths
+     *
+     * Returns the paths where the test instance searches for the plugin(s) being developped.
+     * They are passed to Qt Creator with \c -pluginpath.
+     * \return The plugin search paths.
+     */
+    virtual QList<Utils::FilePath> pluginSearchPaths(void) const;
+    /*!
+     * \brief The installed files
+     *
+     * Returns the files of the plugin(s) being developped which are installed before running
+     * (when enabled in the run configuration).
+     * \return The files to install.
+     * \sa PluginInstaller
+     */
+    virtual QList<PluginInstaller::File> installedFiles(void) const;
+    /*!
+     * \brief The probe plugin path
+     *
+     * Returns the path to the directory containing the probe plugin
+     * (which is installed next to QtcDevPlugin).
+     * \return The path to the directory containing the probe plugin,
+     * or an empty path if it is not installed.
+     * \sa Probe::QtcDevProbe
+     */
+    static Utils::FilePath probePath(void);
 
     /*!
      * \brief The run configuration id
@@ -121,11 +175,39 @@ public:
      * \return The pattern for the display name of the run configuration.
      */
     static QString displayNamePattern(void);
+    /*!
+     * \brief Whether the run configuration aggregates plugins
+     *
+     * This function tells the run configuration factories whether
+     * they should create one run configuration for each plugin (\c false)
+     * or one for all the plugins of the project (\c true).
+     * \return Whether the run configuration aggregates the plugins of the project.
+     */
+    static constexpr bool aggregatesPlugins(void) {return false;}
+protected:
+    /*!
+     * \brief Update the installed files
+     *
+     * Updates the installed files passed to the run control.
+     * This function must be called by the updaters of derived classes.
+     * \sa installedFiles()
+     */
+    void updateInstalledFiles(void);
 private:
     PathAspect mWorkingDirectoryAspect{this};
     PathAspect mSettingsPathAspect{this};
+    Utils::BoolAspect mCloneSettingsAspect{this};
     Utils::SelectionAspect mThemeAspect{this};
+    Utils::IntegerAspect mStartupLaunchesAspect{this};
+    Utils::BoolAspect mProbeAspect{this};
+    Utils::IntegerAspect mStallThresholdAspect{this};
+    Utils::BoolAspect mInstallAspect{this};
+    Utils::StringListAspect mInstalledFilesAspect{this};
+    Utils::BoolAspect mLinkPluginsAspect{this};
+    Utils::BoolAspect mPrewarmAspect{this};
     ProjectExplorer::EnvironmentAspect mEnvironmentAspect{this};
+
+    std::optional<Utils::ProcessRunData> mPreparedRunnable;     /*!< The runnable computed by prepareLaunch() */
 };
 
 } // Internal
@@ -1,14 +1,56 @@
 #include "qtcrunworkerfactory.h"
 
 #include "qtcdevpluginconstants.h"
+#include "qtcdevpluginlogging.h"
+#include "benchmarkhistory.h"
+#include "launchpreparation.h"
+#include "memorysampler.h"
+#include "plugininstaller.h"
+#include "pluginlinkdirectory.h"
+#include "probeserver.h"
+#include "settingsclone.h"
+#include "tmpfsdirectory.h"
+#include "qtctestrunconfiguration.h"
+#include "testimpactanalyzer.h"
+#include "testwatchdog.h"
+#include "tracer.h"
+#include "virtualframebuffer.h"
+#include "warmstandby.h"
 
 #include <projectexplorer/projectexplorerconstants.h>
 
 #include <extensionsystem/pluginmanager.h>
 
+#include <solutions/tasking/barrier.h>
+
+#include <utils/async.h>
+#include <utils/hostosinfo.h>
+#include <utils/outputformat.h>
+
+#include <QFutureWatcher>
+#include <QTimer>
+
 namespace QtcDevPlugin {
 namespace Internal {
 
+/*!
+ * \brief Value of an aspect
+ *
+ * Returns the value of the aspect with the given id
+ * in the data copied from the run configuration by the run control.
+ * \tparam Aspect The type of the aspect (e.g. Utils::BoolAspect, Utils::IntegerAspect).
+ * \param runControl A run control.
+ * \param id The id of the aspect.
+ * \param defaultValue The value returned if the run configuration does not have this aspect.
+ * \return The value of the aspect or \p defaultValue if the run configuration does not have this aspect.
+ */
+template <class Aspect>
+static auto aspectValue(ProjectExplorer::RunControl* runControl, const char* id, decltype(Aspect::Data::value) defaultValue = {})
+{
+    auto data = static_cast<const typename Aspect::Data*>(runControl->aspectData(Utils::Id(id)));
+    return (data != nullptr) ? data->value : defaultValue;
+}
+
 QtcRunWorkerFactory::QtcRunWorkerFactory(Utils::Id runMode, const ReceipeProducer& baseReceipe)
     : ProjectExplorer::RunWorkerFactory()
 {
@@ -18,20 +60,350 @@ QtcRunWorkerFactory::QtcRunWorkerFactory(Utils::Id runMode, const ReceipeProduce
 
     addSupportedRunConfig(Utils::Id(Constants::QtcRunConfigurationId));
     addSupportedRunConfig(Utils::Id(Constants::QtcTestRunConfigurationId));
+    addSupportedRunConfig(Utils::Id(Constants::QtcTestAllRunConfigurationId));
 
     setProducer([this, baseReceipe] (ProjectExplorer::RunControl* runControl) {
+        auto output = std::make_shared<QString>();
+
+        QList<Utils::FilePath> builtFiles = WarmStandby::builtFiles(runControl->commandLine().splitArguments(), pluginFiles(runControl));
+        for (PluginInstaller::File file : PluginInstaller::decode(aspectValue<Utils::StringListAspect>(runControl, Constants::InstalledFilesId))) {
+            if (!builtFiles.contains(file.source))
+                builtFiles << file.source;
+        }
+        const WarmStandby::Launch launch = {
+            .command = runControl->commandLine(),
+            .environment = runControl->environment(),
+            .workingDirectory = runControl->workingDirectory(),
+            .pluginFiles = pluginFiles(runControl),
+            .builtFiles = builtFiles,
+        };
+
+        /* NOTE Resources created for each run (e.g. the display, the probe server, the settings clone) cannot be given to a standby instance.
+         * Without the built plugin files, rebuilds cannot be detected. */
+        const bool prewarm = aspectValue<Utils::BoolAspect>(runControl, Constants::PrewarmId)
+                             && !builtFiles.isEmpty()
+                             && WarmStandby::isAvailable()
+                             && (runControl->runMode() == ProjectExplorer::Constants::NORMAL_RUN_MODE)
+                             && (aspectValue<Utils::SelectionAspect>(runControl, Constants::DisplayId) != QtcTestRunConfiguration::VirtualFramebufferDisplay)
+                             && !aspectValue<Utils::BoolAspect>(runControl, Constants::ProbeId)
+                             && !aspectValue<Utils::BoolAspect>(runControl, Constants::CloneSettingsId)
+                             && !aspectValue<Utils::BoolAspect>(runControl, Constants::TmpfsId)
+                             && !aspectValue<Utils::BoolAspect>(runControl, Constants::LinkPluginsId)
+                             && !aspectValue<Utils::BoolAspect>(runControl, Constants::ImpactedTestsOnlyId);
+        QByteArray standbyOutput;
+        std::shared_ptr<Utils::Process> standby;
+        if (prewarm)
+            standby = WarmStandby::take(launch, &standbyOutput);
+
+        // NOTE The debugger receipe copies the command line when it is created, hence tests must be selected beforehand.
+        const bool impactedTestsOnly = aspectValue<Utils::BoolAspect>(runControl, Constants::ImpactedTestsOnlyId);
+        auto noImpactedTests = std::make_shared<bool>(false);
+        if (impactedTestsOnly && (runControl->runMode() == ProjectExplorer::Constants::DEBUG_RUN_MODE)) {
+            *noImpactedTests = !selectImpactedTests(runControl, impactedTests(aspectValue<Utils::StringListAspect>(runControl, Constants::TestedSourcesId),
+                                                                              runControl->buildDirectory(), runControl->buildKey()));
+        }
+
+        /* NOTE The display of the virtual frame buffer is only known once it is started (see the group below).
+         * The debugger receipe copies the environment when it is created, hence the virtual frame buffer must be started beforehand. */
+        std::shared_ptr<VirtualFramebuffer> framebuffer;
+        if (aspectValue<Utils::SelectionAspect>(runControl, Constants::DisplayId) == QtcTestRunConfiguration::VirtualFramebufferDisplay) {
+            framebuffer = std::make_shared<VirtualFramebuffer>();
+            if (runControl->runMode() == ProjectExplorer::Constants::DEBUG_RUN_MODE) {
+                framebuffer->start();
+                if (framebuffer->waitForStarted())
+                    setDisplay(runControl, framebuffer->display());
+            }
+        }
+
+        // NOTE The environment must be set before the base receipe is created.
+        if (aspectValue<Utils::BoolAspect>(runControl, Constants::ProbeId)) {
+            ProbeServer* probeServer = new ProbeServer(runControl);
+            QObject::connect(probeServer, &ProbeServer::reported, runControl, [runControl] (const QString& line) {
+                runControl->postMessage(line, Utils::NormalMessageFormat);
+            });
+            QObject::connect(runControl, &ProjectExplorer::RunControl::stopped,
+                             probeServer, &QObject::deleteLater);
+            QStringList pluginFileNames;
+            if (!runControl->targetFilePath().isEmpty())
+                pluginFileNames << runControl->targetFilePath().fileName();
+            probeServer->setPluginFileNames(pluginFileNames);
+            if (probeServer->isListening()) {
+                Utils::Environment env = runControl->environment();
+                env.set(QLatin1String(Constants::ProbeServerVariable), probeServer->serverName());
+                int stallThreshold = aspectValue<Utils::IntegerAspect>(runControl, Constants::StallThresholdId);
+                if (stallThreshold > 0)
+                    env.set(QLatin1String(Constants::ProbeStallThresholdVariable), QString::number(stallThreshold));
+                runControl->setEnvironment(env);
+            }
+        }
+
+        std::shared_ptr<TmpfsDirectory> tmpfsDirectory;
+        Utils::Result<> tmpfsResult = Utils::ResultOk;
+        if (aspectValue<Utils::BoolAspect>(runControl, Constants::TmpfsId) && TmpfsDirectory::isAvailable()) {
+            tmpfsDirectory = std::make_shared<TmpfsDirectory>(aspectValue<Utils::IntegerAspect>(runControl, Constants::TmpfsSizeLimitId, TmpfsDirectory::DefaultSizeLimit));
+            tmpfsResult = tmpfsDirectory->create();
+            if (tmpfsResult) {
+                Utils::Environment env = runControl->environment();
+                env.set(QLatin1String("XDG_CACHE_HOME"), tmpfsDirectory->cachePath());
+                runControl->setEnvironment(env);
+            }
+        }
+
+        // NOTE The command line must also be set before the base receipe is created.
+        std::shared_ptr<PluginLinkDirectory> pluginLinks;
+        Utils::Result<> pluginLinksResult = Utils::ResultOk;
+        if (aspectValue<Utils::BoolAspect>(runControl, Constants::LinkPluginsId) && PluginLinkDirectory::isAvailable()) {
+            QList<Utils::FilePath> pluginFiles;
+            for (PluginInstaller::File file : PluginInstaller::decode(aspectValue<Utils::StringListAspect>(runControl, Constants::InstalledFilesId)))
+                pluginFiles << file.source;
+            pluginLinks = std::make_shared<PluginLinkDirectory>();
+            Utils::CommandLine command = runControl->commandLine();
+            // NOTE The other plugins in the replaced plugin paths (e.g. the dependencies of the tested plugin) are linked too.
+            pluginLinksResult = pluginFiles.isEmpty() ? Utils::ResultError(tr("The built plugin files are unknown (only CMake projects provide them)."))
+                                                      : pluginLinks->link(pluginFiles + PluginLinkDirectory::siblingPlugins(command.splitArguments(), pluginFiles));
+            if (pluginLinksResult) {
+                QStringList args = PluginLinkDirectory::replacePluginPaths(command.splitArguments(), pluginFiles, pluginLinks->path());
+                runControl->setCommandLine(Utils::CommandLine(command.executable(), args));
+            }
+        }
+
+        // NOTE The path of the settings clone is known beforehand, the settings are cloned by the group below.
+        LaunchPreparation::PreparedSettingsClone settingsClone;
+        const bool inTmpfs = tmpfsDirectory && tmpfsResult;
+        if (inTmpfs || aspectValue<Utils::BoolAspect>(runControl, Constants::CloneSettingsId)) {
+            Utils::CommandLine command = runControl->commandLine();
+            QStringList args = command.splitArguments();
+            int index = args.indexOf(QLatin1String("-settingspath"));
+            QString templatePath = SettingsClone::templatePath(args);
+            if (!templatePath.isEmpty()) {
+                if (!inTmpfs)
+                    settingsClone = LaunchPreparation::takeSettingsClone(templatePath);
+                // NOTE In memory, the alternative settings are always used as a template.
+                if (!settingsClone.clone)
+                    settingsClone.clone = std::make_shared<SettingsClone>(templatePath, inTmpfs ? tmpfsDirectory->path() : QString());
+                args[index + 1] = settingsClone.clone->path();
+                runControl->setCommandLine(Utils::CommandLine(command.executable(), args));
+            } else if (inTmpfs) {
+                args << QLatin1String("-settingspath") << tmpfsDirectory->settingsPath();
+                runControl->setCommandLine(Utils::CommandLine(command.executable(), args));
+            }
+        }
+
         return new ProjectExplorer::RunWorker(runControl, Tasking::Group {
-            Tasking::onGroupSetup([this, runControl] () {
-                movePluginFile(runControl->targetFilePath(), QString(), QLatin1String(".del"));
-                for (Utils::FilePath pluginFilePath: pluginPaths(runControl->targetFilePath().fileName()))
-                    movePluginFile(pluginFilePath, QString(), QLatin1String(".del"));
+            Tasking::onGroupSetup([this, runControl, output, pluginLinks, pluginLinksResult, tmpfsDirectory, tmpfsResult] () {
+                if (pluginLinks) {
+                    if (!pluginLinksResult) {
+                        runControl->postMessage(tr("Could not link plugin files: %1").arg(pluginLinksResult.error()), Utils::ErrorMessageFormat);
+                        return Tasking::SetupResult::StopWithError;
+                    }
+                    runControl->postMessage(tr("%1 plugin file(s) linked in %2.").arg(pluginLinks->linkCount()).arg(pluginLinks->path()),
+                                            Utils::NormalMessageFormat);
+                }
+                if (tmpfsDirectory) {
+                    if (!tmpfsResult) {
+                        runControl->postMessage(tr("Could not create settings and caches in memory: %1").arg(tmpfsResult.error()), Utils::ErrorMessageFormat);
+                        return Tasking::SetupResult::StopWithError;
+                    }
+                    runControl->postMessage(tr("Settings and caches are kept in memory in %1.").arg(tmpfsDirectory->path()), Utils::NormalMessageFormat);
+
+                    // NOTE The directory is walked in a worker thread, one walk at a time.
+                    QTimer* usageTimer = new QTimer(runControl);
+                    QFutureWatcher<qint64>* usageWatcher = new QFutureWatcher<qint64>(usageTimer);
+                    QObject::connect(usageTimer, &QTimer::timeout, usageWatcher, [usageWatcher, path = tmpfsDirectory->path()] () {
+                        if (!usageWatcher->isRunning())
+                            usageWatcher->setFuture(Utils::asyncRun(qOverload<const QString&>(&TmpfsDirectory::usage), path));
+                    });
+                    QObject::connect(usageWatcher, &QFutureWatcher<qint64>::finished, runControl, [runControl, tmpfsDirectory, usageTimer, usageWatcher] () {
+                        if (usageWatcher->isCanceled() || (usageWatcher->result() <= tmpfsDirectory->sizeLimit()))
+                            return;
+                        runControl->postMessage(tr("Settings and caches in memory exceed %1 MiB. Stopping the instance.").arg(tmpfsDirectory->sizeLimit() / (1024 * 1024)),
+                                                Utils::ErrorMessageFormat);
+                        usageTimer->stop();
+                        runControl->initiateStop();
+                    });
+                    QObject::connect(runControl, &ProjectExplorer::RunControl::stopped,
+                                     usageTimer, &QObject::deleteLater);
+                    usageTimer->start(TmpfsDirectory::UsageCheckInterval);
+                }
+
+                if (aspectValue<Utils::BoolAspect>(runControl, Constants::BenchmarkId)) {
+                    QObject::connect(runControl, &ProjectExplorer::RunControl::appendMessage, runControl, [output] (const QString& msg, Utils::OutputFormat format) {
+                        if ((format == Utils::StdOutFormat) || (format == Utils::StdErrFormat))
+                            output->append(msg);
+                    });
+                }
+
+                /* NOTE In the other run modes, the application process is a wrapper (e.g. perf, heaptrack, valgrind)
+                 * or changes for each launch (startup comparison), so it cannot be watched nor sampled. */
+                const bool isNormalRun = (runControl->runMode() == ProjectExplorer::Constants::NORMAL_RUN_MODE);
+                const bool isDebugRun = (runControl->runMode() == ProjectExplorer::Constants::DEBUG_RUN_MODE);
+
+                int timeout = aspectValue<Utils::IntegerAspect>(runControl, Constants::TimeoutId);
+                QMap<QString, int> functionTimeouts = TestWatchdog::parseTimeouts(aspectValue<Utils::StringAspect>(runControl, Constants::FunctionTimeoutsId));
+                if ((isNormalRun || isDebugRun) && ((timeout > 0) || !functionTimeouts.isEmpty()))
+                    new TestWatchdog(runControl, timeout, functionTimeouts);
+
+                int samplingInterval = aspectValue<Utils::IntegerAspect>(runControl, Constants::MemorySamplingIntervalId);
+                if (isNormalRun && (samplingInterval > 0) && Utils::HostOsInfo::isLinuxHost())
+                    new MemorySampler(runControl, samplingInterval);
+
+                // NOTE The span starts when the process is started (its handle is set), not when the run worker is set up.
+                if (Tracer::isEnabled()) {
+                    auto begin = std::make_shared<qint64>(-1);
+                    auto startConnection = std::make_shared<QMetaObject::Connection>();
+                    auto outputConnection = std::make_shared<QMetaObject::Connection>();
+                    *startConnection = QObject::connect(runControl, &ProjectExplorer::RunControl::applicationProcessHandleChanged, runControl, [runControl, begin, startConnection] () {
+                        if (!runControl->applicationProcessHandle().isValid())
+                            return;
+                        *begin = Tracer::timestamp();
+                        QObject::disconnect(*startConnection);
+                    });
+                    *outputConnection = QObject::connect(runControl, &ProjectExplorer::RunControl::appendMessage, runControl, [begin, outputConnection] (const QString& msg, Utils::OutputFormat format) {
+                        Q_UNUSED(msg)
+                        if ((*begin < 0) || ((format != Utils::StdOutFormat) && (format != Utils::StdErrFormat)))
+                            return;
+                        Tracer::record("launch", QLatin1String("Process start to first output"), *begin, Tracer::timestamp());
+                        QObject::disconnect(*outputConnection);
+                    });
+                }
+
+                return Tasking::SetupResult::Continue;
+            }),
+            Tasking::onGroupDone([this, runControl, output, framebuffer, pluginLinks, tmpfsDirectory, settingsClone, prewarm, launch] (Tasking::DoneWith result) {
+                if (framebuffer)
+                    framebuffer->stop();
+                if (pluginLinks)
+                    pluginLinks->remove();
+                if (settingsClone.clone)
+                    settingsClone.clone->remove();
+                if (tmpfsDirectory)
+                    tmpfsDirectory->remove();
+
+                movePluginFiles(runControl, QLatin1String(".del"), QString());
+                if (prewarm)
+                    WarmStandby::start(launch);
+
+                if ((result == Tasking::DoneWith::Success) && aspectValue<Utils::BoolAspect>(runControl, Constants::ImpactedTestsOnlyId)) {
+                    TestImpactAnalyzer analyzer(runControl->projectFilePath().parentDir(), runControl->buildDirectory(), runControl->buildKey());
+                    if (!analyzer.recordSuccessfulRun())
+                        qCWarning(launchLog) << "Could not record successful test run";
+                }
+
+                if (aspectValue<Utils::BoolAspect>(runControl, Constants::BenchmarkId))
+                    reportBenchmarks(runControl, *output);
+            }),
+            Utils::AsyncTask<Utils::Result<PluginInstaller::Statistics>>([runControl] (Utils::Async<Utils::Result<PluginInstaller::Statistics>>& async) {
+                if (!aspectValue<Utils::BoolAspect>(runControl, Constants::InstallId))
+                    return Tasking::SetupResult::StopWithSuccess;
+                async.setConcurrentCallData(&PluginInstaller::install, PluginInstaller::decode(aspectValue<Utils::StringListAspect>(runControl, Constants::InstalledFilesId)));
+                return Tasking::SetupResult::Continue;
+            }, [runControl] (const Utils::Async<Utils::Result<PluginInstaller::Statistics>>& async, Tasking::DoneWith result) {
+                if ((result == Tasking::DoneWith::Cancel) || !async.isResultAvailable())
+                    return Tasking::DoneResult::Error;
+                Utils::Result<PluginInstaller::Statistics> stats = async.result();
+                if (!stats) {
+                    runControl->postMessage(tr("Could not install plugin files: %1").arg(stats.error()), Utils::ErrorMessageFormat);
+                    return Tasking::DoneResult::Error;
+                }
+                runControl->postMessage(tr("Plugin files installed: %1 copied (%2 KiB), %3 up to date.")
+                                            .arg(stats->copied)
+                                            .arg(stats->copiedBytes / 1024)
+                                            .arg(stats->unchanged),
+                                        Utils::NormalMessageFormat);
+                return Tasking::DoneResult::Success;
+            }),
+            Utils::AsyncTask<Utils::Result<>>([settingsClone] (Utils::Async<Utils::Result<>>& async) {
+                if (!settingsClone.clone)
+                    return Tasking::SetupResult::StopWithSuccess;
+                // NOTE A settings clone prepared during the build may still be cloned.
+                if (settingsClone.result.isValid())
+                    async.setConcurrentCallData([future = settingsClone.result] () {return future.result();});
+                else
+                    async.setConcurrentCallData([clone = settingsClone.clone] () {return clone->clone();});
+                return Tasking::SetupResult::Continue;
+            }, [runControl, settingsClone] (const Utils::Async<Utils::Result<>>& async, Tasking::DoneWith result) {
+                if ((result == Tasking::DoneWith::Cancel) || !async.isResultAvailable())
+                    return Tasking::DoneResult::Error;
+                Utils::Result<> cloned = async.result();
+                if (!cloned) {
+                    runControl->postMessage(tr("Could not clone settings: %1").arg(cloned.error()), Utils::ErrorMessageFormat);
+                    return Tasking::DoneResult::Error;
+                }
+                SettingsClone::Statistics stats = settingsClone.clone->statistics();
+                runControl->postMessage(tr("Settings cloned in %1 (%2 reflinked, %3 hard linked, %4 copied files).")
+                                            .arg(settingsClone.clone->path())
+                                            .arg(stats.reflinked)
+                                            .arg(stats.hardlinked)
+                                            .arg(stats.copied),
+                                        Utils::NormalMessageFormat);
+                return Tasking::DoneResult::Success;
+            }),
+            Utils::AsyncTask<QMap<QString, std::optional<QStringList>>>([runControl, impactedTestsOnly] (Utils::Async<QMap<QString, std::optional<QStringList>>>& async) {
+                if (!impactedTestsOnly || (runControl->runMode() == ProjectExplorer::Constants::DEBUG_RUN_MODE))
+                    return Tasking::SetupResult::StopWithSuccess;
+                async.setConcurrentCallData(&QtcRunWorkerFactory::impactedTests, aspectValue<Utils::StringListAspect>(runControl, Constants::TestedSourcesId),
+                                            runControl->buildDirectory(), runControl->buildKey());
+                return Tasking::SetupResult::Continue;
+            }, [runControl, noImpactedTests] (const Utils::Async<QMap<QString, std::optional<QStringList>>>& async, Tasking::DoneWith result) {
+                if ((result == Tasking::DoneWith::Cancel) || !async.isResultAvailable())
+                    return Tasking::DoneResult::Error;
+                *noImpactedTests = !selectImpactedTests(runControl, async.result());
+                return Tasking::DoneResult::Success;
+            }),
+            // NOTE The watchdog infers the test function which runs before it prints a message from the declaration order of the test slots.
+            Utils::AsyncTask<QStringList>([runControl] (Utils::Async<QStringList>& async) {
+                const QStringList testedSources = aspectValue<Utils::StringListAspect>(runControl, Constants::TestedSourcesId);
+                if (testedSources.isEmpty() || (runControl->findChild<TestWatchdog*>(QString(), Qt::FindDirectChildrenOnly) == nullptr))
+                    return Tasking::SetupResult::StopWithSuccess;
+                async.setConcurrentCallData([testedSources] () {
+                    QStringList testSlots;
+                    for (int p = 0; p + 1 < testedSources.size(); p += 2)
+                        testSlots << TestImpactAnalyzer::directoryTestSlots(Utils::FilePath::fromString(testedSources.at(p + 1)));
+                    return testSlots;
+                });
+                return Tasking::SetupResult::Continue;
+            }, [runControl] (const Utils::Async<QStringList>& async, Tasking::DoneWith result) {
+                if ((result == Tasking::DoneWith::Cancel) || !async.isResultAvailable())
+                    return Tasking::DoneResult::Error;
+                if (TestWatchdog* watchdog = runControl->findChild<TestWatchdog*>(QString(), Qt::FindDirectChildrenOnly))
+                    watchdog->setTestSlots(async.result());
+                return Tasking::DoneResult::Success;
             }),
-            Tasking::onGroupDone([this, runControl] () {
-                movePluginFile(runControl->targetFilePath(), QLatin1String(".del"), QString());
-                for (Utils::FilePath pluginFilePath: pluginPaths(runControl->targetFilePath().fileName()))
-                    movePluginFile(pluginFilePath, QLatin1String(".del"), QString());
+            Tasking::BarrierTask([runControl, framebuffer] (Tasking::Barrier& barrier) {
+                if (!framebuffer)
+                    return Tasking::SetupResult::StopWithSuccess;
+                if (framebuffer->isStarted() || !framebuffer->errorString().isEmpty()) {
+                    if (!framebuffer->isStarted())
+                        runControl->postMessage(tr("Could not start Xvfb: %1").arg(framebuffer->errorString()), Utils::ErrorMessageFormat);
+                    return framebuffer->isStarted() ? Tasking::SetupResult::StopWithSuccess : Tasking::SetupResult::StopWithError;
+                }
+
+                QObject::connect(framebuffer.get(), &VirtualFramebuffer::started, &barrier, [runControl, &barrier] (const QString& display) {
+                    runControl->postMessage(tr("Xvfb started on display %1.").arg(display), Utils::NormalMessageFormat);
+                    setDisplay(runControl, display);
+                    barrier.advance();
+                });
+                QObject::connect(framebuffer.get(), &VirtualFramebuffer::failed, &barrier, [runControl, &barrier] (const QString& error) {
+                    runControl->postMessage(tr("Could not start Xvfb: %1").arg(error), Utils::ErrorMessageFormat);
+                    barrier.stopWithResult(Tasking::DoneResult::Error);
+                });
+                framebuffer->start();
+                return Tasking::SetupResult::Continue;
             }),
-            baseReceipe(runControl)
+            // NOTE When no test is affected by changes, the test instance is not started and the run succeeds.
+            Tasking::Group {
+                Tasking::onGroupSetup([runControl, noImpactedTests] () {
+                    if (!*noImpactedTests)
+                        return Tasking::SetupResult::Continue;
+                    runControl->postMessage(tr("No test is affected by changes. The test instance is not started."), Utils::NormalMessageFormat);
+                    return Tasking::SetupResult::StopWithSuccess;
+                }),
+                // NOTE Plugins are shadowed after they are installed, so that the installed versions are hidden.
+                Tasking::Sync([this, runControl] () {
+                    movePluginFiles(runControl, QString(), QLatin1String(".del"));
+                }),
+                standby ? WarmStandby::receipe(runControl, standby, standbyOutput) : baseReceipe(runControl)
+            }
         });
     });
 }
@@ -46,17 +418,106 @@ std::list<Utils::FilePath> QtcRunWorkerFactory::pluginPaths(const QString& fileN
     return ans;
 }
 
+void QtcRunWorkerFactory::reportBenchmarks(ProjectExplorer::RunControl* runControl, const QString& output)
+{
+    QList<BenchmarkHistory::Result> results = BenchmarkHistory::parse(output);
+    if (results.isEmpty()) {
+        runControl->postMessage(tr("No benchmark result found in test output."), Utils::NormalMessageFormat);
+        return;
+    }
+
+    BenchmarkHistory history(runControl->buildDirectory().pathAppended(QLatin1String(".qtcdevplugin-benchmarks.json")), runControl->buildKey());
+    QList<BenchmarkHistory::Regression> regressions = history.regressions(results, aspectValue<Utils::IntegerAspect>(runControl, Constants::BenchmarkThresholdId, 5));
+    for (BenchmarkHistory::Regression regression : regressions) {
+        runControl->postMessage(tr("Benchmark regression: %1 %2 %3 per iteration (baseline: %4 %3, %5%)")
+                                    .arg(regression.result.name)
+                                    .arg(regression.result.value)
+                                    .arg(regression.result.unit)
+                                    .arg(regression.baseline)
+                                    .arg(regression.change, 0, 'f', 1),
+                                Utils::ErrorMessageFormat);
+    }
+    runControl->postMessage(tr("%1 benchmark result(s) recorded, %2 regression(s) found.").arg(results.size()).arg(regressions.size()),
+                            regressions.isEmpty() ? Utils::NormalMessageFormat : Utils::ErrorMessageFormat);
+
+    history.append(results);
+    history.save();
+}
+
+QMap<QString, std::optional<QStringList>> QtcRunWorkerFactory::impactedTests(const QStringList& testedSources, const Utils::FilePath& buildDirectory, const QString& buildKey)
+{
+    TraceSpan span("launch", QLatin1String("Test impact analysis"));
+
+    QMap<QString, std::optional<QStringList>> tests;
+    for (int p = 0; p + 1 < testedSources.size(); p += 2) {
+        // NOTE The last successful run is recorded with the build key of the run configuration.
+        TestImpactAnalyzer analyzer(Utils::FilePath::fromString(testedSources.at(p + 1)), buildDirectory, buildKey);
+        tests.insert(testedSources.at(p), analyzer.affectedTestFunctions());
+    }
+    return tests;
+}
+
+bool QtcRunWorkerFactory::selectImpactedTests(ProjectExplorer::RunControl* runControl, const QMap<QString, std::optional<QStringList>>& tests)
+{
+    Utils::CommandLine command = runControl->commandLine();
+    QStringList args = command.splitArguments();
+
+    for (auto it = tests.cbegin(); it != tests.cend(); it++) {
+        if (!it.value().has_value()) {
+            runControl->postMessage(tr("Could not find out the tests affected by changes in %1. Running all tests.").arg(it.key()), Utils::NormalMessageFormat);
+        } else if (it.value()->isEmpty()) {
+            runControl->postMessage(tr("No test is affected by changes in %1. Its tests are not run.").arg(it.key()), Utils::NormalMessageFormat);
+            args = TestImpactAnalyzer::skipTests(args, it.key());
+        } else {
+            runControl->postMessage(tr("Running %1 test function(s) of %2 affected by changes.").arg(it.value()->size()).arg(it.key()), Utils::NormalMessageFormat);
+            args = TestImpactAnalyzer::selectTestFunctions(args, it.key(), *it.value());
+        }
+    }
+
+    // NOTE The -test arguments may be those of a wrapped command line (e.g. with profilers).
+    runControl->setCommandLine(Utils::CommandLine(command.executable(), args));
+    return TestImpactAnalyzer::hasTests(args);
+}
+
+void QtcRunWorkerFactory::setDisplay(ProjectExplorer::RunControl* runControl, const QString& display)
+{
+    Utils::Environment env = runControl->environment();
+    env.set(QLatin1String("DISPLAY"), display);
+    runControl->setEnvironment(env);
+}
+
+QList<Utils::FilePath> QtcRunWorkerFactory::pluginFiles(ProjectExplorer::RunControl* runControl)
+{
+    QList<Utils::FilePath> targetPaths;
+    if (!runControl->targetFilePath().isEmpty())
+        targetPaths << runControl->targetFilePath();
+    for (QString path : aspectValue<Utils::StringListAspect>(runControl, Constants::TestedPluginsId))
+        targetPaths << Utils::FilePath::fromString(path);
+    return targetPaths;
+}
+
+void QtcRunWorkerFactory::movePluginFiles(const QList<Utils::FilePath>& targetPaths, const QString& oldSuffix, const QString& newSuffix)
+{
+    TraceSpan span("launch", oldSuffix.isEmpty() ? QLatin1String("Plugin shadowing") : QLatin1String("Plugin unshadowing"));
+
+    for (Utils::FilePath targetPath : targetPaths) {
+        movePluginFile(targetPath, oldSuffix, newSuffix);
+        for (Utils::FilePath pluginFilePath: pluginPaths(targetPath.fileName()))
+            movePluginFile(pluginFilePath, oldSuffix, newSuffix);
+    }
+}
+
 void QtcRunWorkerFactory::movePluginFile(const Utils::FilePath& targetPath, const QString& oldSuffix, const QString& newSuffix)
 {
     Utils::FilePath oldTargetPath = Utils::FilePath(targetPath).stringAppended(oldSuffix);
     Utils::FilePath newTargetPath = Utils::FilePath(targetPath).stringAppended(newSuffix);
 
-    qDebug() << "Before:" << oldTargetPath << oldTargetPath.exists()
+    qCDebug(launchLog) << "Before:" << oldTargetPath << oldTargetPath.exists()
                           << newTargetPath << newTargetPath.exists();
 
     if (oldTargetPath.exists()) {
         QTC_CHECK(QFile::rename(oldTargetPath.nativePath(), newTargetPath.nativePath()));
-        qDebug() << "After: " << oldTargetPath << oldTargetPath.exists()
+        qCDebug(launchLog) << "After: " << oldTargetPath << oldTargetPath.exists()
                               << newTargetPath << newTargetPath.exists();
     }
     QTC_CHECK(!oldTargetPath.exists());
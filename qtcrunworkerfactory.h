@@ -6,6 +6,11 @@
 #include <projectexplorer/runcontrol.h>
 #include <projectexplorer/projectexplorerconstants.h>
 
+#include <QCoreApplication>
+#include <QMap>
+
+#include <optional>
+
 namespace QtcDevPlugin {
 namespace Internal {
 
@@ -19,6 +24,7 @@ namespace Internal {
  */
 class QtcRunWorkerFactory : public ProjectExplorer::RunWorkerFactory
 {
+    Q_DECLARE_TR_FUNCTIONS(QtcDevPlugin::Internal::QtcRunWorkerFactory)
 public:
     /*!
      * \brief Functor specifying the tasks to execute a run control.
@@ -36,7 +42,84 @@ public:
      * This class simply adds setup and teardown actions.
      */
     QtcRunWorkerFactory(Utils::Id runMode, const ReceipeProducer& baseReceipe);
+
+    /*!
+     * \brief The plugin files
+     *
+     * Returns the installed files of all the plugins run by the run control (the target of the run configuration
+     * and the plugins tested by a QtcTestAllRunConfiguration).
+     * \param runControl The run control.
+     * \return The paths to the installed plugin files.
+     * \sa movePluginFiles()
+     */
+    static QList<Utils::FilePath> pluginFiles(ProjectExplorer::RunControl* runControl);
+    /*!
+     * \brief Moves the plugin files
+     *
+     * Moves the given plugin files and their installed versions
+     * from one suffixed path to the other.
+     * \param targetPaths The paths to the installed plugin files.
+     * \param oldSuffix The current suffix of the plugin files.
+     * \param newSuffix The desired suffix of the plugin files.
+     * \sa pluginFiles(), movePluginFile()
+     */
+    static void movePluginFiles(const QList<Utils::FilePath>& targetPaths, const QString& oldSuffix, const QString& newSuffix);
 private:
+    /*!
+     * \brief Report benchmark results
+     *
+     * Parses the \c QBENCHMARK results in the output of the run control,
+     * reports the regressions compared to the benchmark history and updates
+     * the history (stored in the build directory).
+     * \param runControl The run control.
+     * \param output The output of the run control.
+     * \sa BenchmarkHistory
+     */
+    void reportBenchmarks(ProjectExplorer::RunControl* runControl, const QString& output);
+    /*!
+     * \brief Tests affected by changes
+     *
+     * Finds out the test functions of the tested plugins affected by the changes
+     * since the last successful run (see TestImpactAnalyzer).
+     * \note This function runs \c git and \c ninja, hence it should not run in the main thread.
+     * \param testedSources The names and source directories of the tested plugins (see QtcTestRunConfiguration::testedSources()).
+     * \param buildDirectory The build directory.
+     * \param buildKey The build key of the run configuration (used to store the last successful revision).
+     * \return A map whose keys are the names of the tested plugins and values are their affected test functions.
+     * \sa selectImpactedTests()
+     */
+    static QMap<QString, std::optional<QStringList>> impactedTests(const QStringList& testedSources, const Utils::FilePath& buildDirectory, const QString& buildKey);
+    /*!
+     * \brief Select the tests affected by changes
+     *
+     * Restricts the \c -test arguments in the command line of the run control
+     * to the affected test functions. When they are unknown, all the tests of the plugin are run.
+     * When no test of a plugin is affected, its tests are not run.
+     * \param runControl The run control.
+     * \param tests The affected test functions of the tested plugins (see impactedTests()).
+     * \return \c true if tests remain to be run, \c false otherwise.
+     */
+    static bool selectImpactedTests(ProjectExplorer::RunControl* runControl, const QMap<QString, std::optional<QStringList>>& tests);
+    /*!
+     * \brief Set the display
+     *
+     * Sets the X display in the environment of the run control.
+     * \param runControl The run control.
+     * \param display The X display name (e.g. the one of a VirtualFramebuffer).
+     */
+    static void setDisplay(ProjectExplorer::RunControl* runControl, const QString& display);
+    /*!
+     * \brief Moves the plugin files
+     *
+     * Moves the files of all the plugins run by the run control (the target of the run configuration
+     * and the plugins tested by a QtcTestAllRunConfiguration) and their installed versions
+     * from one suffixed path to the other.
+     * \param runControl The run control.
+     * \param oldSuffix The current suffix of the plugin files.
+     * \param newSuffix The desired suffix of the plugin files.
+     * \sa movePluginFile()
+     */
+    inline void movePluginFiles(ProjectExplorer::RunControl* runControl, const QString& oldSuffix, const QString& newSuffix) {movePluginFiles(pluginFiles(runControl), oldSuffix, newSuffix);}
     /*!
      * \brief Moves the plugin file
      *
@@ -48,7 +131,7 @@ private:
      * \param newSuffix The desired suffix of the target.
      * \sa handleRunControlStarted(), handleRunControlStopped()
      */
-    void movePluginFile(const Utils::FilePath& targetPath, const QString& oldSuffix, const QString& newSuffix);
+    static void movePluginFile(const Utils::FilePath& targetPath, const QString& oldSuffix, const QString& newSuffix);
     /*!
      * \brief List of plugin paths
      *
@@ -56,7 +139,7 @@ private:
      * \param fileName The name of the plugin file.
      * \return The list of paths to plugins.
      */
-    std::list<Utils::FilePath> pluginPaths(const QString& fileName);
+    static std::list<Utils::FilePath> pluginPaths(const QString& fileName);
 };
 
 } // Internal
@@ -0,0 +1,112 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "qtctestallrunconfiguration.h"
+#include "qtcdevpluginlogging.h"
+
+#include "qtcdevpluginconstants.h"
+
+#include <projectexplorer/buildconfiguration.h>
+#include <projectexplorer/buildsystem.h>
+#include <projectexplorer/project.h>
+
+#include <utils/algorithm.h>
+
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+QtcTestAllRunConfiguration::QtcTestAllRunConfiguration(ProjectExplorer::BuildConfiguration* parent, Utils::Id id):
+    QtcTestRunConfiguration(parent, id)
+{
+    setDefaultDisplayName(tr("Run Qt Creator tests for all plugins"));
+
+    // NOTE This aspect has no settings key (it is not saved) and no widget.
+    mTestedPluginsAspect.setId(Utils::Id(Constants::TestedPluginsId));
+
+    setUpdater([this] {
+        mTestedPluginsAspect.setValue(Utils::transform(testedPlugins(), [] (const ProjectExplorer::BuildTargetInfo& info) {
+            return info.targetFilePath.toFSPathString();
+        }));
+        updateInstalledFiles();
+        updateTestedSources();
+    });
+}
+
+QList<Utils::FilePath> QtcTestAllRunConfiguration::pluginSearchPaths(void) const
+{
+    QList<Utils::FilePath> paths;
+
+    for (ProjectExplorer::BuildTargetInfo info : testedPlugins()) {
+        if (!paths.contains(info.workingDirectory))
+            paths << info.workingDirectory;
+    }
+
+    return paths;
+}
+
+QList<ProjectExplorer::BuildTargetInfo> QtcTestAllRunConfiguration::testedPlugins(void) const
+{
+    QList<ProjectExplorer::BuildTargetInfo> plugins;
+    if (buildSystem() == nullptr)
+        return plugins;
+
+    for (QString pluginBuildKey : buildTargetInfo().additionalData.toStringList()) {
+        ProjectExplorer::BuildTargetInfo info = buildSystem()->buildTarget(pluginBuildKey);
+        if (info.buildKey == pluginBuildKey)
+            plugins << info;
+        else
+            qCWarning(discoveryLog) << "Could not find build target information for" << pluginBuildKey;
+    }
+
+    return plugins;
+}
+
+QList<PluginInstaller::File> QtcTestAllRunConfiguration::installedFiles(void) const
+{
+    QList<PluginInstaller::File> files;
+    for (ProjectExplorer::BuildTargetInfo info : testedPlugins())
+        files << PluginInstaller::files(info);
+    return files;
+}
+
+ProjectExplorer::BuildTargetInfo QtcTestAllRunConfiguration::aggregateBuildTargetInfo(ProjectExplorer::BuildConfiguration* bc, const QStringList& pluginBuildKeys)
+{
+    ProjectExplorer::BuildTargetInfo info;
+
+    info.displayName = bc->project()->displayName();
+    info.buildKey = Constants::AllPluginsBuildKey;
+    info.projectFilePath = bc->project()->projectFilePath();
+    info.workingDirectory = bc->buildDirectory();
+    info.additionalData = pluginBuildKeys;
+
+    return info;
+}
+
+Utils::Id QtcTestAllRunConfiguration::id(void)
+{
+    return Utils::Id(Constants::QtcTestAllRunConfigurationId);
+}
+
+QString QtcTestAllRunConfiguration::displayNamePattern(void)
+{
+    return QCoreApplication::translate("QtcDevPlugin::Internal::QtcTestAllRunConfiguration", "Run Qt Creator tests for all plugins in \"%1\"");
+}
+
+} // Internal
+} // QtcDevPlugin
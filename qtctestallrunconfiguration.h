@@ -0,0 +1,103 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef QTCTESTALLRUNCONFIGURATION_H
+#define QTCTESTALLRUNCONFIGURATION_H
+
+#include "qtctestrunconfiguration.h"
+
+namespace ProjectExplorer {
+    class BuildConfiguration;
+}
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The QtcTestAllRunConfiguration class stores information required to test all the plugins of a project at once
+ *
+ * When a project declares several Qt Creator plugins, an instance of this class
+ * is proposed to the user in addition to one QtcTestRunConfiguration per plugin.
+ * It starts a single test instance of Qt Creator which runs the tests of
+ * all the plugins of the project (with one \c -test argument per plugin),
+ * so that Qt Creator starts only once.
+ *
+ * The build target information of this run configuration (see aggregateBuildTargetInfo())
+ * stores the build keys of the tested plugins. The paths of the plugin files are
+ * provided to the run worker through an hidden aspect, so that all the other versions
+ * of these plugins are hidden while the tests run.
+ *
+ * \sa QtcTestRunConfiguration, QtcRunWorkerFactory
+ */
+class QtcTestAllRunConfiguration : public QtcTestRunConfiguration
+{
+    Q_OBJECT
+public:
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new instance with parent target.
+     * \param parent The parent build configuration
+     * \param id The id for the run configuration
+     */
+    QtcTestAllRunConfiguration(ProjectExplorer::BuildConfiguration* parent, Utils::Id id = Utils::Id(Constants::QtcTestAllRunConfigurationId));
+
+    /*!
+     * \copydoc QtcRunConfiguration::pluginSearchPaths()
+     */
+    virtual QList<Utils::FilePath> pluginSearchPaths(void) const override;
+    /*!
+     * \copydoc QtcTestRunConfiguration::testedPlugins()
+     */
+    virtual QList<ProjectExplorer::BuildTargetInfo> testedPlugins(void) const override;
+    /*!
+     * \copydoc QtcRunConfiguration::installedFiles()
+     */
+    virtual QList<PluginInstaller::File> installedFiles(void) const override;
+
+    /*!
+     * \brief Build target information for all plugins
+     *
+     * Creates the build target information for a run configuration testing
+     * the plugins with the given build keys.
+     * \param bc The build configuration of the future run configuration.
+     * \param pluginBuildKeys The build keys of the plugins of the project.
+     * \return The build target information for all the plugins of the project.
+     */
+    static ProjectExplorer::BuildTargetInfo aggregateBuildTargetInfo(ProjectExplorer::BuildConfiguration* bc, const QStringList& pluginBuildKeys);
+
+    /*!
+     * \copydoc QtcTestRunConfiguration::id()
+     */
+    static Utils::Id id(void);
+    /*!
+     * \copydoc QtcTestRunConfiguration::displayNamePattern()
+     */
+    static QString displayNamePattern(void);
+    /*!
+     * \copydoc QtcRunConfiguration::aggregatesPlugins()
+     */
+    static constexpr bool aggregatesPlugins(void) {return true;}
+private:
+    Utils::StringListAspect mTestedPluginsAspect{this};
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // QTCTESTALLRUNCONFIGURATION_H
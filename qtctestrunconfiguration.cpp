@@ -17,19 +17,25 @@
  */
 
 #include "qtctestrunconfiguration.h"
+#include "qtcdevpluginlogging.h"
 
 #include "qtcdevpluginconstants.h"
+#include "tmpfsdirectory.h"
+#include "virtualframebuffer.h"
 #include "Widgets/filetypevalidatinglineedit.h"
 
+#include <projectexplorer/buildconfiguration.h>
+#include <projectexplorer/environmentaspect.h>
 #include <projectexplorer/target.h>
 #include <projectexplorer/kit.h>
 
 #include <qtsupport/qtsupportconstants.h>
 
+#include <utils/hostosinfo.h>
+
 #include <qmakeprojectmanager/qmakeproject.h>
 
 #include <QtWidgets>
-#include <QtDebug>
 
 namespace QtcDevPlugin {
 namespace Internal {
@@ -38,18 +44,151 @@ QtcTestRunConfiguration::QtcTestRunConfiguration(ProjectExplorer::BuildConfigura
     QtcRunConfiguration(parent, id)
 {
     setDefaultDisplayName(tr("Run Qt Creator tests"));
+
+    mImpactedTestsOnlyAspect.setId(Utils::Id(Constants::ImpactedTestsOnlyId));
+    mImpactedTestsOnlyAspect.setSettingsKey(Utils::Key(Constants::ImpactedTestsOnlyKey));
+    mImpactedTestsOnlyAspect.setLabelText(tr("Only run tests affected by changes since last successful run"));
+    mImpactedTestsOnlyAspect.setDefaultValue(false);
+
+    // NOTE This aspect has no settings key (it is not saved) and no widget.
+    mTestedSourcesAspect.setId(Utils::Id(Constants::TestedSourcesId));
+
+    mBenchmarkAspect.setId(Utils::Id(Constants::BenchmarkId));
+    mBenchmarkAspect.setSettingsKey(Utils::Key(Constants::BenchmarkKey));
+    mBenchmarkAspect.setLabelText(tr("Record benchmark results and report regressions"));
+    mBenchmarkAspect.setDefaultValue(false);
+
+    mBenchmarkThresholdAspect.setId(Utils::Id(Constants::BenchmarkThresholdId));
+    mBenchmarkThresholdAspect.setSettingsKey(Utils::Key(Constants::BenchmarkThresholdKey));
+    mBenchmarkThresholdAspect.setLabelText(tr("Benchmark regression threshold:"));
+    mBenchmarkThresholdAspect.setSuffix(QLatin1String("%"));
+    mBenchmarkThresholdAspect.setRange(0, 1000);
+    mBenchmarkThresholdAspect.setDefaultValue(5);
+    mBenchmarkThresholdAspect.setEnabler(&mBenchmarkAspect);
+
+    mDisplayAspect.setId(Utils::Id(Constants::DisplayId));
+    mDisplayAspect.setSettingsKey(Utils::Key(Constants::DisplayKey));
+    mDisplayAspect.setDisplayName(tr("Display:"));
+    mDisplayAspect.setDisplayStyle(Utils::SelectionAspect::DisplayStyle::ComboBox);
+    mDisplayAspect.addOption(tr("Desktop"));
+    mDisplayAspect.addOption(tr("Offscreen"), tr("The test instance uses Qt offscreen platform plugin."));
+    mDisplayAspect.addOption(tr("Virtual framebuffer"), tr("The test instance uses a private Xvfb instance."));
+    if (!VirtualFramebuffer::isAvailable())
+        mDisplayAspect.setOptionEnabled(VirtualFramebufferDisplay, false);
+    mDisplayAspect.setDefaultValue(DesktopDisplay);
+
+    ProjectExplorer::EnvironmentAspect* environmentAspect = aspect<ProjectExplorer::EnvironmentAspect>();
+    environmentAspect->addModifier([this] (Utils::Environment& env) {
+        if (mDisplayAspect() == OffscreenDisplay) {
+            env.set(QLatin1String("QT_QPA_PLATFORM"), QLatin1String("offscreen"));
+        } else if (mDisplayAspect() == VirtualFramebufferDisplay) {
+            // NOTE DISPLAY is set by the run worker, which manages Xvfb.
+            env.set(QLatin1String("QT_QPA_PLATFORM"), QLatin1String("xcb"));
+            env.unset(QLatin1String("WAYLAND_DISPLAY"));
+        }
+    });
+    connect(&mDisplayAspect, &Utils::BaseAspect::changed, environmentAspect, &ProjectExplorer::EnvironmentAspect::environmentChanged);
+
+    mWatchAspect.setId(Utils::Id(Constants::WatchId));
+    mWatchAspect.setSettingsKey(Utils::Key(Constants::WatchKey));
+    mWatchAspect.setLabelText(tr("Rebuild and rerun tests when sources are saved"));
+    mWatchAspect.setDefaultValue(false);
+
+    mWatchDelayAspect.setId(Utils::Id(Constants::WatchDelayId));
+    mWatchDelayAspect.setSettingsKey(Utils::Key(Constants::WatchDelayKey));
+    mWatchDelayAspect.setLabelText(tr("Delay before rerunning tests:"));
+    mWatchDelayAspect.setSuffix(QLatin1String(" ms"));
+    mWatchDelayAspect.setRange(0, 60000);
+    mWatchDelayAspect.setSingleStep(100);
+    mWatchDelayAspect.setDefaultValue(500);
+    mWatchDelayAspect.setEnabler(&mWatchAspect);
+
+    mTimeoutAspect.setId(Utils::Id(Constants::TimeoutId));
+    mTimeoutAspect.setSettingsKey(Utils::Key(Constants::TimeoutKey));
+    mTimeoutAspect.setLabelText(tr("Test function timeout:"));
+    mTimeoutAspect.setToolTip(tr("The test instance is stopped when a test function runs longer (0 disables the timeout)."));
+    mTimeoutAspect.setSuffix(QLatin1String(" s"));
+    mTimeoutAspect.setRange(0, 86400);
+    mTimeoutAspect.setDefaultValue(0);
+
+    mFunctionTimeoutsAspect.setId(Utils::Id(Constants::FunctionTimeoutsId));
+    mFunctionTimeoutsAspect.setSettingsKey(Utils::Key(Constants::FunctionTimeoutsKey));
+    mFunctionTimeoutsAspect.setLabelText(tr("Function timeouts:"));
+    mFunctionTimeoutsAspect.setToolTip(tr("Comma separated timeouts for specific test functions, overriding the global timeout."));
+    mFunctionTimeoutsAspect.setDisplayStyle(Utils::StringAspect::LineEditDisplay);
+    mFunctionTimeoutsAspect.setPlaceHolderText(QLatin1String("testFunction=60, otherTestFunction=300"));
+
+    mCallgrindFunctionsAspect.setId(Utils::Id(Constants::CallgrindFunctionsId));
+    mCallgrindFunctionsAspect.setSettingsKey(Utils::Key(Constants::CallgrindFunctionsKey));
+    mCallgrindFunctionsAspect.setLabelText(tr("Callgrind test functions:"));
+    mCallgrindFunctionsAspect.setToolTip(tr("Comma separated wildcard patterns of the test functions whose instructions are counted by Callgrind (events are only collected inside these functions). By default, the test slots of the tested plugins are used."));
+    mCallgrindFunctionsAspect.setDisplayStyle(Utils::StringAspect::LineEditDisplay);
+    mCallgrindFunctionsAspect.setPlaceHolderText(tr("Test slots of the tested plugins"));
+
+    mMemorySamplingIntervalAspect.setId(Utils::Id(Constants::MemorySamplingIntervalId));
+    mMemorySamplingIntervalAspect.setSettingsKey(Utils::Key(Constants::MemorySamplingIntervalKey));
+    mMemorySamplingIntervalAspect.setLabelText(tr("Memory sampling interval:"));
+    mMemorySamplingIntervalAspect.setToolTip(tr("The memory usage of the test instance is sampled at this interval to report peak memory and memory growth per test function (0 disables sampling)."));
+    mMemorySamplingIntervalAspect.setSuffix(QLatin1String(" ms"));
+    mMemorySamplingIntervalAspect.setRange(0, 10000);
+    mMemorySamplingIntervalAspect.setSingleStep(50);
+    mMemorySamplingIntervalAspect.setDefaultValue(100);
+    mMemorySamplingIntervalAspect.setVisible(Utils::HostOsInfo::isLinuxHost());
+
+    mTmpfsAspect.setId(Utils::Id(Constants::TmpfsId));
+    mTmpfsAspect.setSettingsKey(Utils::Key(Constants::TmpfsKey));
+    mTmpfsAspect.setLabelText(tr("Keep settings and caches in memory (/dev/shm)"));
+    mTmpfsAspect.setToolTip(tr("The settings path and XDG_CACHE_HOME of the test instance are placed in a directory in /dev/shm, which is removed after the run. The alternative settings, if any, are copied there."));
+    mTmpfsAspect.setDefaultValue(false);
+    mTmpfsAspect.setVisible(TmpfsDirectory::isAvailable());
+
+    mTmpfsSizeLimitAspect.setId(Utils::Id(Constants::TmpfsSizeLimitId));
+    mTmpfsSizeLimitAspect.setSettingsKey(Utils::Key(Constants::TmpfsSizeLimitKey));
+    mTmpfsSizeLimitAspect.setLabelText(tr("Size limit of settings and caches in memory:"));
+    mTmpfsSizeLimitAspect.setToolTip(tr("The test instance is stopped when its settings and caches grow larger."));
+    mTmpfsSizeLimitAspect.setSuffix(QLatin1String(" MiB"));
+    mTmpfsSizeLimitAspect.setRange(1, 65536);
+    mTmpfsSizeLimitAspect.setDefaultValue(TmpfsDirectory::DefaultSizeLimit);
+    mTmpfsSizeLimitAspect.setEnabler(&mTmpfsAspect);
+    mTmpfsSizeLimitAspect.setVisible(TmpfsDirectory::isAvailable());
+
+    setUpdater([this] {
+        updateInstalledFiles();
+        updateTestedSources();
+    });
 }
 
 QStringList QtcTestRunConfiguration::commandLineArgumentsList(void) const
 {
     QStringList cmdArgs =  QtcRunConfiguration::commandLineArgumentsList();
 
-    cmdArgs << QLatin1String("-test") << pluginName() << QLatin1String("-load") << QLatin1String("all");
+    // NOTE The affected tests are selected by the run worker (see QtcRunWorkerFactory).
+    for (ProjectExplorer::BuildTargetInfo plugin : testedPlugins())
+        cmdArgs << QLatin1String("-test") << plugin.displayName;
+    cmdArgs << QLatin1String("-load") << QLatin1String("all");
 
-    qDebug() << "Run config command line arguments:" << cmdArgs;
+    qCDebug(launchLog) << "Run config command line arguments:" << cmdArgs;
     return cmdArgs;
 }
 
+QList<ProjectExplorer::BuildTargetInfo> QtcTestRunConfiguration::testedPlugins(void) const
+{
+    return QList<ProjectExplorer::BuildTargetInfo>() << buildTargetInfo();
+}
+
+QStringList QtcTestRunConfiguration::testedSources(void) const
+{
+    QStringList sources;
+    for (ProjectExplorer::BuildTargetInfo plugin : testedPlugins())
+        sources << plugin.displayName << plugin.projectFilePath.parentDir().toFSPathString();
+    return sources;
+}
+
+void QtcTestRunConfiguration::updateTestedSources(void)
+{
+    mTestedSourcesAspect.setValue(testedSources());
+}
+
 Utils::Id QtcTestRunConfiguration::id(void)
 {
     return Utils::Id(Constants::QtcTestRunConfigurationId);
@@ -44,6 +44,14 @@ class QtcTestRunConfiguration;
  * so that the current version is the only loaded in the current Qt Creator instance.
  * Otherwide the tests of the other instance could shadow those of the current version being tested.
  *
+ * Optionally, only the tests affected by the changes since the last successful run
+ * are selected when the run starts (see TestImpactAnalyzer). The results of \c QBENCHMARK tests
+ * can also be recorded and compared to the previous ones (see BenchmarkHistory).
+ * The test instance can run headless (see DisplayMode).
+ * In watch mode, the tests are rerun when sources are saved (see TestWatcher).
+ * Hung tests are stopped after a timeout (see TestWatchdog).
+ * Settings and caches can be kept in memory during the run (see TmpfsDirectory).
+ *
  * This run configuration can be easily edited using QtcRunConfigurationWidget, which
  * defines a suitable form wigdet to ease this process.
  *
@@ -53,6 +61,18 @@ class QtcTestRunConfiguration : public QtcRunConfiguration
 {
     Q_OBJECT
 public:
+    /*!
+     * \enum DisplayMode
+     * \brief Display of the test instance
+     *
+     * Each of the values of this enum describes where the windows of the test instance are shown.
+     */
+    enum DisplayMode {
+        DesktopDisplay = 0,             /*!< The test instance uses the desktop of the user */
+        OffscreenDisplay = 1,           /*!< The test instance uses Qt offscreen platform (\c QT_QPA_PLATFORM=offscreen) */
+        VirtualFramebufferDisplay = 2,  /*!< The test instance uses a private \c Xvfb instance (for tests requiring a real display) */
+    };
+
     /*!
      * \brief Constructor
      *
@@ -68,6 +88,23 @@ public:
      */
     virtual QStringList commandLineArgumentsList(void) const override;
 
+    /*!
+     * \brief The tested plugins
+     *
+     * Returns the build target information of the plugins whose tests are run.
+     * Qt Creator is given a \c -test argument for each of them.
+     * \return The build target information of the tested plugins.
+     */
+    virtual QList<ProjectExplorer::BuildTargetInfo> testedPlugins(void) const;
+    /*!
+     * \brief The sources of the tested plugins
+     *
+     * Returns the names of the tested plugins and the directories containing their sources,
+     * which are used by the run worker to select the tests affected by changes (see TestImpactAnalyzer).
+     * \return A list alternating the name of a tested plugin and the directory containing its sources.
+     */
+    QStringList testedSources(void) const;
+
     /*!
      * \brief The run configuration id
      *
@@ -84,6 +121,29 @@ public:
      * \return The pattern for the display name of the run configuration.
      */
     static QString displayNamePattern(void);
+protected:
+    /*!
+     * \brief Update the tested sources
+     *
+     * Updates the sources of the tested plugins passed to the run control.
+     * This function must be called by the updaters of derived classes.
+     * \sa testedSources()
+     */
+    void updateTestedSources(void);
+private:
+    Utils::BoolAspect mImpactedTestsOnlyAspect{this};
+    Utils::StringListAspect mTestedSourcesAspect{this};
+    Utils::BoolAspect mBenchmarkAspect{this};
+    Utils::IntegerAspect mBenchmarkThresholdAspect{this};
+    Utils::SelectionAspect mDisplayAspect{this};
+    Utils::BoolAspect mWatchAspect{this};
+    Utils::IntegerAspect mWatchDelayAspect{this};
+    Utils::IntegerAspect mTimeoutAspect{this};
+    Utils::StringAspect mFunctionTimeoutsAspect{this};
+    Utils::StringAspect mCallgrindFunctionsAspect{this};
+    Utils::IntegerAspect mMemorySamplingIntervalAspect{this};
+    Utils::BoolAspect mTmpfsAspect{this};
+    Utils::IntegerAspect mTmpfsSizeLimitAspect{this};
 };
 
 } // Internal
@@ -0,0 +1,138 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "settingsclone.h"
+#include "qtcdevpluginlogging.h"
+
+#include <QtCore>
+
+#ifdef Q_OS_UNIX
+#   include <fcntl.h>
+#   include <sys/ioctl.h>
+#   include <unistd.h>
+#endif
+#ifdef Q_OS_LINUX
+#   include <linux/fs.h>
+#endif
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+SettingsClone::SettingsClone(const QString& templatePath, const QString& parentPath) :
+    mTemplatePath(QFileInfo(templatePath).absoluteFilePath()),
+    mDir(parentPath.isEmpty() ? QFileInfo(templatePath).absoluteFilePath() + QLatin1String(".run-XXXXXX")
+                              : QDir(parentPath).filePath(QFileInfo(templatePath).fileName() + QLatin1String("-XXXXXX"))),
+    mStatistics({0, 0, 0})
+{
+}
+
+bool SettingsClone::isReplacedAtomically(const QString& fileName)
+{
+    // NOTE QSettings and PersistentSettingsWriter save through QSaveFile.
+    return fileName.endsWith(QLatin1String(".ini")) || fileName.endsWith(QLatin1String(".xml"));
+}
+
+QString SettingsClone::templatePath(const QStringList& arguments)
+{
+    int index = arguments.indexOf(QLatin1String("-settingspath"));
+    if ((index < 0) || (index + 1 >= arguments.size()))
+        return QString();
+
+    QString path = arguments.at(index + 1);
+    if ((path.size() >= 2) && path.startsWith(QLatin1Char('"')) && path.endsWith(QLatin1Char('"')))
+        path = path.mid(1, path.size() - 2);
+    return path;
+}
+
+Utils::Result<SettingsClone::Method> SettingsClone::cloneFile(const QString& sourcePath, const QString& targetPath, bool* reflink)
+{
+#if defined(Q_OS_LINUX) && defined(FICLONE)
+    if (*reflink) {
+        int source = ::open(QFile::encodeName(sourcePath).constData(), O_RDONLY | O_CLOEXEC);
+        int target = ::open(QFile::encodeName(targetPath).constData(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+        bool cloned = (source >= 0) && (target >= 0) && (::ioctl(target, FICLONE, source) == 0);
+        // NOTE The file system does not support reflinks, other files will not be tried.
+        if ((source >= 0) && (target >= 0) && !cloned)
+            *reflink = false;
+        if (source >= 0)
+            ::close(source);
+        if (target >= 0)
+            ::close(target);
+
+        if (cloned) {
+            QFile::setPermissions(targetPath, QFile::permissions(sourcePath));
+            return Reflink;
+        }
+        QFile::remove(targetPath);
+    }
+#else
+    *reflink = false;
+#endif
+
+#ifdef Q_OS_UNIX
+    if (isReplacedAtomically(sourcePath) && (::link(QFile::encodeName(sourcePath).constData(), QFile::encodeName(targetPath).constData()) == 0))
+        return Hardlink;
+#endif
+
+    if (QFile::copy(sourcePath, targetPath))
+        return Copy;
+    return Utils::ResultError(tr("Could not copy \"%1\" to \"%2\".").arg(sourcePath).arg(targetPath));
+}
+
+Utils::Result<> SettingsClone::clone(void)
+{
+    if (!mDir.isValid())
+        return Utils::ResultError(tr("Could not create settings clone directory for \"%1\": %2").arg(mTemplatePath).arg(mDir.errorString()));
+
+    QDir templateDir(mTemplatePath);
+    QDir cloneDir(mDir.path());
+    bool reflink = true;
+
+    QDirIterator it(mTemplatePath, QDir::AllEntries | QDir::Hidden | QDir::System | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        QFileInfo info = it.nextFileInfo();
+        QString targetPath = cloneDir.filePath(templateDir.relativeFilePath(info.filePath()));
+
+        if (info.isSymLink()) {
+            if (!QFile::link(info.symLinkTarget(), targetPath))
+                return Utils::ResultError(tr("Could not create symbolic link \"%1\".").arg(targetPath));
+        } else if (info.isDir()) {
+            if (!cloneDir.mkpath(targetPath))
+                return Utils::ResultError(tr("Could not create directory \"%1\".").arg(targetPath));
+        } else {
+            // NOTE Directories are not necessarily iterated before their contents.
+            cloneDir.mkpath(QFileInfo(targetPath).path());
+            Utils::Result<Method> method = cloneFile(info.filePath(), targetPath, &reflink);
+            if (!method)
+                return Utils::ResultError(method.error());
+            if (*method == Reflink)
+                mStatistics.reflinked++;
+            else if (*method == Hardlink)
+                mStatistics.hardlinked++;
+            else
+                mStatistics.copied++;
+        }
+    }
+
+    qCDebug(launchLog) << "Settings cloned from" << mTemplatePath << "to" << mDir.path()
+                       << mStatistics.reflinked << mStatistics.hardlinked << mStatistics.copied;
+    return Utils::ResultOk;
+}
+
+} // Internal
+} // QtcDevPlugin
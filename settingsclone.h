@@ -0,0 +1,146 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef SETTINGSCLONE_H
+#define SETTINGSCLONE_H
+
+#include <utils/result.h>
+
+#include <QCoreApplication>
+#include <QTemporaryDir>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The SettingsClone class clones a settings template for a run
+ *
+ * This class creates a fresh settings directory for a run of a Qt Creator instance
+ * by cloning a template settings directory, so that runs never modify the template
+ * (hence they do not depend on each other and can be executed in parallel).
+ *
+ * The clone is created next to the template (on the same file system), unless another
+ * parent directory is given (e.g. a TmpfsDirectory). Files are cloned
+ * with the cheapest method preserving the template:
+ *  \li Reflinks (copy-on-write clones) when the file system supports them (e.g. Btrfs, XFS);
+ *  \li Hard links for files which Qt Creator replaces atomically when it writes them
+ *  (\c .ini files written by \c QSettings and \c .xml files written by \c PersistentSettingsWriter),
+ *  so that only written files are actually copied;
+ *  \li Plain copies otherwise.
+ *
+ * The clone is removed when the instance is destroyed.
+ */
+class SettingsClone
+{
+    Q_DECLARE_TR_FUNCTIONS(QtcDevPlugin::Internal::SettingsClone)
+public:
+    /*!
+     * \brief Clone methods
+     */
+    enum Method {
+        Reflink,    /*!< The file was cloned with a reflink */
+        Hardlink,   /*!< The file was cloned with a hard link */
+        Copy,       /*!< The file was copied */
+    };
+
+    /*!
+     * \brief Clone statistics
+     */
+    typedef struct {
+        int reflinked;  /*!< Number of files cloned with a reflink */
+        int hardlinked; /*!< Number of files cloned with a hard link */
+        int copied;     /*!< Number of files copied */
+    } Statistics;
+
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new empty clone directory next to the given template directory
+     * or in the given parent directory.
+     * \param templatePath The path to the template directory.
+     * \param parentPath The path to the directory containing the clone
+     * (if it is empty, the clone is created next to the template).
+     * \sa clone()
+     */
+    SettingsClone(const QString& templatePath, const QString& parentPath = QString());
+
+    /*!
+     * \brief Clone the template
+     *
+     * Clones the contents of the template directory into the clone directory.
+     * \return \c ResultOk if the template was cloned, an error otherwise.
+     * \sa statistics()
+     */
+    Utils::Result<> clone(void);
+    /*!
+     * \brief Remove the clone
+     *
+     * Removes the clone directory and its contents.
+     */
+    inline void remove(void) {mDir.remove();}
+
+    /*!
+     * \brief Clone path
+     * \return The path to the clone directory.
+     */
+    inline QString path(void) const {return mDir.path();}
+    /*!
+     * \brief Clone statistics
+     * \return The numbers of files cloned with each method.
+     */
+    inline Statistics statistics(void) const {return mStatistics;}
+
+    /*!
+     * \brief Whether a file is replaced atomically
+     *
+     * Tells whether Qt Creator writes the given file by replacing it atomically
+     * (i.e. writing a new file and renaming it), so that it can be hard linked safely.
+     * \param fileName The name of the file.
+     * \return \c true if the file is replaced atomically, \c false otherwise.
+     */
+    static bool isReplacedAtomically(const QString& fileName);
+    /*!
+     * \brief Template path in arguments
+     *
+     * Finds the settings path passed with \c -settingspath in the given
+     * command line arguments of Qt Creator.
+     * \param arguments The command line arguments of Qt Creator.
+     * \return The settings path (without quotes) or an empty string if there is none.
+     */
+    static QString templatePath(const QStringList& arguments);
+    /*!
+     * \brief Clone a file
+     *
+     * Clones a file with the cheapest method available.
+     * \param sourcePath The path to the file.
+     * \param targetPath The path to the clone (which must not exist).
+     * \param reflink Whether reflinks may be tried. It is reset when reflinks
+     * are not supported, so that next files are not tried.
+     * \return The method used to clone the file or an error.
+     */
+    static Utils::Result<Method> cloneFile(const QString& sourcePath, const QString& targetPath, bool* reflink);
+private:
+    QString mTemplatePath;      /*!< The path to the template directory */
+    QTemporaryDir mDir;         /*!< The clone directory */
+    Statistics mStatistics;     /*!< The numbers of files cloned with each method */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // SETTINGSCLONE_H
@@ -0,0 +1,264 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "startupcomparison.h"
+#include "qtcdevpluginconstants.h"
+#include "qtcdevpluginlogging.h"
+
+#include <utils/aspects.h>
+#include <utils/hostosinfo.h>
+#include <utils/qtcprocess.h>
+
+#include <QtCore>
+
+#include <cmath>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief Median of values
+ *
+ * Computes the median of the given values.
+ * \param values A list of values (must not be empty).
+ * \return The median of the values.
+ */
+static double median(QList<double> values)
+{
+    std::sort(values.begin(), values.end());
+    int n = values.size();
+    if (n % 2 == 1)
+        return values.at(n / 2);
+    return (values.at(n / 2 - 1) + values.at(n / 2)) / 2.;
+}
+
+/*!
+ * \brief Standard error of the median
+ *
+ * Estimates the standard error of the median from the median absolute deviation,
+ * assuming the measurements are normally distributed.
+ * \param stats The statistics of the measurements.
+ * \return The standard error of the median.
+ */
+static double standardError(const StartupComparison::Statistics& stats)
+{
+    return 1.2533 * 1.4826 * stats.mad / std::sqrt(stats.count);
+}
+
+void StartupComparison::addSample(bool withPlugins, const Sample& sample)
+{
+    if (withPlugins)
+        mWithPlugins << sample;
+    else
+        mWithoutPlugins << sample;
+}
+
+StartupComparison::Statistics StartupComparison::statistics(QList<double> values)
+{
+    Statistics stats = {0, 0., 0., 0., 0.};
+    if (values.isEmpty())
+        return stats;
+
+    std::sort(values.begin(), values.end());
+    stats.count = values.size();
+    stats.median = median(values);
+
+    QList<double> deviations;
+    for (double value : values)
+        deviations << std::abs(value - stats.median);
+    stats.mad = median(deviations);
+
+    // NOTE Distribution-free interval: ranks of the order statistics bounding the median with 95% confidence.
+    double halfWidth = 1.96 * std::sqrt(stats.count) / 2.;
+    int lowerRank = qMax(1, (int) std::floor(stats.count / 2. - halfWidth));
+    int upperRank = qMin(stats.count, (int) std::ceil(1. + stats.count / 2. + halfWidth));
+    stats.lower = values.at(lowerRank - 1);
+    stats.upper = values.at(upperRank - 1);
+
+    return stats;
+}
+
+QStringList StartupComparison::report(void) const
+{
+    QStringList lines;
+
+    auto values = [] (const QList<Sample>& samples, double Sample::* member) {
+        QList<double> ans;
+        for (Sample sample : samples) {
+            if (sample.*member >= 0)
+                ans << sample.*member;
+        }
+        return ans;
+    };
+    auto describe = [] (const Statistics& stats, const QString& unit) {
+        return tr("median %1 %5, MAD %2 %5, 95% CI [%3, %4] %5")
+            .arg(stats.median, 0, 'f', 1)
+            .arg(stats.mad, 0, 'f', 1)
+            .arg(stats.lower, 0, 'f', 1)
+            .arg(stats.upper, 0, 'f', 1)
+            .arg(unit);
+    };
+    auto compare = [describe, &lines] (const QString& what, const QList<double>& with, const QList<double>& without, double scale, const QString& unit) {
+        if (with.isEmpty() || without.isEmpty())
+            return;
+
+        QList<double> scaledWith;
+        QList<double> scaledWithout;
+        for (double value : with)
+            scaledWith << value / scale;
+        for (double value : without)
+            scaledWithout << value / scale;
+
+        Statistics withStats = statistics(scaledWith);
+        Statistics withoutStats = statistics(scaledWithout);
+        double difference = withStats.median - withoutStats.median;
+        double error = 1.96 * std::sqrt(std::pow(standardError(withStats), 2) + std::pow(standardError(withoutStats), 2));
+
+        lines << tr("%1 with the plugin(s) (%2 launches): %3").arg(what).arg(withStats.count).arg(describe(withStats, unit));
+        lines << tr("%1 without the plugin(s) (%2 launches): %3").arg(what).arg(withoutStats.count).arg(describe(withoutStats, unit));
+        lines << tr("%1 added by the plugin(s): %2 %4 (95% CI [%3, %5] %4)")
+                     .arg(what)
+                     .arg(difference, 0, 'f', 1)
+                     .arg(difference - error, 0, 'f', 1)
+                     .arg(unit)
+                     .arg(difference + error, 0, 'f', 1);
+    };
+
+    compare(tr("Startup time"), values(mWithPlugins, &Sample::wallTime), values(mWithoutPlugins, &Sample::wallTime), 1., QLatin1String("ms"));
+    compare(tr("Peak RSS"), values(mWithPlugins, &Sample::peakRss), values(mWithoutPlugins, &Sample::peakRss), 1024., QLatin1String("MiB"));
+
+    return lines;
+}
+
+double StartupComparison::peakRss(qint64 pid)
+{
+    if (!Utils::HostOsInfo::isLinuxHost() || (pid <= 0))
+        return -1.;
+
+    QFile statusFile(QString::fromLatin1("/proc/%1/status").arg(pid));
+    if (!statusFile.open(QIODevice::ReadOnly | QIODevice::Text))
+        return -1.;
+
+    static const QRegularExpression peakRssRegExp(QLatin1String("^VmHWM:\\s*(\\d+)\\s*kB"), QRegularExpression::MultilineOption);
+    QRegularExpressionMatch match = peakRssRegExp.match(QString::fromLatin1(statusFile.readAll()));
+    if (!match.hasMatch())
+        return -1.;
+    return match.captured(1).toDouble();
+}
+
+bool StartupComparison::isStartupDone(const QString& output)
+{
+    static const QRegularExpression summaryRegExp(QLatin1String("^\\s*Plugin profiling summar"),
+                                                  QRegularExpression::MultilineOption | QRegularExpression::CaseInsensitiveOption);
+    return summaryRegExp.match(output).hasMatch();
+}
+
+QString StartupComparison::pluginName(const Utils::FilePath& pluginFilePath)
+{
+    QString name = pluginFilePath.baseName();
+    if (!Utils::HostOsInfo::isWindowsHost() && name.startsWith(QLatin1String("lib")))
+        name = name.mid(3);
+    return name;
+}
+
+Tasking::Group StartupComparison::receipe(ProjectExplorer::RunControl* runControl)
+{
+    auto launchesData = static_cast<const Utils::IntegerAspect::Data*>(runControl->aspectData(Utils::Id(Constants::StartupLaunchesId)));
+    const int launches = (launchesData != nullptr) ? launchesData->value : DefaultLaunches;
+
+    QStringList pluginNames;
+    if (!runControl->targetFilePath().isEmpty())
+        pluginNames << pluginName(runControl->targetFilePath());
+    auto testedPluginsData = static_cast<const Utils::StringListAspect::Data*>(runControl->aspectData(Utils::Id(Constants::TestedPluginsId)));
+    if (testedPluginsData != nullptr) {
+        for (QString path : testedPluginsData->value)
+            pluginNames << pluginName(Utils::FilePath::fromString(path));
+    }
+
+    auto comparison = std::make_shared<StartupComparison>();
+    const Tasking::LoopRepeat iterator(2 * launches);
+
+    const auto onSetup = [runControl, comparison, pluginNames, iterator, launches] (Utils::Process& process) {
+        // NOTE Launches with and without the plugins are interleaved, so that drifts affect both equally.
+        const bool withPlugins = (iterator.iteration() % 2 == 0);
+
+        Utils::CommandLine command = runControl->commandLine();
+        command.addArg(QLatin1String("-profile"));
+        if (!withPlugins) {
+            for (QString name : pluginNames)
+                command.addArgs(QStringList() << QLatin1String("-noload") << name);
+        }
+        qCDebug(launchLog) << "Startup comparison launch:" << command.toUserOutput();
+
+        process.setCommand(command);
+        process.setWorkingDirectory(runControl->workingDirectory());
+        process.setEnvironment(runControl->environment());
+        process.setProcessChannelMode(QProcess::MergedChannels);
+
+        auto timer = std::make_shared<QElapsedTimer>();
+        auto output = std::make_shared<QString>();
+        auto done = std::make_shared<bool>(false);
+        QObject::connect(&process, &Utils::Process::started, &process, [timer] () {
+            timer->start();
+        });
+        QObject::connect(&process, &Utils::Process::readyReadStandardOutput, &process, [&process, timer, output, done, comparison, withPlugins] () {
+            if (*done)
+                return;
+            output->append(process.readAllStandardOutput());
+            if (!isStartupDone(*output))
+                return;
+
+            comparison->addSample(withPlugins, {
+                .wallTime = (double) timer->elapsed(),
+                .peakRss = peakRss(process.processId()),
+            });
+            *done = true;
+            process.stop();
+        });
+
+        runControl->postMessage(tr("Launch %1/%2 %3 the plugin(s).")
+                                    .arg(iterator.iteration() / 2 + 1)
+                                    .arg(launches)
+                                    .arg(withPlugins ? tr("with") : tr("without")),
+                                Utils::NormalMessageFormat);
+    };
+    const auto onDone = [runControl, comparison, iterator] (const Utils::Process& process, Tasking::DoneWith result) {
+        Q_UNUSED(process)
+
+        if (result == Tasking::DoneWith::Cancel)
+            return Tasking::DoneResult::Error;
+        if (comparison->sampleCount() <= iterator.iteration()) {
+            runControl->postMessage(tr("Qt Creator exited before the end of its startup."), Utils::ErrorMessageFormat);
+            return Tasking::DoneResult::Error;
+        }
+        return Tasking::DoneResult::Success;
+    };
+
+    return Tasking::Group {
+        Tasking::For (iterator) >> Tasking::Do {
+            Utils::ProcessTask(onSetup, onDone)
+        },
+        Tasking::onGroupDone([runControl, comparison] () {
+            for (QString line : comparison->report())
+                runControl->postMessage(line, Utils::NormalMessageFormat);
+        })
+    };
+}
+
+} // Internal
+} // QtcDevPlugin
@@ -0,0 +1,149 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef STARTUPCOMPARISON_H
+#define STARTUPCOMPARISON_H
+
+#include <projectexplorer/runcontrol.h>
+
+#include <utils/filepath.h>
+
+#include <QCoreApplication>
+#include <QStringList>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The StartupComparison class compares Qt Creator startup with and without plugins
+ *
+ * This class launches the Qt Creator instance of a run control several times
+ * alternatively with the plugin(s) being developped loaded and with them disabled
+ * (using \c -noload). For each launch, it measures the wall time until Qt Creator
+ * has finished its startup and the peak resident set size of the instance at that time.
+ * The instance is then stopped.
+ *
+ * The end of startup is detected thanks to the summary printed by
+ * Qt Creator plugin manager when \c -profile is passed on the command line,
+ * once all plugins are initialized (i.e. after the main window is shown).
+ *
+ * Once all launches are done, the medians, median absolute deviations
+ * and confidence intervals are reported in the output of the run control.
+ */
+class StartupComparison
+{
+    Q_DECLARE_TR_FUNCTIONS(QtcDevPlugin::Internal::StartupComparison)
+public:
+    /*!
+     * \brief Measurements of a launch
+     */
+    typedef struct {
+        double wallTime;    /*!< The wall time to the end of startup (in milliseconds) */
+        double peakRss;     /*!< The peak resident set size at the end of startup (in kibibytes, negative if unknown) */
+    } Sample;
+
+    /*!
+     * \brief Statistics of a series of measurements
+     */
+    typedef struct {
+        int count;          /*!< The number of measurements */
+        double median;      /*!< The median of the measurements */
+        double mad;         /*!< The median absolute deviation of the measurements */
+        double lower;       /*!< The lower bound of the 95% confidence interval of the median */
+        double upper;       /*!< The upper bound of the 95% confidence interval of the median */
+    } Statistics;
+
+    /*!
+     * \brief Add a sample
+     *
+     * Records the measurements of a launch.
+     * \param withPlugins Whether the plugins were loaded during this launch.
+     * \param sample The measurements of the launch.
+     */
+    void addSample(bool withPlugins, const Sample& sample);
+    /*!
+     * \brief Number of samples
+     *
+     * Returns the number of recorded samples (with and without the plugins).
+     * \return The number of recorded samples.
+     */
+    inline int sampleCount(void) const {return mWithPlugins.size() + mWithoutPlugins.size();}
+    /*!
+     * \brief Comparison report
+     *
+     * Returns a human readable report comparing the launches with and without the plugins.
+     * \return The lines of the report.
+     */
+    QStringList report(void) const;
+
+    /*!
+     * \brief Statistics of measurements
+     *
+     * Computes the median, the median absolute deviation and a distribution-free
+     * 95% confidence interval (based on order statistics) of the median of the given values.
+     * \param values The measurements.
+     * \return The statistics of the measurements.
+     */
+    static Statistics statistics(QList<double> values);
+    /*!
+     * \brief Peak resident set size
+     *
+     * Returns the peak resident set size of a process (\c VmHWM in <tt>/proc/<pid>/status</tt>).
+     * \param pid The process identifier.
+     * \return The peak resident set size in kibibytes or a negative value if it is unknown
+     * (e.g. if the platform is not Linux).
+     */
+    static double peakRss(qint64 pid);
+    /*!
+     * \brief Whether the startup is done
+     *
+     * Tells whether the given output of Qt Creator (started with \c -profile)
+     * contains the summary printed at the end of startup.
+     * \param output The output of Qt Creator.
+     * \return \c true if the output marks the end of startup, \c false otherwise.
+     */
+    static bool isStartupDone(const QString& output);
+    /*!
+     * \brief Plugin name
+     *
+     * Returns the name of a plugin (as expected by \c -noload) from the path to its library.
+     * \param pluginFilePath The path to the plugin library.
+     * \return The name of the plugin.
+     */
+    static QString pluginName(const Utils::FilePath& pluginFilePath);
+
+    /*!
+     * \brief Receipe for the comparison
+     *
+     * Returns the tasks launching the Qt Creator instance of the run control
+     * with and without the plugins and reporting the comparison.
+     * \param runControl The run control.
+     * \return The tasks to execute the comparison.
+     */
+    static Tasking::Group receipe(ProjectExplorer::RunControl* runControl);
+
+    static const int DefaultLaunches = 10;  /*!< The default number of launches with and without the plugins */
+private:
+    QList<Sample> mWithPlugins;     /*!< The measurements of the launches with the plugins */
+    QList<Sample> mWithoutPlugins;  /*!< The measurements of the launches without the plugins */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // STARTUPCOMPARISON_H
@@ -0,0 +1,362 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "testimpactanalyzer.h"
+#include "qtcdevpluginlogging.h"
+
+#include <utils/algorithm.h>
+#include <utils/environment.h>
+#include <utils/qtcprocess.h>
+
+#include <QtCore>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief Split a dependency list
+ *
+ * Splits a dependency list in Makefile syntax into paths,
+ * taking care of escaped spaces.
+ * \param dependencies A dependency list.
+ * \return The list of paths in the dependency list.
+ */
+static QStringList splitDependencies(const QString& dependencies)
+{
+    QStringList paths;
+    QString path;
+
+    for (int c = 0; c < dependencies.size(); c++) {
+        if ((dependencies.at(c) == QLatin1Char('\\')) && (c + 1 < dependencies.size()) && (dependencies.at(c + 1) == QLatin1Char(' '))) {
+            path.append(QLatin1Char(' '));
+            c++;
+        } else if (dependencies.at(c).isSpace()) {
+            if (!path.isEmpty())
+                paths << path;
+            path.clear();
+        } else {
+            path.append(dependencies.at(c));
+        }
+    }
+    if (!path.isEmpty())
+        paths << path;
+
+    return paths;
+}
+
+/*!
+ * \brief Parse Ninja dependency log
+ *
+ * Parses the output of <tt>ninja -t deps</tt>.
+ * \param output The output of <tt>ninja -t deps</tt>.
+ * \param buildDirectory The build directory (used to resolve relative paths).
+ * \return A map whose keys are the compiled sources and values are their dependencies.
+ */
+static QMap<Utils::FilePath, QSet<Utils::FilePath>> parseNinjaDeps(const QString& output, const Utils::FilePath& buildDirectory)
+{
+    QMap<Utils::FilePath, QSet<Utils::FilePath>> dependencies;
+    Utils::FilePath source;
+
+    for (QString line : output.split(QLatin1Char('\n'))) {
+        if (line.trimmed().isEmpty() || !line.at(0).isSpace()) {
+            source.clear();
+            continue;
+        }
+
+        Utils::FilePath path = buildDirectory.resolvePath(line.trimmed()).cleanPath();
+        if (source.isEmpty())
+            source = path;
+        dependencies[source].insert(path);
+    }
+
+    return dependencies;
+}
+
+TestImpactAnalyzer::TestImpactAnalyzer(const Utils::FilePath& sourceDirectory, const Utils::FilePath& buildDirectory, const QString& buildKey) :
+    mSourceDirectory(sourceDirectory), mBuildDirectory(buildDirectory), mBuildKey(buildKey)
+{
+}
+
+std::optional<QStringList> TestImpactAnalyzer::affectedTestFunctions(void) const
+{
+    QString revision = recordedRevision();
+    if (revision.isEmpty())
+        return std::nullopt;
+
+    std::optional<QList<Utils::FilePath>> changes = changedFiles(revision);
+    if (!changes.has_value())
+        return std::nullopt;
+
+    qCDebug(testsLog) << "Files changed since" << revision << ":" << *changes;
+    return affectedTestFunctions(*changes);
+}
+
+std::optional<QStringList> TestImpactAnalyzer::affectedTestFunctions(const QList<Utils::FilePath>& changedFiles) const
+{
+    QMap<Utils::FilePath, QSet<Utils::FilePath>> dependencies;
+
+    Utils::FileFilter dependencyFilter(QStringList() << QLatin1String("*.d"), QDir::Files, QDirIterator::Subdirectories);
+    for (Utils::FilePath dependencyFilePath : mBuildDirectory.dirEntries(dependencyFilter))
+        dependencies.insert(parseDependencyFile(dependencyFilePath, mBuildDirectory));
+
+    // NOTE Ninja removes dependency files once it has stored them in its log.
+    Utils::FilePath ninjaPath = Utils::Environment::systemEnvironment().searchInPath(QLatin1String("ninja"));
+    if (!ninjaPath.isEmpty() && mBuildDirectory.pathAppended("build.ninja").isFile()) {
+        Utils::Process ninja;
+        ninja.setCommand(Utils::CommandLine(ninjaPath, QStringList() << QLatin1String("-C") << mBuildDirectory.nativePath() << QLatin1String("-t") << QLatin1String("deps")));
+        ninja.runBlocking();
+        if (ninja.result() == Utils::ProcessResult::FinishedWithSuccess)
+            dependencies.insert(parseNinjaDeps(ninja.cleanedStdOut(), mBuildDirectory));
+    }
+
+    // NOTE The build directory may contain other plugins, whose sources are ignored.
+    for (auto it = dependencies.begin(); it != dependencies.end();) {
+        if (it.key().isChildOf(mSourceDirectory))
+            it++;
+        else
+            it = dependencies.erase(it);
+    }
+
+    if (dependencies.isEmpty())
+        return std::nullopt;
+
+    QSet<Utils::FilePath> changes;
+    for (Utils::FilePath changedFile : changedFiles)
+        changes.insert(changedFile.cleanPath());
+
+    QList<Utils::FilePath> testSources;
+    QSet<Utils::FilePath> testDependencies;
+    QSet<Utils::FilePath> pluginDependencies;
+    for (auto it = dependencies.cbegin(); it != dependencies.cend(); it++) {
+        if (Utils::anyOf(it.value(), [] (const Utils::FilePath& path) {
+            return (path.fileName() == QLatin1String("QtTest")) || (path.fileName() == QLatin1String("qtest.h"));
+        })) {
+            testSources << it.key();
+            testDependencies.insert(it.key());
+            testDependencies.unite(it.value());
+        } else {
+            pluginDependencies.insert(it.key());
+            pluginDependencies.unite(it.value());
+        }
+    }
+
+    /* NOTE A change in the sources of the plugin which no test source depends on
+     * (e.g. a source file of the plugin) may affect any test, hence all the tests are selected. */
+    QSet<Utils::FilePath> untestedChanges = QSet<Utils::FilePath>(changes).intersect(pluginDependencies).subtract(testDependencies);
+    if (!untestedChanges.isEmpty())
+        qCDebug(testsLog) << "Changes not covered by test sources (all tests are affected):" << untestedChanges;
+
+    QStringList testFunctionNames;
+    for (Utils::FilePath testSource : testSources) {
+        if (untestedChanges.isEmpty() && !changes.contains(testSource) && !dependencies.value(testSource).intersects(changes))
+            continue;
+
+        qCDebug(testsLog) << "Affected test source:" << testSource;
+        for (QString testFunctionName : testFunctions(testSource) + testFunctions(testSource.parentDir().pathAppended(testSource.completeBaseName() + QLatin1String(".h")))) {
+            if (!testFunctionNames.contains(testFunctionName))
+                testFunctionNames << testFunctionName;
+        }
+    }
+
+    return testFunctionNames;
+}
+
+QStringList TestImpactAnalyzer::selectTestFunctions(QStringList arguments, const QString& pluginName, const QStringList& testFunctionNames)
+{
+    for (int a = 0; a + 1 < arguments.size(); a++) {
+        if ((arguments.at(a) == QLatin1String("-test")) && (arguments.at(a + 1) == pluginName))
+            arguments[a + 1] = QStringList(testFunctionNames).prepend(pluginName).join(QLatin1Char(','));
+    }
+    return arguments;
+}
+
+QStringList TestImpactAnalyzer::skipTests(QStringList arguments, const QString& pluginName)
+{
+    for (int a = 0; a + 1 < arguments.size();) {
+        if ((arguments.at(a) == QLatin1String("-test")) && (arguments.at(a + 1).section(QLatin1Char(','), 0, 0) == pluginName))
+            arguments.remove(a, 2);
+        else
+            a++;
+    }
+    return arguments;
+}
+
+bool TestImpactAnalyzer::hasTests(const QStringList& arguments)
+{
+    return arguments.contains(QLatin1String("-test"));
+}
+
+QMap<Utils::FilePath, QSet<Utils::FilePath>> TestImpactAnalyzer::parseDependencyFile(const Utils::FilePath& dependencyFilePath, const Utils::FilePath& baseDirectory)
+{
+    QMap<Utils::FilePath, QSet<Utils::FilePath>> dependencies;
+
+    Utils::Result<QByteArray> contents = dependencyFilePath.fileContents();
+    if (!contents)
+        return dependencies;
+
+    QString data = QString::fromLocal8Bit(*contents);
+    data.replace(QLatin1String("\\\r\n"), QLatin1String(" "));
+    data.replace(QLatin1String("\\\n"), QLatin1String(" "));
+
+    for (QString rule : data.split(QLatin1Char('\n'), Qt::SkipEmptyParts)) {
+        // NOTE Skip the target (which may contain a drive letter on Windows).
+        int colon = rule.indexOf(QLatin1String(": "));
+        if (colon == -1)
+            continue;
+
+        QStringList paths = splitDependencies(rule.mid(colon + 2));
+        if (paths.isEmpty())
+            continue;
+
+        Utils::FilePath source = baseDirectory.resolvePath(paths.first()).cleanPath();
+        for (QString path : paths)
+            dependencies[source].insert(baseDirectory.resolvePath(path).cleanPath());
+    }
+
+    return dependencies;
+}
+
+QStringList TestImpactAnalyzer::testFunctions(const Utils::FilePath& sourceFilePath)
+{
+    return Utils::transform(testSlots(sourceFilePath), [] (const QString& testSlot) {
+        return testSlot.mid(testSlot.lastIndexOf(QLatin1String("::")) + 2);
+    });
+}
+
+QStringList TestImpactAnalyzer::testSlots(const Utils::FilePath& sourceFilePath)
+{
+    static const QRegularExpression classRegExp(QLatin1String("^\\s*(?:class|struct)\\s+(?:\\w+_EXPORT\\s+)?(\\w+)\\b[^;]*$"));
+    static const QRegularExpression slotsRegExp(QLatin1String("^\\s*(public|protected|private)\\s+(Q_SLOTS|slots)\\s*:"));
+    static const QRegularExpression accessRegExp(QLatin1String("^\\s*(public|protected|private|signals|Q_SIGNALS)\\s*:"));
+    static const QRegularExpression functionRegExp(QLatin1String("^\\s*(?:inline\\s+)?void\\s+(\\w+)\\s*\\("));
+    static const QStringList specialFunctions = QStringList() << QLatin1String("initTestCase") << QLatin1String("cleanupTestCase")
+                                                              << QLatin1String("init") << QLatin1String("cleanup");
+
+    QStringList functions;
+
+    Utils::Result<QByteArray> contents = sourceFilePath.fileContents();
+    if (!contents)
+        return functions;
+
+    bool inSlots = false;
+    QString className;
+    for (QString line : QString::fromUtf8(*contents).split(QLatin1Char('\n'))) {
+        QRegularExpressionMatch classMatch = classRegExp.match(line);
+        if (classMatch.hasMatch()) {
+            className = classMatch.captured(1);
+            inSlots = false;
+            continue;
+        }
+        if (slotsRegExp.match(line).hasMatch()) {
+            inSlots = true;
+            continue;
+        }
+        if (accessRegExp.match(line).hasMatch()) {
+            inSlots = false;
+            continue;
+        }
+        if (!inSlots)
+            continue;
+
+        QRegularExpressionMatch match = functionRegExp.match(line);
+        if (!match.hasMatch())
+            continue;
+        QString function = match.captured(1);
+        if (function.endsWith(QLatin1String("_data")) || specialFunctions.contains(function))
+            continue;
+        functions << QString(QLatin1String("%1::%2")).arg(className, function);
+    }
+
+    return functions;
+}
+
+QStringList TestImpactAnalyzer::directoryTestSlots(const Utils::FilePath& sourceDirectory)
+{
+    QStringList functions;
+
+    Utils::FileFilter headerFilter(QStringList() << QLatin1String("*.h"), QDir::Files, QDirIterator::Subdirectories);
+    for (Utils::FilePath headerFilePath : sourceDirectory.dirEntries(headerFilter))
+        functions << testSlots(headerFilePath);
+
+    return functions;
+}
+
+QString TestImpactAnalyzer::recordedRevision(void) const
+{
+    QSettings record(recordFilePath().nativePath(), QSettings::IniFormat);
+    record.beginGroup(QLatin1String("LastSuccessfulRevision"));
+    return record.value(QString::fromLatin1(QUrl::toPercentEncoding(mBuildKey))).toString();
+}
+
+bool TestImpactAnalyzer::recordSuccessfulRun(void) const
+{
+    std::optional<QString> revision = git(QStringList() << QLatin1String("rev-parse") << QLatin1String("HEAD"));
+    if (!revision.has_value())
+        return false;
+
+    QSettings record(recordFilePath().nativePath(), QSettings::IniFormat);
+    record.beginGroup(QLatin1String("LastSuccessfulRevision"));
+    record.setValue(QString::fromLatin1(QUrl::toPercentEncoding(mBuildKey)), revision->trimmed());
+    record.endGroup();
+    record.sync();
+
+    return record.status() == QSettings::NoError;
+}
+
+std::optional<QList<Utils::FilePath>> TestImpactAnalyzer::changedFiles(const QString& revision) const
+{
+    std::optional<QString> topLevel = git(QStringList() << QLatin1String("rev-parse") << QLatin1String("--show-toplevel"));
+    std::optional<QString> changed = git(QStringList() << QLatin1String("diff") << QLatin1String("--name-only") << revision);
+    std::optional<QString> untracked = git(QStringList() << QLatin1String("ls-files") << QLatin1String("--full-name") << QLatin1String("--others") << QLatin1String("--exclude-standard"));
+    if (!topLevel.has_value() || !changed.has_value() || !untracked.has_value())
+        return std::nullopt;
+
+    Utils::FilePath topLevelPath = Utils::FilePath::fromUserInput(topLevel->trimmed());
+    QList<Utils::FilePath> changes;
+    for (QString path : (*changed + QLatin1Char('\n') + *untracked).split(QLatin1Char('\n'), Qt::SkipEmptyParts))
+        changes << topLevelPath.pathAppended(path.trimmed());
+
+    return changes;
+}
+
+std::optional<QString> TestImpactAnalyzer::git(const QStringList& arguments) const
+{
+    Utils::FilePath gitPath = Utils::Environment::systemEnvironment().searchInPath(QLatin1String("git"));
+    if (gitPath.isEmpty()) {
+        qCWarning(testsLog) << "Could not find \"git\" in path";
+        return std::nullopt;
+    }
+
+    Utils::Process process;
+    process.setCommand(Utils::CommandLine(gitPath, QStringList() << QLatin1String("-C") << mSourceDirectory.nativePath() << arguments));
+    process.runBlocking();
+    if (process.result() != Utils::ProcessResult::FinishedWithSuccess) {
+        qCWarning(testsLog) << "git" << arguments << "failed:" << process.cleanedStdErr();
+        return std::nullopt;
+    }
+
+    return process.cleanedStdOut();
+}
+
+Utils::FilePath TestImpactAnalyzer::recordFilePath(void) const
+{
+    return mBuildDirectory.pathAppended(QLatin1String(".qtcdevplugin.ini"));
+}
+
+} // Internal
+} // QtcDevPlugin
@@ -0,0 +1,203 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef TESTIMPACTANALYZER_H
+#define TESTIMPACTANALYZER_H
+
+#include <utils/filepath.h>
+
+#include <QMap>
+#include <QSet>
+#include <QStringList>
+
+#include <optional>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The TestImpactAnalyzer class selects the tests affected by source changes
+ *
+ * This class maps the test sources of a plugin to the files they depend on,
+ * using the dependency files (<tt>*.d</tt>) written by the compiler in the build tree
+ * (CMake with Ninja or Makefile generators writes them by default).
+ * It then compares the list of files changed since the last successful test run
+ * (obtained with \c git) with these dependencies to find out the test functions
+ * which should be run.
+ *
+ * Only the sources in the source directory of the plugin are considered.
+ * When a changed source of the plugin is not a dependency of any test source
+ * (e.g. a source file of the plugin), all the test functions are selected.
+ *
+ * The revision of the last successful test run is stored in the build directory
+ * (see recordSuccessfulRun() and recordedRevision()).
+ *
+ * \note The analysis runs \c git and \c ninja and walks the build tree,
+ * hence it should not run in the main thread.
+ */
+class TestImpactAnalyzer
+{
+public:
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new analyzer for a plugin.
+     * \param sourceDirectory The directory containing the sources of the plugin.
+     * \param buildDirectory The directory containing the build tree of the plugin.
+     * \param buildKey The build key of the plugin (used to store the last successful revision).
+     */
+    TestImpactAnalyzer(const Utils::FilePath& sourceDirectory, const Utils::FilePath& buildDirectory, const QString& buildKey);
+
+    /*!
+     * \brief Test functions affected by changes
+     *
+     * Returns the test functions affected by the changes since the last successful run.
+     * \return The names of the affected test functions (which may be empty when no test is affected),
+     * or \c std::nullopt when the affected tests cannot be determined
+     * (no recorded revision, no dependency files or \c git failure).
+     * \sa affectedTestFunctions(const QList<Utils::FilePath>&)
+     */
+    std::optional<QStringList> affectedTestFunctions(void) const;
+    /*!
+     * \brief Test functions affected by the given changes
+     *
+     * Returns the test functions affected by the given changed files.
+     * \param changedFiles The list of the changed files (absolute paths).
+     * \return The names of the affected test functions (which may be empty when no test is affected),
+     * or \c std::nullopt when no dependency file for the sources of the plugin could be found in the build tree.
+     * \sa affectedTestFunctions()
+     */
+    std::optional<QStringList> affectedTestFunctions(const QList<Utils::FilePath>& changedFiles) const;
+
+    /*!
+     * \brief Revision of the last successful run
+     *
+     * Returns the \c git revision recorded after the last successful test run.
+     * \return The revision of the last successful run or an empty string if none was recorded.
+     * \sa recordSuccessfulRun()
+     */
+    QString recordedRevision(void) const;
+    /*!
+     * \brief Record a successful run
+     *
+     * Stores the current \c git revision of the sources
+     * as the revision of the last successful test run.
+     * \return \c true if the revision could be recorded, \c false otherwise.
+     * \sa recordedRevision()
+     */
+    bool recordSuccessfulRun(void) const;
+
+    /*!
+     * \brief Parse a dependency file
+     *
+     * Parses a dependency file in Makefile syntax (as written by the compiler with \c -MD).
+     * \param dependencyFilePath The path to the dependency file.
+     * \param baseDirectory The directory used to resolve relative paths (the directory where the compiler ran).
+     * \return A map whose keys are the compiled sources and values are their dependencies.
+     */
+    static QMap<Utils::FilePath, QSet<Utils::FilePath>> parseDependencyFile(const Utils::FilePath& dependencyFilePath, const Utils::FilePath& baseDirectory);
+    /*!
+     * \brief Test functions defined in a source file
+     *
+     * Parses the given test source file and returns the names of the test functions it declares
+     * (i.e. the private slots which are neither \c _data functions nor initialisation or cleanup functions).
+     * \param sourceFilePath The path to the test source file.
+     * \return The names of the test functions in the given source file.
+     */
+    static QStringList testFunctions(const Utils::FilePath& sourceFilePath);
+    /*!
+     * \brief Test slots defined in a source file
+     *
+     * Parses the given test source file and returns the test functions it declares
+     * (see testFunctions()) prefixed with the name of their class (e.g. \c ModelTest::testIndex).
+     * \param sourceFilePath The path to the test source file.
+     * \return The test functions in the given source file prefixed with the name of their class.
+     */
+    static QStringList testSlots(const Utils::FilePath& sourceFilePath);
+    /*!
+     * \brief Test slots defined in a source directory
+     *
+     * Parses the headers in the given directory and its subdirectories
+     * and returns the test functions they declare (see testSlots()), in declaration order.
+     * \note This function walks the source directory, hence it should not run in the main thread.
+     * \param sourceDirectory The directory containing the sources of the plugin.
+     * \return The test functions in the headers prefixed with the name of their class.
+     */
+    static QStringList directoryTestSlots(const Utils::FilePath& sourceDirectory);
+    /*!
+     * \brief Select test functions
+     *
+     * Restricts the \c -test argument of the given plugin to the given test functions.
+     * \param arguments The command line arguments of Qt Creator.
+     * \param pluginName The name of the plugin (as given to \c -test).
+     * \param testFunctionNames The names of the test functions to run.
+     * \return The command line arguments running only the given test functions of the plugin.
+     */
+    static QStringList selectTestFunctions(QStringList arguments, const QString& pluginName, const QStringList& testFunctionNames);
+    /*!
+     * \brief Skip tests
+     *
+     * Removes the \c -test argument of the given plugin, so that its tests are not run.
+     * \param arguments The command line arguments of Qt Creator.
+     * \param pluginName The name of the plugin (as given to \c -test).
+     * \return The command line arguments which do not run the tests of the plugin.
+     * \sa hasTests()
+     */
+    static QStringList skipTests(QStringList arguments, const QString& pluginName);
+    /*!
+     * \brief Whether tests are run
+     * \param arguments The command line arguments of Qt Creator.
+     * \return \c true if the command line arguments run the tests of a plugin (i.e. contain a \c -test argument).
+     * \sa skipTests()
+     */
+    static bool hasTests(const QStringList& arguments);
+private:
+    /*!
+     * \brief Files changed since a revision
+     *
+     * Uses \c git to list the files changed (committed, staged, unstaged and untracked)
+     * since the given revision.
+     * \param revision A \c git revision.
+     * \return The list of the changed files or \c std::nullopt if \c git failed.
+     */
+    std::optional<QList<Utils::FilePath>> changedFiles(const QString& revision) const;
+    /*!
+     * \brief Run git
+     *
+     * Runs \c git with the given arguments in the source directory.
+     * \param arguments The arguments to pass to \c git.
+     * \return The standard output of \c git or \c std::nullopt if it failed.
+     */
+    std::optional<QString> git(const QStringList& arguments) const;
+    /*!
+     * \brief Path to the record file
+     *
+     * Returns the path to the file where the revisions of the last successful runs are stored.
+     * \return The path to the record file.
+     */
+    Utils::FilePath recordFilePath(void) const;
+
+    Utils::FilePath mSourceDirectory;   /*!< The directory containing the sources of the plugin */
+    Utils::FilePath mBuildDirectory;    /*!< The directory containing the build tree of the plugin */
+    QString mBuildKey;                  /*!< The build key of the plugin */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // TESTIMPACTANALYZER_H
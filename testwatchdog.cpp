@@ -0,0 +1,246 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "testwatchdog.h"
+#include "qtcdevpluginlogging.h"
+
+#include <projectexplorer/projectexplorerconstants.h>
+#include <projectexplorer/runcontrol.h>
+
+#include <utils/environment.h>
+#include <utils/processhandle.h>
+#include <utils/qtcprocess.h>
+
+#include <QtCore>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+TestWatchdog::TestWatchdog(ProjectExplorer::RunControl* runControl, int timeout, const QMap<QString, int>& functionTimeouts) :
+    QObject(runControl), mRunControl(runControl), mTimeout(timeout), mFunctionTimeouts(functionTimeouts)
+{
+    if (runControl == nullptr)
+        return;
+
+    connect(runControl, &ProjectExplorer::RunControl::appendMessage,
+            this, &TestWatchdog::handleOutput);
+    connect(runControl, &ProjectExplorer::RunControl::stopped,
+            this, &QObject::deleteLater);
+
+    mCheckTimer.setInterval(1000);
+    connect(&mCheckTimer, &QTimer::timeout,
+            this, &TestWatchdog::check);
+
+    // NOTE The function timer starts with QtTest output (see handleLine()).
+    mCheckTimer.start();
+}
+
+QMap<QString, int> TestWatchdog::parseTimeouts(const QString& timeouts)
+{
+    QMap<QString, int> functionTimeouts;
+
+    for (QString timeout : timeouts.split(QLatin1Char(','), Qt::SkipEmptyParts)) {
+        int equal = timeout.indexOf(QLatin1Char('='));
+        if (equal == -1) {
+            qCWarning(testsLog) << "Invalid function timeout:" << timeout.trimmed();
+            continue;
+        }
+
+        bool ok;
+        QString function = timeout.left(equal).trimmed();
+        int seconds = timeout.mid(equal + 1).trimmed().toInt(&ok);
+        if (function.isEmpty() || !ok || (seconds < 0)) {
+            qCWarning(testsLog) << "Invalid function timeout:" << timeout.trimmed();
+            continue;
+        }
+        functionTimeouts.insert(function, seconds);
+    }
+
+    return functionTimeouts;
+}
+
+void TestWatchdog::handleOutput(const QString& msg, Utils::OutputFormat format)
+{
+    if ((format != Utils::StdOutFormat) && (format != Utils::StdErrFormat))
+        return;
+
+    mLineBuffer.append(msg);
+    int newLine;
+    while ((newLine = mLineBuffer.indexOf(QLatin1Char('\n'))) != -1) {
+        handleLine(mLineBuffer.left(newLine));
+        mLineBuffer.remove(0, newLine + 1);
+    }
+}
+
+void TestWatchdog::handleLine(const QString& line)
+{
+    static const QRegularExpression lineRegExp(QLatin1String("^([A-Z!]+)\\s*:\\s*(?:[\\w:]+::)?(\\w+)\\((\\))?"));
+    static const QRegularExpression startRegExp(QLatin1String("^\\*+\\s*Start testing of (?:\\w+::)*(\\w+)"));
+    static const QStringList endTypes = QStringList() << QLatin1String("PASS") << QLatin1String("FAIL!") << QLatin1String("SKIP");
+
+    QRegularExpressionMatch startMatch = startRegExp.match(line.trimmed());
+    if (startMatch.hasMatch()) {
+        // NOTE The first test function of a test class (initTestCase()) starts now.
+        mCurrentClass = startMatch.captured(1);
+        mCurrentFunction.clear();
+        mNextFunctions = QStringList() << QLatin1String("initTestCase");
+        mFunctionTimer.restart();
+        return;
+    }
+
+    QRegularExpressionMatch match = lineRegExp.match(line.trimmed());
+    if (!match.hasMatch())
+        return;
+
+    if (endTypes.contains(match.captured(1))) {
+        // NOTE The next test function (or data row) starts now.
+        mCurrentFunction.clear();
+        mNextFunctions = nextFunctions(match.captured(2), !match.hasCaptured(3));
+        mFunctionTimer.restart();
+    } else {
+        mCurrentFunction = match.captured(2);
+    }
+}
+
+QStringList TestWatchdog::nextFunctions(const QString& function, bool dataRow) const
+{
+    QStringList functions;
+    const QString prefix = mCurrentClass + QLatin1String("::");
+    for (QString testSlot : mTestSlots) {
+        if (testSlot.startsWith(prefix))
+            functions << testSlot.mid(prefix.size());
+    }
+
+    QStringList next;
+    if (dataRow)
+        next << function;
+
+    // NOTE When the test slots of the class are unknown, the next test function cannot be inferred.
+    if ((function == QLatin1String("initTestCase")) && !functions.isEmpty()) {
+        next << functions.first();
+    } else if (functions.contains(function)) {
+        int index = functions.indexOf(function);
+        next << ((index + 1 < functions.size()) ? functions.at(index + 1) : QLatin1String("cleanupTestCase"));
+    }
+
+    // NOTE A data row of an unknown test function may be followed by any test function.
+    if (dataRow && (next.size() == 1))
+        next.clear();
+    return next;
+}
+
+int TestWatchdog::currentTimeout(void) const
+{
+    if (!mCurrentFunction.isEmpty())
+        return mFunctionTimeouts.value(mCurrentFunction, mTimeout);
+    if (mNextFunctions.isEmpty())
+        return mTimeout;
+
+    // NOTE A disabled timeout (0) is larger than any other.
+    int limit = 0;
+    for (QString function : mNextFunctions) {
+        int functionLimit = mFunctionTimeouts.value(function, mTimeout);
+        if (functionLimit <= 0)
+            return 0;
+        limit = qMax(limit, functionLimit);
+    }
+    return limit;
+}
+
+void TestWatchdog::check(void)
+{
+    if (!mFunctionTimer.isValid())
+        return;
+
+    int limit = currentTimeout();
+    if ((limit <= 0) || (mFunctionTimer.elapsed() <= 1000ll * limit))
+        return;
+
+    QString function = mCurrentFunction;
+    if (function.isEmpty() && (mNextFunctions.size() == 1))
+        function = mNextFunctions.first();
+    emit timedOut(function, limit);
+
+    if (mRunControl != nullptr)
+        expire(function, limit);
+    else
+        mFunctionTimer.invalidate();
+}
+
+void TestWatchdog::expire(const QString& function, int limit)
+{
+    mCheckTimer.stop();
+
+    if (function.isEmpty())
+        mRunControl->postMessage(tr("A test function has been running for more than %1 s.").arg(limit), Utils::ErrorMessageFormat);
+    else
+        mRunControl->postMessage(tr("Test function \"%1\" has been running for more than %2 s.").arg(function).arg(limit), Utils::ErrorMessageFormat);
+
+    if (!dumpStacks())
+        stopInstance();
+}
+
+bool TestWatchdog::dumpStacks(void)
+{
+    qint64 pid = mRunControl->applicationProcessHandle().pid();
+    Utils::FilePath gdbPath = Utils::Environment::systemEnvironment().searchInPath(QLatin1String("gdb"));
+    if (mRunControl->runMode() == ProjectExplorer::Constants::DEBUG_RUN_MODE) {
+        mRunControl->postMessage(tr("The test instance is being debugged, thread stacks are not dumped."), Utils::NormalMessageFormat);
+        return false;
+    }
+    if (pid <= 0) {
+        mRunControl->postMessage(tr("Could not find out the process of the test instance, thread stacks are not dumped."), Utils::ErrorMessageFormat);
+        return false;
+    }
+    if (gdbPath.isEmpty()) {
+        mRunControl->postMessage(tr("Could not find \"gdb\" in path, thread stacks are not dumped."), Utils::ErrorMessageFormat);
+        return false;
+    }
+
+    mGdb = new Utils::Process(this);
+    mGdb->setCommand(Utils::CommandLine(gdbPath, QStringList() << QLatin1String("-batch")
+                                                               << QLatin1String("-p") << QString::number(pid)
+                                                               << QLatin1String("-ex") << QLatin1String("thread apply all bt")));
+    connect(mGdb, &Utils::Process::done,
+            this, &TestWatchdog::handleGdbDone);
+    QTimer::singleShot(std::chrono::seconds(60), mGdb, &Utils::Process::kill);
+    mGdb->start();
+    return true;
+}
+
+void TestWatchdog::handleGdbDone(void)
+{
+    if (mGdb->result() == Utils::ProcessResult::FinishedWithSuccess) {
+        mRunControl->postMessage(tr("Thread stacks of the test instance:"), Utils::NormalMessageFormat);
+        mRunControl->postMessage(mGdb->cleanedStdOut(), Utils::StdOutFormat);
+    } else {
+        // NOTE Attaching may be forbidden by the system (see /proc/sys/kernel/yama/ptrace_scope on Linux).
+        mRunControl->postMessage(tr("Could not dump thread stacks: %1").arg(mGdb->cleanedStdErr()), Utils::ErrorMessageFormat);
+    }
+
+    stopInstance();
+}
+
+void TestWatchdog::stopInstance(void)
+{
+    mRunControl->postMessage(tr("Stopping the test instance."), Utils::ErrorMessageFormat);
+    mRunControl->initiateStop();
+}
+
+} // Internal
+} // QtcDevPlugin
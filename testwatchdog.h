@@ -0,0 +1,193 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef TESTWATCHDOG_H
+#define TESTWATCHDOG_H
+
+#include <utils/outputformat.h>
+
+#include <QElapsedTimer>
+#include <QMap>
+#include <QObject>
+#include <QStringList>
+#include <QTimer>
+
+namespace ProjectExplorer {
+    class RunControl;
+}
+
+namespace Utils {
+    class Process;
+}
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The TestWatchdog class stops hung test instances
+ *
+ * This class follows the QtTest output of a test instance of Qt Creator
+ * to measure the time spent in each test function (or each data row).
+ * When a test function takes longer than its timeout, the stacks of all
+ * the threads of the test instance are dumped in the output using \c gdb
+ * and the test instance is stopped.
+ *
+ * Time is measured once QtTest starts testing (i.e. Qt Creator startup
+ * and plugin loading are not counted in the time of the first test function).
+ * The test function which is running is known once it has printed
+ * a message (e.g. with \c qDebug()). Until then, it is inferred from the declaration
+ * order of the test slots (see setTestSlots()): after a data row, the same
+ * test function or the next one may run, hence the larger of their timeouts applies.
+ * When the test function cannot be inferred, the global timeout applies.
+ * The stacks are dumped asynchronously, so that the user interface does not freeze.
+ * The watchdog deletes itself when the run control stops.
+ */
+class TestWatchdog : public QObject
+{
+    Q_OBJECT
+public:
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new watchdog for the given run control.
+     * \param runControl The run control of the test instance (also the parent of the watchdog).
+     * When it is \c nullptr, nothing is watched automatically (see handleLine() and check()).
+     * \param timeout The global timeout for each test function (in seconds, \c 0 to disable it).
+     * \param functionTimeouts The timeouts for specific test functions (in seconds).
+     * \sa parseTimeouts()
+     */
+    TestWatchdog(ProjectExplorer::RunControl* runControl, int timeout, const QMap<QString, int>& functionTimeouts);
+
+    /*!
+     * \brief Parse function timeouts
+     *
+     * Parses a comma separated list of function timeouts
+     * (e.g. <tt>testRunner=120, testOpenProject=30</tt>).
+     * \param timeouts A comma separated list of function timeouts.
+     * \return A map whose keys are test function names and values are the timeouts (in seconds).
+     */
+    static QMap<QString, int> parseTimeouts(const QString& timeouts);
+
+    /*!
+     * \brief Set the test slots
+     *
+     * Sets the test slots of the test instance, which are used to infer
+     * the test function which runs before it prints a message.
+     * \param testSlots The test slots prefixed with the name of their class (e.g. \c ModelTest::testIndex), in declaration order.
+     * \sa TestImpactAnalyzer::directoryTestSlots()
+     */
+    inline void setTestSlots(const QStringList& testSlots) {mTestSlots = testSlots;}
+    /*!
+     * \brief Handle a line of output
+     *
+     * Updates the test function which is running according to the given line of QtTest output.
+     * \param line A line of QtTest output.
+     */
+    void handleLine(const QString& line);
+    /*!
+     * \brief Current timeout
+     *
+     * Returns the timeout of the test function which is running
+     * (or the largest timeout of the test functions which may be running).
+     * \return The timeout of the running test function (in seconds, \c 0 when disabled).
+     */
+    int currentTimeout(void) const;
+signals:
+    /*!
+     * \brief Timed out
+     *
+     * This signal is emitted when the running test function has timed out.
+     * \param function The name of the test function (empty if it is unknown).
+     * \param limit The expired timeout (in seconds).
+     */
+    void timedOut(const QString& function, int limit);
+public slots:
+    /*!
+     * \brief Check timeout
+     *
+     * This slot is called periodically to check whether the running test function has timed out.
+     * When it has, timedOut() is emitted and the test instance is stopped.
+     * \sa expire()
+     */
+    void check(void);
+private slots:
+    /*!
+     * \brief Handle output
+     *
+     * This slot is called when the run control outputs a message.
+     * It updates the test function which is running.
+     * \param msg The message.
+     * \param format The format of the message.
+     */
+    void handleOutput(const QString& msg, Utils::OutputFormat format);
+private:
+    /*!
+     * \brief Next test functions
+     *
+     * Infers the test functions which may run after the given one from the declaration order of the test slots.
+     * \param function The name of the test function which has finished.
+     * \param dataRow Whether a data row of the test function has finished.
+     * \return The names of the test functions which may run next (empty if they cannot be inferred).
+     */
+    QStringList nextFunctions(const QString& function, bool dataRow) const;
+    /*!
+     * \brief Expire
+     *
+     * Dumps the stacks of the test instance (see dumpStacks()) and stops it.
+     * \param function The name of the test function (empty if it is unknown).
+     * \param limit The expired timeout (in seconds).
+     */
+    void expire(const QString& function, int limit);
+    /*!
+     * \brief Dump stacks
+     *
+     * Starts \c gdb to dump the stacks of all the threads of the test instance.
+     * \return \c true if \c gdb was started, \c false otherwise.
+     * \sa handleGdbDone()
+     */
+    bool dumpStacks(void);
+    /*!
+     * \brief Handle the end of gdb
+     *
+     * Outputs the stacks dumped by \c gdb and stops the test instance.
+     */
+    void handleGdbDone(void);
+    /*!
+     * \brief Stop the test instance
+     *
+     * Stops the test instance, once the stacks were dumped.
+     */
+    void stopInstance(void);
+
+    ProjectExplorer::RunControl* mRunControl;   /*!< The run control of the test instance */
+    int mTimeout;                               /*!< The global timeout (in seconds) */
+    QMap<QString, int> mFunctionTimeouts;       /*!< The timeouts for specific test functions (in seconds) */
+    QStringList mTestSlots;                     /*!< The test slots prefixed with the name of their class */
+    QString mCurrentClass;                      /*!< The running test class (if known) */
+    QString mCurrentFunction;                   /*!< The running test function (if known) */
+    QStringList mNextFunctions;                 /*!< The test functions which may be running (when the running one is unknown) */
+    QString mLineBuffer;                        /*!< The incomplete line of output */
+    QElapsedTimer mFunctionTimer;               /*!< Measures the time spent in the running test function */
+    QTimer mCheckTimer;                         /*!< Periodic timer for timeout checks */
+    Utils::Process* mGdb = nullptr;             /*!< Dumps the stacks of the test instance */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // TESTWATCHDOG_H
@@ -0,0 +1,176 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "testwatcher.h"
+
+#include "launchpreparation.h"
+#include "qtcdevpluginconstants.h"
+#include "qtcdevpluginlogging.h"
+
+#include <coreplugin/editormanager/editormanager.h>
+#include <coreplugin/idocument.h>
+
+#include <projectexplorer/buildconfiguration.h>
+#include <projectexplorer/buildmanager.h>
+#include <projectexplorer/project.h>
+#include <projectexplorer/projectexplorer.h>
+#include <projectexplorer/projectexplorerconstants.h>
+#include <projectexplorer/projectmanager.h>
+#include <projectexplorer/runconfiguration.h>
+#include <projectexplorer/runcontrol.h>
+
+#include <utils/aspects.h>
+
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+TestWatcher::TestWatcher(QObject* parent) :
+    QObject(parent)
+{
+    mDebounceTimer.setSingleShot(true);
+
+    connect(&mDebounceTimer, &QTimer::timeout, this, &TestWatcher::rerunPending);
+    connect(Core::EditorManager::instance(), &Core::EditorManager::saved, this, &TestWatcher::handleDocumentSaved);
+    connect(ProjectExplorer::ProjectExplorerPlugin::instance(), &ProjectExplorer::ProjectExplorerPlugin::runControlStarted, this, &TestWatcher::handleRunControlStarted);
+}
+
+/*!
+ * \brief Whether the run configuration runs tests
+ *
+ * Tells whether the run configuration with the given id runs tests
+ * (i.e. is a QtcTestRunConfiguration or a QtcTestAllRunConfiguration).
+ * \param id The id of a run configuration.
+ * \return \c true if the run configuration runs tests, \c false otherwise.
+ */
+static bool isTestRunConfiguration(Utils::Id id)
+{
+    return (id == Utils::Id(Constants::QtcTestRunConfigurationId))
+        || (id == Utils::Id(Constants::QtcTestAllRunConfigurationId));
+}
+
+void TestWatcher::handleDocumentSaved(Core::IDocument* document)
+{
+    ProjectExplorer::Project* project = ProjectExplorer::ProjectManager::projectForFile(document->filePath());
+    if ((project == nullptr) || (project->activeBuildConfiguration() == nullptr))
+        return;
+
+    ProjectExplorer::RunConfiguration* runConfig = project->activeBuildConfiguration()->activeRunConfiguration();
+    if ((runConfig == nullptr) || !isTestRunConfiguration(runConfig->id()))
+        return;
+
+    Utils::BoolAspect* watchAspect = static_cast<Utils::BoolAspect*>(runConfig->aspect(Utils::Id(Constants::WatchId)));
+    Utils::IntegerAspect* watchDelayAspect = static_cast<Utils::IntegerAspect*>(runConfig->aspect(Utils::Id(Constants::WatchDelayId)));
+    if ((watchAspect == nullptr) || !watchAspect->value())
+        return;
+
+    qCDebug(launchLog) << "Scheduling rerun of" << runConfig->displayName() << "after saving" << document->filePath();
+    if (!mPending.contains(runConfig))
+        mPending << runConfig;
+    mDebounceTimer.start(watchDelayAspect != nullptr ? watchDelayAspect->value() : 500);
+}
+
+void TestWatcher::handleRunControlStarted(ProjectExplorer::RunControl* runControl)
+{
+    if (!isTestRunConfiguration(runControl->runConfigId()))
+        return;
+    if ((runControl->project() == nullptr) || (runControl->project()->activeBuildConfiguration() == nullptr))
+        return;
+
+    for (ProjectExplorer::RunConfiguration* runConfig : runControl->project()->activeBuildConfiguration()->runConfigurations()) {
+        if ((runConfig->id() == runControl->runConfigId()) && (runConfig->buildKey() == runControl->buildKey()))
+            mRunControls.insert(runConfig, runControl);
+    }
+
+    // NOTE The keys may dangle once the run configurations are removed, hence stopped run controls are forgotten.
+    connect(runControl, &ProjectExplorer::RunControl::stopped, this, [this, runControl] () {
+        for (auto it = mRunControls.begin(); it != mRunControls.end();) {
+            if (it.value() == runControl)
+                it = mRunControls.erase(it);
+            else
+                it++;
+        }
+    });
+}
+
+bool TestWatcher::isOnlyBuilding(ProjectExplorer::Project* project)
+{
+    if (!ProjectExplorer::BuildManager::isBuilding(project))
+        return false;
+
+    for (ProjectExplorer::Project* other : ProjectExplorer::ProjectManager::projects()) {
+        if ((other != project) && ProjectExplorer::BuildManager::isBuilding(other))
+            return false;
+    }
+    return true;
+}
+
+void TestWatcher::rerunPending(void)
+{
+    QList<QPointer<ProjectExplorer::RunConfiguration>> pending = mPending;
+    mPending.clear();
+
+    for (QPointer<ProjectExplorer::RunConfiguration> runConfig : pending)
+        rerun(runConfig);
+}
+
+void TestWatcher::rerun(QPointer<ProjectExplorer::RunConfiguration> runConfig)
+{
+    if (runConfig.isNull())
+        return;
+
+    // A new save arrived in the meantime: This rerun is stale.
+    if (mPending.contains(runConfig))
+        return;
+
+    ProjectExplorer::Project* project = runConfig->project();
+    if (ProjectExplorer::BuildManager::isBuilding(project)) {
+        auto connection = std::make_shared<QMetaObject::Connection>();
+        *connection = connect(ProjectExplorer::BuildManager::instance(), &ProjectExplorer::BuildManager::buildStateChanged, this, [this, runConfig, connection] (ProjectExplorer::Project* project) {
+            if (!runConfig.isNull() && ((project != runConfig->project()) || ProjectExplorer::BuildManager::isBuilding(project)))
+                return;
+            disconnect(*connection);
+            rerun(runConfig);
+        });
+
+        // NOTE BuildManager::cancel() cancels the whole build queue, hence the builds of other projects are waited for.
+        if (isOnlyBuilding(project)) {
+            qCDebug(launchLog) << "Cancelling stale build for" << runConfig->displayName();
+            ProjectExplorer::BuildManager::cancel();
+        } else {
+            qCDebug(launchLog) << "Waiting for the build of" << runConfig->displayName() << "to finish";
+        }
+        return;
+    }
+
+    QPointer<ProjectExplorer::RunControl> runControl = mRunControls.value(runConfig);
+    if (!runControl.isNull() && !runControl->isStopped()) {
+        qCDebug(launchLog) << "Stopping stale run for" << runConfig->displayName();
+        connect(runControl, &ProjectExplorer::RunControl::stopped, this, [this, runConfig] () {
+            rerun(runConfig);
+        }, Qt::SingleShotConnection);
+        runControl->initiateStop();
+        return;
+    }
+
+    ProjectExplorer::ProjectExplorerPlugin::runRunConfiguration(runConfig, ProjectExplorer::Constants::NORMAL_RUN_MODE);
+    LaunchPreparation::prepareRun(runConfig);
+}
+
+} // Internal
+} // QtcDevPlugin
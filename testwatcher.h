@@ -0,0 +1,126 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef TESTWATCHER_H
+#define TESTWATCHER_H
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+
+namespace Core {
+    class IDocument;
+}
+
+namespace ProjectExplorer {
+    class Project;
+    class RunConfiguration;
+    class RunControl;
+}
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The TestWatcher class reruns plugin tests when sources are saved
+ *
+ * This class implements the watch mode of QtcTestRunConfiguration.
+ * When a file of a project whose active run configuration is a QtcTestRunConfiguration
+ * with watch mode enabled is saved, the run configuration is run again
+ * (which triggers the build and deploy steps as configured in Qt Creator).
+ *
+ * Saves are coalesced: the run is started only when no file was saved during
+ * the delay configured in the run configuration. A new run cancels the stale one,
+ * either by cancelling the build (only when no other project is being built)
+ * or by stopping the running test instance.
+ */
+class TestWatcher : public QObject
+{
+    Q_OBJECT
+public:
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new test watcher.
+     * \param parent The parent object.
+     */
+    TestWatcher(QObject* parent = nullptr);
+
+    /*!
+     * \brief The last run control
+     *
+     * Returns the last run control started for the given run configuration.
+     * \param runConfig A watched run configuration.
+     * \return The last run control of the run configuration, or \c nullptr if it is stopped.
+     */
+    inline ProjectExplorer::RunControl* runControl(ProjectExplorer::RunConfiguration* runConfig) const {return mRunControls.value(runConfig);}
+    /*!
+     * \brief Whether only the project is being built
+     *
+     * Tells whether the given project is being built and no other project is.
+     * \param project A project.
+     * \return \c true if only the given project is being built, \c false otherwise.
+     */
+    static bool isOnlyBuilding(ProjectExplorer::Project* project);
+private slots:
+    /*!
+     * \brief Handle saved documents
+     *
+     * This slot is called when a document is saved.
+     * If the active run configuration of the project containing the document
+     * is in watch mode, a rerun is scheduled.
+     * \param document The saved document.
+     */
+    void handleDocumentSaved(Core::IDocument* document);
+    /*!
+     * \brief Handle started run controls
+     *
+     * This slot is called when a run control is started.
+     * It keeps track of the run controls associated with watched run configurations.
+     * \param runControl The started run control.
+     */
+    void handleRunControlStarted(ProjectExplorer::RunControl* runControl);
+    /*!
+     * \brief Rerun scheduled run configurations
+     *
+     * This slot is called when the debounce delay has expired.
+     * It reruns all the run configurations for which a rerun has been scheduled.
+     * \sa rerun()
+     */
+    void rerunPending(void);
+private:
+    /*!
+     * \brief Rerun a run configuration
+     *
+     * Reruns the given run configuration, after cancelling
+     * the running build and stopping the running test instance.
+     * \param runConfig A run configuration.
+     */
+    void rerun(QPointer<ProjectExplorer::RunConfiguration> runConfig);
+
+    QTimer mDebounceTimer;                                                                          /*!< The timer coalescing saves */
+    QList<QPointer<ProjectExplorer::RunConfiguration>> mPending;                                     /*!< The run configurations to rerun */
+    QHash<ProjectExplorer::RunConfiguration*, QPointer<ProjectExplorer::RunControl>> mRunControls;  /*!< The last run controls of the watched run configurations */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // TESTWATCHER_H
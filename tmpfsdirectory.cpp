@@ -0,0 +1,75 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "tmpfsdirectory.h"
+#include "qtcdevpluginlogging.h"
+
+#include <utils/hostosinfo.h>
+
+#include <QtCore>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+TmpfsDirectory::TmpfsDirectory(int sizeLimit, const QString& rootPath) :
+    mRootPath(rootPath), mSizeLimit((qint64) sizeLimit * 1024 * 1024)
+{
+}
+
+Utils::Result<> TmpfsDirectory::create(void)
+{
+    QStorageInfo storage(mRootPath);
+    if (!storage.isValid() || !storage.isReady())
+        return Utils::ResultError(tr("\"%1\" is not available.").arg(mRootPath));
+    if (storage.bytesAvailable() < mSizeLimit)
+        return Utils::ResultError(tr("\"%1\" only has %2 MiB available, less than the size limit (%3 MiB).")
+                                      .arg(mRootPath)
+                                      .arg(storage.bytesAvailable() / (1024 * 1024))
+                                      .arg(mSizeLimit / (1024 * 1024)));
+
+    mDir = std::make_unique<QTemporaryDir>(QDir(mRootPath).filePath(QLatin1String("qtcdevplugin-XXXXXX")));
+    if (!mDir->isValid())
+        return Utils::ResultError(tr("Could not create a directory in \"%1\": %2").arg(mRootPath).arg(mDir->errorString()));
+
+    QDir dir(mDir->path());
+    if (!dir.mkpath(QLatin1String("settings")) || !dir.mkpath(QLatin1String("cache")))
+        return Utils::ResultError(tr("Could not create settings and cache directories in \"%1\".").arg(mDir->path()));
+
+    qCDebug(launchLog) << "Ephemeral directory created:" << mDir->path() << "limit:" << mSizeLimit;
+    return Utils::ResultOk;
+}
+
+qint64 TmpfsDirectory::usage(const QString& path)
+{
+    qint64 size = 0;
+    QDirIterator it(path, QDir::Files | QDir::Hidden | QDir::System | QDir::NoSymLinks, QDirIterator::Subdirectories);
+    while (it.hasNext())
+        size += it.nextFileInfo().size();
+    return size;
+}
+
+bool TmpfsDirectory::isAvailable(void)
+{
+    if (!Utils::HostOsInfo::isLinuxHost())
+        return false;
+    QStorageInfo storage(QLatin1String("/dev/shm"));
+    return storage.isValid() && (storage.rootPath() == QLatin1String("/dev/shm")) && (storage.fileSystemType() == "tmpfs");
+}
+
+} // Internal
+} // QtcDevPlugin
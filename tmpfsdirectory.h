@@ -0,0 +1,136 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef TMPFSDIRECTORY_H
+#define TMPFSDIRECTORY_H
+
+#include <utils/result.h>
+
+#include <QCoreApplication>
+#include <QTemporaryDir>
+
+#include <memory>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The TmpfsDirectory class manages an ephemeral directory in memory for a run
+ *
+ * This class creates a temporary directory in \c /dev/shm (which is a \c tmpfs on Linux),
+ * containing a \c settings directory (to be passed to Qt Creator with \c -settingspath)
+ * and a \c cache directory (to be used as \c XDG_CACHE_HOME), so that the settings,
+ * sessions and caches written by a test instance do not hit persistent storage.
+ *
+ * Since mounting a dedicated \c tmpfs requires privileges, the size of the directory
+ * is capped by checking that \c /dev/shm has room for it when it is created
+ * and by comparing its usage() to the limit while the instance runs.
+ *
+ * The directory and its contents are removed when the instance is destroyed.
+ */
+class TmpfsDirectory
+{
+    Q_DECLARE_TR_FUNCTIONS(QtcDevPlugin::Internal::TmpfsDirectory)
+public:
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new instance. The directory is only created by create().
+     * \param sizeLimit The maximum size of the directory contents (in mebibytes).
+     * \param rootPath The directory where the directory is created (\c /dev/shm by default).
+     */
+    TmpfsDirectory(int sizeLimit, const QString& rootPath = QLatin1String("/dev/shm"));
+
+    /*!
+     * \brief Create the directory
+     *
+     * Creates the directory and its \c settings and \c cache sub-directories.
+     * \return \c ResultOk if the directory was created, an error otherwise
+     * (e.g. if the file system does not have room for the size limit).
+     */
+    Utils::Result<> create(void);
+    /*!
+     * \brief Remove the directory
+     *
+     * Removes the directory and its contents.
+     */
+    inline void remove(void) {if (mDir) mDir->remove();}
+
+    /*!
+     * \brief Directory path
+     * \return The path to the directory (empty before create()).
+     */
+    inline QString path(void) const {return mDir ? mDir->path() : QString();}
+    /*!
+     * \brief Settings path
+     * \return The path to the settings directory (empty before create()).
+     */
+    inline QString settingsPath(void) const {return mDir ? mDir->filePath(QLatin1String("settings")) : QString();}
+    /*!
+     * \brief Cache path
+     * \return The path to the cache directory (empty before create()).
+     */
+    inline QString cachePath(void) const {return mDir ? mDir->filePath(QLatin1String("cache")) : QString();}
+    /*!
+     * \brief Size limit
+     * \return The maximum size of the directory contents (in bytes).
+     */
+    inline qint64 sizeLimit(void) const {return mSizeLimit;}
+    /*!
+     * \brief Directory usage
+     *
+     * Computes the size of the files in the directory.
+     * \return The size of the directory contents (in bytes).
+     * \sa usage(const QString&)
+     */
+    inline qint64 usage(void) const {return mDir ? usage(mDir->path()) : 0;}
+    /*!
+     * \brief Whether the size limit is exceeded
+     * \return \c true if the usage() exceeds the size limit, \c false otherwise.
+     */
+    inline bool isOverLimit(void) const {return usage() > mSizeLimit;}
+
+    /*!
+     * \brief Whether \c /dev/shm is available
+     *
+     * Tells whether \c /dev/shm is a \c tmpfs on this host.
+     * \return \c true if \c /dev/shm is available, \c false otherwise.
+     */
+    static bool isAvailable(void);
+    /*!
+     * \brief Directory usage
+     *
+     * Computes the size of the files in the given directory.
+     * \note This function walks the whole directory, hence it should not run in the main thread.
+     * \param path The path to the directory.
+     * \return The size of the directory contents (in bytes).
+     */
+    static qint64 usage(const QString& path);
+
+    static const int DefaultSizeLimit = 512;    /*!< The default size limit (in mebibytes) */
+    static const int UsageCheckInterval = 5000; /*!< The interval between the checks of the usage while the instance runs (in milliseconds) */
+private:
+    QString mRootPath;                          /*!< The directory where the directory is created */
+    qint64 mSizeLimit;                          /*!< The maximum size of the directory contents (in bytes) */
+    std::unique_ptr<QTemporaryDir> mDir;        /*!< The directory */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // TMPFSDIRECTORY_H
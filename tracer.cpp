@@ -0,0 +1,156 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "tracer.h"
+#include "qtcdevpluginlogging.h"
+
+#include <utils/filepath.h>
+
+#include <QtCore>
+
+#include <algorithm>
+#include <atomic>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief Tracer state
+ *
+ * The state of the tracer, shared by all threads.
+ */
+struct TracerState {
+    TracerState(void) : filePath(qEnvironmentVariable("QTCDEVPLUGIN_TRACE")), enabled(!filePath.isEmpty()) {clock.start();}
+
+    QString filePath;               /*!< The path of the trace file (empty when tracing is disabled) */
+    std::atomic<bool> enabled;      /*!< Whether tracing is enabled (i.e. the path of the trace file is not empty) */
+    QElapsedTimer clock;            /*!< The clock of the trace */
+    QMutex mutex;                   /*!< Protects the path of the trace file and the events */
+    QJsonArray events;              /*!< The recorded trace events */
+};
+
+/*!
+ * \brief The tracer state
+ *
+ * Returns the tracer state (initialized on first call).
+ * \return The tracer state.
+ */
+static TracerState& state(void)
+{
+    static TracerState tracerState;
+    return tracerState;
+}
+
+bool Tracer::isEnabled(void)
+{
+    return state().enabled;
+}
+
+qint64 Tracer::timestamp(void)
+{
+    return state().clock.nsecsElapsed() / 1000;
+}
+
+void Tracer::record(const char* category, const QString& name, qint64 begin, qint64 end, const QJsonObject& args)
+{
+    if (!isEnabled())
+        return;
+
+    QJsonObject event;
+    event.insert(QLatin1String("name"), name);
+    event.insert(QLatin1String("cat"), QLatin1String(category));
+    event.insert(QLatin1String("ph"), QLatin1String("X"));
+    event.insert(QLatin1String("ts"), begin);
+    event.insert(QLatin1String("dur"), end - begin);
+    event.insert(QLatin1String("pid"), QCoreApplication::applicationPid());
+    event.insert(QLatin1String("tid"), static_cast<qint64>(reinterpret_cast<quintptr>(QThread::currentThreadId())));
+    if (!args.isEmpty())
+        event.insert(QLatin1String("args"), args);
+
+    QMutexLocker locker(&state().mutex);
+    state().events.append(event);
+}
+
+bool Tracer::save(void)
+{
+    if (!isEnabled())
+        return true;
+
+    QString filePath;
+    QList<QJsonObject> events;
+    {
+        QMutexLocker locker(&state().mutex);
+        filePath = state().filePath;
+        for (QJsonValue event : std::as_const(state().events))
+            events << event.toObject();
+    }
+
+    // NOTE Spans are recorded when they end, hence nested spans are recorded before the enclosing ones.
+    std::stable_sort(events.begin(), events.end(), [] (const QJsonObject& e1, const QJsonObject& e2) {
+        if (e1.value(QLatin1String("ts")).toInteger() != e2.value(QLatin1String("ts")).toInteger())
+            return e1.value(QLatin1String("ts")).toInteger() < e2.value(QLatin1String("ts")).toInteger();
+        return e1.value(QLatin1String("dur")).toInteger() > e2.value(QLatin1String("dur")).toInteger();
+    });
+
+    QJsonArray traceEvents;
+    for (QJsonObject event : events)
+        traceEvents.append(event);
+    QJsonObject trace;
+    trace.insert(QLatin1String("traceEvents"), traceEvents);
+    trace.insert(QLatin1String("displayTimeUnit"), QLatin1String("ms"));
+
+    Utils::Result<qint64> result = Utils::FilePath::fromUserInput(filePath).writeFileContents(QJsonDocument(trace).toJson(QJsonDocument::Compact));
+    if (!result) {
+        qCWarning(pluginLog) << "Could not save trace:" << result.error();
+        return false;
+    }
+    return true;
+}
+
+void Tracer::start(const QString& filePath)
+{
+    QMutexLocker locker(&state().mutex);
+    state().filePath = filePath;
+    state().events = QJsonArray();
+    state().enabled = !filePath.isEmpty();
+}
+
+TraceSpan::TraceSpan(const char* category, const QString& name) :
+    mCategory(category), mBegin(-1)
+{
+    if (!Tracer::isEnabled())
+        return;
+
+    mName = name;
+    mBegin = Tracer::timestamp();
+}
+
+TraceSpan::~TraceSpan(void)
+{
+    if (mBegin >= 0)
+        Tracer::record(mCategory, mName, mBegin, Tracer::timestamp(), mArgs);
+}
+
+void TraceSpan::setArgument(const QString& key, const QJsonValue& value)
+{
+    if (mBegin >= 0)
+        mArgs.insert(key, value);
+}
+
+} // Internal
+} // QtcDevPlugin
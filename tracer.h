@@ -0,0 +1,134 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <QJsonObject>
+#include <QString>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The Tracer class records timed spans in Chrome trace event format
+ *
+ * Tracing is enabled when the environment variable \c QTCDEVPLUGIN_TRACE
+ * contains the path of a file. The spans recorded while Qt Creator runs
+ * (see TraceSpan and record()) are then written to this file when the plugin shuts down
+ * (or when save() is called), as a JSON trace which can be loaded in
+ * Perfetto (https://ui.perfetto.dev) or \c chrome://tracing.
+ *
+ * When tracing is disabled, recording spans costs a single test.
+ *
+ * \sa TraceSpan
+ */
+class Tracer
+{
+public:
+    /*!
+     * \brief Whether tracing is enabled
+     *
+     * Tells whether the environment variable \c QTCDEVPLUGIN_TRACE is set.
+     * \return \c true if tracing is enabled, \c false otherwise.
+     */
+    static bool isEnabled(void);
+    /*!
+     * \brief Current timestamp
+     *
+     * Returns the current timestamp of the trace.
+     * \return The number of microseconds since tracing started.
+     */
+    static qint64 timestamp(void);
+    /*!
+     * \brief Record a span
+     *
+     * Records a complete span in the trace (if tracing is enabled).
+     * This function can be called from any thread.
+     * \param category The category of the span (e.g. \c "discovery", \c "launch").
+     * \param name The name of the span.
+     * \param begin The timestamp of the beginning of the span (see timestamp()).
+     * \param end The timestamp of the end of the span (see timestamp()).
+     * \param args Additional information shown with the span.
+     */
+    static void record(const char* category, const QString& name, qint64 begin, qint64 end, const QJsonObject& args = QJsonObject());
+    /*!
+     * \brief Save the trace
+     *
+     * Writes the spans recorded so far to the trace file (if tracing is enabled),
+     * ordered by their beginning, so that enclosing spans come before nested ones.
+     * \return \c true if the trace file could be written (or tracing is disabled), \c false otherwise.
+     */
+    static bool save(void);
+    /*!
+     * \brief Start a new trace
+     *
+     * Discards the spans recorded so far and writes the next ones to the given file
+     * (e.g. in tests, where \c QTCDEVPLUGIN_TRACE is not set).
+     * \param filePath The path of the trace file (empty to disable tracing).
+     */
+    static void start(const QString& filePath);
+};
+
+/*!
+ * \brief The TraceSpan class records a span for the lifetime of the instance
+ *
+ * The span begins when the instance is constructed and ends
+ * when it is destroyed (usually at the end of the current scope).
+ *
+ * \sa Tracer
+ */
+class TraceSpan
+{
+public:
+    /*!
+     * \brief Constructor
+     *
+     * Begins a new span.
+     * \param category The category of the span.
+     * \param name The name of the span.
+     */
+    TraceSpan(const char* category, const QString& name);
+    /*!
+     * \brief Destructor
+     *
+     * Ends the span and records it in the trace.
+     */
+    ~TraceSpan(void);
+
+    /*!
+     * \brief Add an argument
+     *
+     * Adds additional information to the span (if tracing is enabled).
+     * \param key The name of the argument.
+     * \param value The value of the argument.
+     */
+    void setArgument(const QString& key, const QJsonValue& value);
+private:
+    Q_DISABLE_COPY(TraceSpan)
+
+    const char* mCategory;  /*!< The category of the span */
+    QString mName;          /*!< The name of the span */
+    qint64 mBegin;          /*!< The timestamp of the beginning of the span (or \c -1 if tracing is disabled) */
+    QJsonObject mArgs;      /*!< Additional information shown with the span */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // TRACER_H
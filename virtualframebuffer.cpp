@@ -0,0 +1,127 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "virtualframebuffer.h"
+#include "qtcdevpluginlogging.h"
+
+#include <utils/environment.h>
+#include <utils/filepath.h>
+
+#include <QtCore>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+VirtualFramebuffer::VirtualFramebuffer(QObject* parent) :
+    QObject(parent), mDisplayNumber(-1)
+{
+    mTimer.setSingleShot(true);
+    connect(&mTimer, &QTimer::timeout, this, [this] () {
+        fail(tr("Xvfb did not accept connections in time."));
+    });
+    connect(&mProcess, &Utils::Process::readyReadStandardOutput, this, &VirtualFramebuffer::handleOutput);
+    connect(&mProcess, &Utils::Process::done, this, [this] () {
+        if (!isStarted() && mTimer.isActive())
+            fail(tr("Xvfb exited with code %1: %2").arg(mProcess.exitCode()).arg(mProcess.readAllStandardError().trimmed()));
+    });
+}
+
+bool VirtualFramebuffer::isAvailable(void)
+{
+    return !Utils::Environment::systemEnvironment().searchInPath(QLatin1String("Xvfb")).isEmpty();
+}
+
+int VirtualFramebuffer::parseDisplayNumber(const QByteArray& output)
+{
+    // NOTE Xvfb writes the display number followed by a new line once it accepts connections.
+    int end = output.indexOf('\n');
+    if (end < 0)
+        return -1;
+
+    bool ok = false;
+    int displayNumber = output.left(end).trimmed().toInt(&ok);
+    return (ok && (displayNumber >= 0)) ? displayNumber : -1;
+}
+
+void VirtualFramebuffer::start(std::chrono::milliseconds timeout)
+{
+    Utils::FilePath xvfbPath = Utils::Environment::systemEnvironment().searchInPath(QLatin1String("Xvfb"));
+    if (xvfbPath.isEmpty()) {
+        fail(tr("Could not find \"Xvfb\" in path."));
+        return;
+    }
+
+    mDisplayNumber = -1;
+    mOutput.clear();
+    mErrorString.clear();
+    // NOTE With -displayfd, Xvfb picks a free display itself and writes it to the given file descriptor (here its standard output).
+    mProcess.setCommand(Utils::CommandLine(xvfbPath, QStringList() << QLatin1String("-displayfd") << QLatin1String("1")
+                                                                   << QLatin1String("-screen") << QLatin1String("0") << QLatin1String("1920x1080x24")
+                                                                   << QLatin1String("-nolisten") << QLatin1String("tcp")));
+    mTimer.start(timeout);
+    mProcess.start();
+}
+
+bool VirtualFramebuffer::waitForStarted(std::chrono::milliseconds timeout)
+{
+    QDeadlineTimer deadline(timeout);
+    while (!isStarted() && mProcess.isRunning() && !deadline.hasExpired())
+        mProcess.waitForReadyRead(deadline);
+
+    if (!isStarted() && mErrorString.isEmpty())
+        fail(tr("Xvfb did not accept connections in time."));
+    return isStarted();
+}
+
+void VirtualFramebuffer::stop(void)
+{
+    mTimer.stop();
+    if (!mProcess.isRunning())
+        return;
+
+    mProcess.terminate();
+    if (!mProcess.waitForFinished(std::chrono::seconds(2)))
+        mProcess.kill();
+}
+
+void VirtualFramebuffer::handleOutput(void)
+{
+    mOutput.append(mProcess.readAllRawStandardOutput());
+    if (isStarted())
+        return;
+
+    int displayNumber = parseDisplayNumber(mOutput);
+    if (displayNumber < 0)
+        return;
+
+    mTimer.stop();
+    mDisplayNumber = displayNumber;
+    qCDebug(launchLog) << "Xvfb started on display" << display();
+    emit started(display());
+}
+
+void VirtualFramebuffer::fail(const QString& error)
+{
+    qCWarning(launchLog) << "Could not start Xvfb:" << error;
+    mErrorString = error;
+    stop();
+    emit failed(error);
+}
+
+} // Internal
+} // QtcDevPlugin
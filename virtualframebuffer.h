@@ -0,0 +1,171 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef VIRTUALFRAMEBUFFER_H
+#define VIRTUALFRAMEBUFFER_H
+
+#include <utils/qtcprocess.h>
+
+#include <QObject>
+#include <QTimer>
+
+#include <chrono>
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The VirtualFramebuffer class manages a private \c Xvfb instance
+ *
+ * This class allows to start a private X server (\c Xvfb) for a test instance of Qt Creator,
+ * so that tests which really need a display do not open windows on the user desktop
+ * and can run concurrently.
+ *
+ * The display number is chosen by \c Xvfb itself (with \c -displayfd), which writes it
+ * once it accepts connections, so that concurrent runs never pick the same display.
+ * The server is started asynchronously (see start() and started()).
+ * The server is stopped when the instance is destroyed.
+ */
+class VirtualFramebuffer : public QObject
+{
+    Q_OBJECT
+public:
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new virtual frame buffer. The server is not started.
+     * \param parent The parent object.
+     * \sa start()
+     */
+    VirtualFramebuffer(QObject* parent = nullptr);
+    /*!
+     * \brief Destructor
+     *
+     * Stops the server if it is running.
+     * \sa stop()
+     */
+    inline ~VirtualFramebuffer(void) {stop();}
+
+    /*!
+     * \brief The display
+     *
+     * Returns the X display name of this virtual frame buffer (e.g. <tt>:99</tt>),
+     * which should be set as \c DISPLAY in the environment of the client.
+     * \return The X display name of this virtual frame buffer (empty until the server is started).
+     * \sa isStarted()
+     */
+    inline QString display(void) const {return isStarted() ? QString(QLatin1String(":%1")).arg(mDisplayNumber) : QString();}
+    /*!
+     * \brief Whether the server is started
+     *
+     * Tells whether the server accepts connections.
+     * \return \c true if the server accepts connections, \c false otherwise.
+     */
+    inline bool isStarted(void) const {return mDisplayNumber >= 0;}
+    /*!
+     * \brief The error string
+     *
+     * Describes why the server could not be started.
+     * \return A description of the last error.
+     * \sa failed()
+     */
+    inline QString errorString(void) const {return mErrorString;}
+
+    /*!
+     * \brief Whether Xvfb is available
+     *
+     * Tells whether \c Xvfb can be found in the path.
+     * \return \c true if \c Xvfb is available, \c false otherwise.
+     */
+    static bool isAvailable(void);
+    /*!
+     * \brief Parse the display number
+     *
+     * Parses the display number written by \c Xvfb with \c -displayfd.
+     * \param output The output of \c Xvfb.
+     * \return The display number, or \c -1 if the output does not contain a complete display number.
+     */
+    static int parseDisplayNumber(const QByteArray& output);
+
+    /*!
+     * \brief Start the server
+     *
+     * Starts \c Xvfb. Either started() or failed() is emitted
+     * when the server accepts connections or when it fails to start.
+     * \param timeout The time given to the server to accept connections.
+     * \sa stop(), waitForStarted()
+     */
+    void start(std::chrono::milliseconds timeout = std::chrono::seconds(5));
+    /*!
+     * \brief Wait for the server
+     *
+     * Blocks until the server started with start() accepts connections or fails to start.
+     * \note This function should only be used when the display must be known synchronously
+     * (e.g. before the debugger receipe is created).
+     * \param timeout The maximum time to wait.
+     * \return \c true if the server accepts connections, \c false otherwise.
+     */
+    bool waitForStarted(std::chrono::milliseconds timeout = std::chrono::seconds(5));
+    /*!
+     * \brief Stop the server
+     *
+     * Stops \c Xvfb if it is running.
+     * \sa start()
+     */
+    void stop(void);
+signals:
+    /*!
+     * \brief Server started
+     *
+     * This signal is emitted when the server accepts connections.
+     * \param display The X display name of this virtual frame buffer.
+     */
+    void started(const QString& display);
+    /*!
+     * \brief Server failed to start
+     *
+     * This signal is emitted when the server could not be started.
+     * \param error A description of the error.
+     */
+    void failed(const QString& error);
+private:
+    /*!
+     * \brief Handle Xvfb output
+     *
+     * Reads the display number written by \c Xvfb and emits started() once it is complete.
+     */
+    void handleOutput(void);
+    /*!
+     * \brief Fail
+     *
+     * Stops the server and emits failed().
+     * \param error A description of the error.
+     */
+    void fail(const QString& error);
+
+    int mDisplayNumber;         /*!< The display number of the virtual frame buffer (\c -1 until the server is started) */
+    QByteArray mOutput;         /*!< The output of the Xvfb process (i.e. the display number) */
+    QString mErrorString;       /*!< The description of the last error */
+    QTimer mTimer;              /*!< The timer limiting the time given to the server to start */
+    Utils::Process mProcess;    /*!< The Xvfb process */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // VIRTUALFRAMEBUFFER_H
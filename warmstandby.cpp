@@ -0,0 +1,255 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "warmstandby.h"
+
+#include "qtcdevpluginconstants.h"
+#include "qtcdevpluginlogging.h"
+#include "qtcrunconfiguration.h"
+#include "qtcrunworkerfactory.h"
+
+#include <solutions/tasking/barrier.h>
+
+#include <utils/hostosinfo.h>
+#include <utils/outputformat.h>
+#include <utils/qtcprocess.h>
+
+#include <QtCore>
+
+#ifdef Q_OS_UNIX
+#   include <signal.h>
+#endif
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+WarmStandby* WarmStandby::sInstance = nullptr;
+
+WarmStandby::WarmStandby(QObject* parent) :
+    QObject(parent)
+{
+    sInstance = this;
+}
+
+WarmStandby::~WarmStandby(void)
+{
+    discard();
+    if (sInstance == this)
+        sInstance = nullptr;
+}
+
+void WarmStandby::start(const Launch& launch)
+{
+    if ((sInstance == nullptr) || !isAvailable())
+        return;
+
+    sInstance->discard();
+    if (launch.pluginFiles.isEmpty())
+        return;
+
+    Utils::FilePath probeSearchPath = QtcRunConfiguration::probePath();
+    if (probeSearchPath.isEmpty()) {
+        qCWarning(launchLog) << "Probe plugin is not installed. No standby instance";
+        return;
+    }
+
+    Utils::CommandLine command = launch.command;
+    command.addArgs(QStringList() << QLatin1String("-pluginpath") << probeSearchPath.nativePath()
+                                  << QLatin1String("-load") << Constants::ProbePluginName);
+    Utils::Environment env = launch.environment;
+    env.set(QLatin1String(Constants::ProbeStandbyVariable), QLatin1String("1"));
+
+    start(launch, command, env);
+}
+
+void WarmStandby::start(const Launch& launch, const Utils::CommandLine& command, const Utils::Environment& environment)
+{
+    if (sInstance == nullptr)
+        return;
+
+    sInstance->discard();
+    sInstance->mLaunch = launch;
+    sInstance->mFingerprint = fingerprint(launch.pluginFiles + launch.builtFiles);
+    sInstance->mProcess = std::make_shared<Utils::Process>();
+    sInstance->mProcess->setCommand(command);
+    sInstance->mProcess->setWorkingDirectory(launch.workingDirectory);
+    sInstance->mProcess->setEnvironment(environment);
+    sInstance->mProcess->setProcessChannelMode(QProcess::MergedChannels);
+    connect(sInstance->mProcess.get(), &Utils::Process::readyReadStandardOutput,
+            sInstance, &WarmStandby::handleOutput);
+    // NOTE Queued, since the process cannot be deleted while it emits done().
+    Utils::Process* process = sInstance->mProcess.get();
+    connect(process, &Utils::Process::done, sInstance, [process] () {
+        if ((sInstance != nullptr) && (sInstance->mProcess.get() == process)) {
+            qCDebug(launchLog) << "Standby instance exited:" << process->exitCode();
+            sInstance->discard();
+        }
+    }, Qt::QueuedConnection);
+
+    qCDebug(launchLog) << "Starting standby instance:" << command.toUserOutput();
+    QtcRunWorkerFactory::movePluginFiles(launch.pluginFiles, QString(), QLatin1String(".del"));
+    sInstance->mShadowed = true;
+    sInstance->mProcess->start();
+}
+
+std::shared_ptr<Utils::Process> WarmStandby::take(const Launch& launch, QByteArray* output)
+{
+    if ((sInstance == nullptr) || !sInstance->mProcess)
+        return nullptr;
+
+    if (!sInstance->mReady) {
+        qCDebug(launchLog) << "Standby instance is not ready. Discarding it";
+        sInstance->discard();
+        return nullptr;
+    }
+    if ((launch.command.toUserOutput() != sInstance->mLaunch.command.toUserOutput())
+        || (launch.environment != sInstance->mLaunch.environment)
+        || (launch.workingDirectory != sInstance->mLaunch.workingDirectory)
+        || (launch.pluginFiles != sInstance->mLaunch.pluginFiles)
+        || (launch.builtFiles != sInstance->mLaunch.builtFiles)) {
+        qCDebug(launchLog) << "Standby instance does not match the launch. Discarding it";
+        sInstance->discard();
+        return nullptr;
+    }
+    if (fingerprint(launch.pluginFiles + launch.builtFiles) != sInstance->mFingerprint) {
+        qCDebug(launchLog) << "Plugins were rebuilt since the standby instance was started. Discarding it";
+        sInstance->discard();
+        return nullptr;
+    }
+
+    std::shared_ptr<Utils::Process> process = sInstance->mProcess;
+    process->disconnect(sInstance);
+    *output = sInstance->mOutput;
+    sInstance->mProcess.reset();
+    sInstance->mOutput.clear();
+    sInstance->mReady = false;
+    return process;
+}
+
+Tasking::Group WarmStandby::receipe(ProjectExplorer::RunControl* runControl, std::shared_ptr<Utils::Process> process, const QByteArray& output)
+{
+    const auto onSetup = [runControl, process, output] (Tasking::Barrier& barrier) {
+        connect(process.get(), &Utils::Process::readyReadStandardOutput, &barrier, [runControl, process] () {
+            runControl->appendMessage(QString::fromLocal8Bit(process->readAllRawStandardOutput()), Utils::StdOutFormat);
+        });
+        connect(process.get(), &Utils::Process::done, &barrier, [runControl, process, &barrier] () {
+            bool success = (process->exitStatus() == QProcess::NormalExit) && (process->exitCode() == 0);
+            runControl->postMessage(tr("Qt Creator exited with code %1.").arg(process->exitCode()),
+                                    success ? Utils::NormalMessageFormat : Utils::ErrorMessageFormat);
+            barrier.stopWithResult(success ? Tasking::DoneResult::Success : Tasking::DoneResult::Error);
+        });
+
+        runControl->postMessage(tr("Resuming standby Qt Creator instance."), Utils::NormalMessageFormat);
+        runControl->setApplicationProcessHandle(Utils::ProcessHandle(process->processId()));
+        if (!output.isEmpty())
+            runControl->appendMessage(QString::fromLocal8Bit(output), Utils::StdOutFormat);
+#ifdef Q_OS_UNIX
+        ::kill(process->processId(), SIGCONT);
+#endif
+    };
+
+    return Tasking::Group {
+        Tasking::BarrierTask(onSetup),
+        Tasking::onGroupDone([process] (Tasking::DoneWith result) {
+            if (result == Tasking::DoneWith::Cancel)
+                process->stop();
+        })
+    };
+}
+
+QByteArray WarmStandby::fingerprint(const QList<Utils::FilePath>& files)
+{
+    QByteArray ans;
+    for (Utils::FilePath file : files) {
+        QFileInfo info(file.toFSPathString());
+        ans += file.toFSPathString().toUtf8() + ':'
+             + QByteArray::number(info.size()) + ':'
+             + QByteArray::number(info.lastModified().toMSecsSinceEpoch()) + '\n';
+    }
+    return ans;
+}
+
+bool WarmStandby::isReady(void)
+{
+    return (sInstance != nullptr) && sInstance->mProcess && sInstance->mReady;
+}
+
+QList<Utils::FilePath> WarmStandby::builtFiles(const QStringList& arguments, const QList<Utils::FilePath>& pluginFiles)
+{
+    QList<Utils::FilePath> files;
+
+    for (int a = 0; a + 1 < arguments.size(); a++) {
+        if (arguments.at(a) != QLatin1String("-pluginpath"))
+            continue;
+        Utils::FilePath pluginSearchPath = Utils::FilePath::fromUserInput(arguments.at(a + 1));
+        for (Utils::FilePath pluginFile : pluginFiles) {
+            Utils::FilePath builtFile = pluginSearchPath.pathAppended(pluginFile.fileName());
+            if (builtFile.isFile() && !files.contains(builtFile))
+                files << builtFile;
+        }
+    }
+
+    return files;
+}
+
+bool WarmStandby::isAvailable(void)
+{
+    // NOTE Windows has no equivalent of SIGSTOP and SIGCONT.
+    return !Utils::HostOsInfo::isWindowsHost();
+}
+
+void WarmStandby::handleOutput(void)
+{
+    mOutput += mProcess->readAllRawStandardOutput();
+    if (mReady)
+        return;
+
+    QByteArray marker = QByteArray(Constants::ProbeStandbyMarker) + '\n';
+    int index = mOutput.indexOf(marker);
+    if (index < 0)
+        return;
+
+    mOutput.remove(index, marker.size());
+    mReady = true;
+    // NOTE Plugin libraries are all loaded before the probe is initialised.
+    unshadow();
+    qCDebug(launchLog) << "Standby instance is ready:" << mProcess->processId();
+}
+
+void WarmStandby::discard(void)
+{
+    if (mProcess) {
+        mProcess->disconnect(this);
+        mProcess->kill();
+        mProcess.reset();
+    }
+    mOutput.clear();
+    mReady = false;
+    unshadow();
+}
+
+void WarmStandby::unshadow(void)
+{
+    if (!mShadowed)
+        return;
+    QtcRunWorkerFactory::movePluginFiles(mLaunch.pluginFiles, QLatin1String(".del"), QString());
+    mShadowed = false;
+}
+
+} // Internal
+} // QtcDevPlugin
@@ -0,0 +1,196 @@
+/* Copyright 2026 Pascal COMBES <pascom@orange.fr>
+ *
+ * This file is part of QtcDevPlugin.
+ *
+ * QtcDevPlugin is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * QtcDevPlugin is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with QtcDevPlugin. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef WARMSTANDBY_H
+#define WARMSTANDBY_H
+
+#include <projectexplorer/runcontrol.h>
+
+#include <utils/commandline.h>
+#include <utils/environment.h>
+#include <utils/filepath.h>
+
+#include <QObject>
+
+#include <memory>
+
+namespace Utils {
+    class Process;
+}
+
+namespace QtcDevPlugin {
+namespace Internal {
+
+/*!
+ * \brief The WarmStandby class keeps a paused Qt Creator instance ready for the next run
+ *
+ * When the prewarm mode of a run configuration is enabled, the next Qt Creator instance
+ * is started in the background once a run is finished (see start()). The probe plugin
+ * (\c QtcDevProbe) is loaded in this instance and stops it (with \c SIGSTOP) as soon as
+ * it is initialised, i.e. after all plugin libraries are loaded but before most plugins
+ * are initialised (see Constants::ProbeStandbyVariable).
+ *
+ * When the next run is started with the same command line, environment and working directory,
+ * and the built plugin files did not change, the standby instance is taken by the run
+ * (see take()) and resumed (with \c SIGCONT) instead of launching a new instance (see receipe()).
+ * Otherwise, it is discarded.
+ *
+ * The plugin files are shadowed (see QtcRunWorkerFactory::movePluginFiles()) while the standby
+ * instance loads the plugins.
+ * There is at most one standby instance, which is killed when this object is destroyed.
+ *
+ * \note Standby instances are not available on Windows.
+ */
+class WarmStandby : public QObject
+{
+    Q_OBJECT
+public:
+    /*!
+     * \brief Launch parameters
+     */
+    typedef struct {
+        Utils::CommandLine command;             /*!< The command line of the instance */
+        Utils::Environment environment;         /*!< The environment of the instance */
+        Utils::FilePath workingDirectory;       /*!< The working directory of the instance */
+        QList<Utils::FilePath> pluginFiles;     /*!< The plugin files (shadowed while the plugins are loaded, see QtcRunWorkerFactory::pluginFiles()) */
+        QList<Utils::FilePath> builtFiles;      /*!< The built plugin files loaded by the instance (see builtFiles()) */
+    } Launch;
+
+    /*!
+     * \brief Constructor
+     *
+     * Creates a new warm standby manager.
+     * There should be only one instance (which is used by the static functions).
+     * \param parent The parent object.
+     */
+    WarmStandby(QObject* parent = nullptr);
+    /*!
+     * \brief Destructor
+     *
+     * Kills the standby instance, if any.
+     */
+    ~WarmStandby(void);
+
+    /*!
+     * \brief Start a standby instance
+     *
+     * Starts a standby instance for the given launch parameters,
+     * discarding the current one, if any.
+     * \param launch The launch parameters.
+     */
+    static void start(const Launch& launch);
+    /*!
+     * \brief Start a standby instance with a command
+     *
+     * Starts the given command as standby instance for the given launch parameters,
+     * discarding the current one, if any. The command must print Constants::ProbeStandbyMarker
+     * and stop itself once the plugins are loaded.
+     * \param launch The launch parameters.
+     * \param command The command of the standby instance.
+     * \param environment The environment of the standby instance.
+     * \sa start(const Launch&)
+     */
+    static void start(const Launch& launch, const Utils::CommandLine& command, const Utils::Environment& environment);
+    /*!
+     * \brief Whether the standby instance is ready
+     *
+     * Tells whether there is a standby instance which is stopped and can be taken.
+     * \return \c true if the standby instance is ready, \c false otherwise.
+     */
+    static bool isReady(void);
+    /*!
+     * \brief Take the standby instance
+     *
+     * Returns the standby instance if it is ready, matches the given launch parameters
+     * and the plugin files did not change. Otherwise the standby instance is discarded.
+     * \param launch The launch parameters.
+     * \param output Receives the output of the standby instance until it was stopped.
+     * \return The process of the standby instance or \c nullptr.
+     */
+    static std::shared_ptr<Utils::Process> take(const Launch& launch, QByteArray* output);
+    /*!
+     * \brief Receipe to resume a standby instance
+     *
+     * Returns the tasks resuming a standby instance and forwarding its output
+     * to the run control until it exits.
+     * \param runControl The run control.
+     * \param process The process of the standby instance (see take()).
+     * \param output The output of the standby instance until it was stopped.
+     * \return The tasks to resume the standby instance.
+     */
+    static Tasking::Group receipe(ProjectExplorer::RunControl* runControl, std::shared_ptr<Utils::Process> process, const QByteArray& output);
+
+    /*!
+     * \brief Fingerprint of files
+     *
+     * Computes a fingerprint of files from their sizes and modification times.
+     * \param files The paths to the files.
+     * \return The fingerprint of the files.
+     */
+    static QByteArray fingerprint(const QList<Utils::FilePath>& files);
+    /*!
+     * \brief Built plugin files
+     *
+     * Returns the plugin files which the instance loads from its plugin search paths
+     * (given with \c -pluginpath on the command line), e.g. from the build directory.
+     * \param arguments The command line arguments of the instance.
+     * \param pluginFiles The plugin files (see QtcRunWorkerFactory::pluginFiles()).
+     * \return The paths to the existing plugin files in the plugin search paths.
+     */
+    static QList<Utils::FilePath> builtFiles(const QStringList& arguments, const QList<Utils::FilePath>& pluginFiles);
+    /*!
+     * \brief Whether standby instances are available
+     *
+     * Tells whether standby instances can be used on this host.
+     * \return \c true if standby instances are available, \c false otherwise.
+     */
+    static bool isAvailable(void);
+private:
+    /*!
+     * \brief Handle standby instance output
+     *
+     * Stores the output of the standby instance and detects when it is stopped.
+     */
+    void handleOutput(void);
+    /*!
+     * \brief Discard the standby instance
+     *
+     * Kills the standby instance and unshadows the plugins if needed.
+     */
+    void discard(void);
+    /*!
+     * \brief Unshadow plugin files
+     *
+     * Restores the plugin files shadowed while the standby instance loads the plugins.
+     */
+    void unshadow(void);
+
+    static WarmStandby* sInstance;              /*!< The instance */
+
+    Launch mLaunch;                             /*!< The launch parameters of the standby instance */
+    QByteArray mFingerprint;                    /*!< The fingerprint of the plugin files and built plugin files when the standby instance was started */
+    std::shared_ptr<Utils::Process> mProcess;   /*!< The process of the standby instance */
+    QByteArray mOutput;                         /*!< The output of the standby instance */
+    bool mReady = false;                        /*!< Whether the standby instance is stopped */
+    bool mShadowed = false;                     /*!< Whether the plugin files are shadowed */
+};
+
+} // Internal
+} // QtcDevPlugin
+
+#endif // WARMSTANDBY_H